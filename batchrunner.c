@@ -0,0 +1,209 @@
+// runs many independent simulations of the garden map in one process, spread
+// across threads, for sweeping through gameplay variations faster than one
+// game at a time. each game gets its own copy of everything the simulation
+// writes to: the world objects, the pathfinding state and the spatial hash
+// query scratch state. the collision mesh and pathfinding graph are only read
+// once the games are initialized, so they're shared
+// build and run with
+// ./batchrunnerbuild.sh [games] [threads] [ticks]
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "constants.h"
+#include "game.h"
+#include "gameobject.h"
+#include "input.h"
+#include "pathfinding.h"
+#include "physics.h"
+
+#include "garden_map.h"
+#include "garden_map_collision.h"
+#include "garden_map_graph.h"
+
+#define BATCH_DEFAULT_GAMES 64
+#define BATCH_DEFAULT_THREADS 4
+#define BATCH_DEFAULT_TICKS 3600
+// how many ticks the scripted input holds each direction for
+#define BATCH_INPUT_PHASE_TICKS 200
+#define BATCH_INPUT_PHASES 6
+
+typedef struct BatchGame {
+  Game game;
+  int variant;  // which input script the game plays
+  GameObject worldObjects[GARDEN_MAP_COUNT];
+  PhysWorldData physWorldData;
+  SpatialHash worldMeshSpatialHash;
+  SpatialHashQueryContext queryContext;
+  PathfindingState pathfindingState;
+  NodeState nodeStates[GARDEN_MAP_GRAPH_SIZE];
+  int pathfindingOpenList[GARDEN_MAP_GRAPH_SIZE];
+  int pathfindingResult[GARDEN_MAP_GRAPH_SIZE];
+  unsigned int stateHash;
+} BatchGame;
+
+typedef struct BatchRun {
+  BatchGame* games;
+  int gamesCount;
+  int ticks;
+  int nextGame;  // taken with __sync_fetch_and_add()
+} BatchRun;
+
+// walks the goose around the garden in a fixed pattern, alternating between
+// walking and running and grabbing at regular intervals. each variant starts
+// at a different phase, so games with different variants take different routes
+void BatchRunner_scriptInput(Input* input, int tick, int variant) {
+  static float directions[BATCH_INPUT_PHASES][2] = {
+      {1.0f, 0.0f},    //
+      {0.0f, 1.0f},    //
+      {-1.0f, 0.3f},   //
+      {0.7f, -0.7f},   //
+      {0.0f, -1.0f},   //
+      {-0.5f, 0.5f},   //
+  };
+  int phase;
+
+  Input_init(input);
+  phase = (tick / BATCH_INPUT_PHASE_TICKS + variant) % BATCH_INPUT_PHASES;
+  input->direction.x = directions[phase][0];
+  input->direction.y = directions[phase][1];
+  input->run = (tick / (BATCH_INPUT_PHASE_TICKS / 2)) % 2;
+  input->pickup = tick % 150 == 0;
+}
+
+// not thread safe, as it builds the shared collision mesh
+void BatchGame_init(BatchGame* self, int variant) {
+  int i, trianglesCount;
+  unsigned int* visitedEpochs;
+
+  self->variant = variant;
+  for (i = 0; i < GARDEN_MAP_COUNT; i++) {
+    self->worldObjects[i] = garden_map_data[i];
+  }
+
+  trianglesCount = garden_map_collision_collision_mesh_baked.trianglesLength;
+  visitedEpochs =
+      (unsigned int*)malloc(trianglesCount * sizeof(unsigned int));
+  invariant(visitedEpochs);
+  SpatialHashQueryContext_init(&self->queryContext, visitedEpochs,
+                               trianglesCount);
+  self->worldMeshSpatialHash = garden_map_collision_collision_mesh_hash;
+  self->worldMeshSpatialHash.queryContext = &self->queryContext;
+
+  self->physWorldData.worldMesh = &garden_map_collision_collision_mesh_baked;
+  self->physWorldData.worldMeshSpatialHash = &self->worldMeshSpatialHash;
+  self->physWorldData.worldMeshBVH = NULL;
+  self->physWorldData.gravity = -9.8 * N64_SCALE_FACTOR;
+  self->physWorldData.viscosity = 0.05;
+  self->physWorldData.waterHeight = WATER_HEIGHT;
+
+  self->pathfindingState = garden_map_graph_pathfinding_state;
+  self->pathfindingState.nodeStates = self->nodeStates;
+  self->pathfindingState.openList = self->pathfindingOpenList;
+  self->pathfindingState.result = self->pathfindingResult;
+
+  Game_init(&self->game, self->worldObjects, GARDEN_MAP_COUNT,
+            &self->physWorldData);
+  Game_initPathfinding(&self->game, &garden_map_graph,
+                       &self->pathfindingState);
+}
+
+void BatchGame_destroy(BatchGame* self) {
+  Game_destroy(&self->game);
+  free(self->queryContext.visitedEpochs);
+}
+
+void BatchGame_run(BatchGame* self, int ticks) {
+  Input input;
+  int tick;
+
+  for (tick = 0; tick < ticks; tick++) {
+    BatchRunner_scriptInput(&input, tick, self->variant);
+    Game_tick(&self->game, &input);
+  }
+  self->stateHash = Game_hashState(&self->game);
+}
+
+void* BatchRunner_threadMain(void* arg) {
+  BatchRun* run;
+  int gameIndex;
+
+  run = (BatchRun*)arg;
+  for (;;) {
+    gameIndex = __sync_fetch_and_add(&run->nextGame, 1);
+    if (gameIndex >= run->gamesCount) {
+      return NULL;
+    }
+    BatchGame_run(run->games + gameIndex, run->ticks);
+  }
+}
+
+int main(int argc, char** argv) {
+  BatchRun run;
+  pthread_t* threads;
+  int gamesCount, threadsCount, ticks, i, mismatchedGames;
+  double startTime, totalTime;
+
+  gamesCount = argc > 1 ? atoi(argv[1]) : BATCH_DEFAULT_GAMES;
+  threadsCount = argc > 2 ? atoi(argv[2]) : BATCH_DEFAULT_THREADS;
+  ticks = argc > 3 ? atoi(argv[3]) : BATCH_DEFAULT_TICKS;
+  if (gamesCount < 1 || threadsCount < 1 || ticks < 1) {
+    printf("usage: %s [games] [threads] [ticks]\n", argv[0]);
+    return 1;
+  }
+
+  run.games = (BatchGame*)malloc(gamesCount * sizeof(BatchGame));
+  threads = (pthread_t*)malloc(threadsCount * sizeof(pthread_t));
+  invariant(run.games && threads);
+  run.gamesCount = gamesCount;
+  run.ticks = ticks;
+  run.nextGame = 0;
+  for (i = 0; i < gamesCount; i++) {
+    BatchGame_init(run.games + i, i % BATCH_INPUT_PHASES);
+  }
+
+  startTime = CUR_TIME_MS();
+  for (i = 0; i < threadsCount; i++) {
+    if (pthread_create(&threads[i], NULL, BatchRunner_threadMain, &run)) {
+      printf("failed to start thread %d\n", i);
+      return 1;
+    }
+  }
+  for (i = 0; i < threadsCount; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  totalTime = CUR_TIME_MS() - startTime;
+
+  // games playing the same script must end up in the same state, or they
+  // weren't really independent
+  mismatchedGames = 0;
+  for (i = 0; i < gamesCount; i++) {
+    if (i < BATCH_INPUT_PHASES) {
+      printf("variant %d state hash %08x\n", i, run.games[i].stateHash);
+    } else if (run.games[i].stateHash !=
+               run.games[i % BATCH_INPUT_PHASES].stateHash) {
+      printf("game %d state hash %08x doesn't match variant %d\n", i,
+             run.games[i].stateHash, i % BATCH_INPUT_PHASES);
+      mismatchedGames++;
+    }
+  }
+
+  printf("%d games of %d ticks on %d threads in %.3f ms (%.0f ticks/sec)\n",
+         gamesCount, ticks, threadsCount, totalTime,
+         (double)gamesCount * ticks / (totalTime / 1000.0));
+
+  for (i = 0; i < gamesCount; i++) {
+    BatchGame_destroy(run.games + i);
+  }
+  free(run.games);
+  free(threads);
+
+  if (mismatchedGames) {
+    printf("%d games diverged from the other games with the same variant\n",
+           mismatchedGames);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,10 @@
+#!/bin/bash
+set -eu
+
+# builds and runs the parallel batch of simulations in batchrunner.c
+# usage: ./batchrunnerbuild.sh [games] [threads] [ticks]
+
+BATCHRUNNER_SOURCE_FILES="batchrunner.c animation.c character.c characterstate.c collision.c compat.c frustum.c game.c gameobject.c gameobjectgrid.c gameutils.c garden_map_collision.c garden_map_graph.c input.c inputrecording.c item.c modeltype.c pathfinding.c physics.c player.c renderer.c rotation.c trace.c vec2d.c vec3d.c"
+
+cc $BATCHRUNNER_SOURCE_FILES -std=gnu90 -O2 -Wall -Wno-comment -lm -lpthread -o batchrunner
+./batchrunner "$@"
@@ -0,0 +1,1618 @@
+// native benchmarks for the collision and physics code
+// build and run with ./benchbuild.sh [benchmark name]
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "collision.h"
+#include "constants.h"
+#include "pathfinding.h"
+#include "physics.h"
+#include "vec3d.h"
+
+#include "garden_map_collision.h"
+
+#define BENCH_QUERIES 200000
+#define BENCH_MAX_RESULTS 100
+#define BENCH_RAY_LENGTH 600.0f
+// enough that the candidate queries in the bvh benchmark never run out
+#define BENCH_BVH_MAX_RESULTS 1000
+#define BENCH_SYNTHETIC_QUADS_PER_SIDE 130
+#define BENCH_SYNTHETIC_FLOORS 3
+#define BENCH_SYNTHETIC_FLOOR_SPACING 150.0f
+#define BENCH_SYNTHETIC_EXTENT 4800.0f
+#define BENCH_SYNTHETIC_GRID_CELL_SIZE 40.0f
+#define BENCH_SYNTHETIC_GRID_CELLS_IN_DIMENSION 252
+#define BENCH_INTEGRATE_STEPS 1000
+#define BENCH_THREADS_BODIES 4000
+#define BENCH_THREADS_STEPS 100
+#define BENCH_WALL_BODIES 1000
+#define BENCH_WALL_STEPS 60
+#define BENCH_WALL_SIZE 2000.0f
+#define BENCH_CROWD_STEPS 200
+#define BENCH_CROWD_DENSITY 0.0004f  // bodies per square unit
+#define BENCH_PATH_SEARCHES 4
+#define BENCH_PATH_NODE_SPACING 100.0f
+#define BENCH_PATH_BLOCKED_FRACTION 0.15f
+#define BENCH_QUANTIZE_QUERIES 20000
+#define BENCH_PATH_SLICE_EXPANSIONS 256
+
+typedef void (*BenchFn)(void);
+
+typedef struct Benchmark {
+  char* name;
+  BenchFn run;
+} Benchmark;
+
+static unsigned int benchRandState = 1;
+
+// deterministic across platforms, unlike rand()
+float Bench_randFloat() {
+  benchRandState = benchRandState * 1103515245 + 12345;
+  return (float)((benchRandState >> 8) & 0xffff) / 65535.0f;
+}
+
+double Bench_nowMS() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+void Bench_meshBounds(Triangle* triangles, int trianglesLength, AABB* result) {
+  int i;
+  AABB triangleAABB;
+  AABB_fromTriangle(triangles, result);
+  for (i = 1; i < trianglesLength; i++) {
+    AABB_fromTriangle(triangles + i, &triangleAABB);
+    result->min.x = MIN(result->min.x, triangleAABB.min.x);
+    result->min.y = MIN(result->min.y, triangleAABB.min.y);
+    result->min.z = MIN(result->min.z, triangleAABB.min.z);
+    result->max.x = MAX(result->max.x, triangleAABB.max.x);
+    result->max.y = MAX(result->max.y, triangleAABB.max.y);
+    result->max.z = MAX(result->max.z, triangleAABB.max.z);
+  }
+}
+
+void Bench_randomPointInAABB(AABB* bounds, Vec3d* result) {
+  result->x =
+      bounds->min.x + Bench_randFloat() * (bounds->max.x - bounds->min.x);
+  result->y =
+      bounds->min.y + Bench_randFloat() * (bounds->max.y - bounds->min.y);
+  result->z =
+      bounds->min.z + Bench_randFloat() * (bounds->max.z - bounds->min.z);
+}
+
+// runs the same queries with and without the epoch stamped query context,
+// checking that both produce identical results
+void Bench_spatialHashQueries(SpatialHash* spatialHash,
+                              Vec3d* points,
+                              Vec3d* rayEnds,
+                              float radius,
+                              int useRaycast,
+                              double* resultTimeMS,
+                              unsigned long* resultChecksum,
+                              long* resultCandidates) {
+  int i, k, resultsCount;
+  int results[BENCH_MAX_RESULTS];
+  unsigned long checksum;
+  long candidates;
+  double startTime;
+
+  checksum = 0;
+  candidates = 0;
+  startTime = Bench_nowMS();
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    if (useRaycast) {
+      resultsCount = SpatialHash_getTrianglesForRaycast(
+          points + i, rayEnds + i, spatialHash, results, BENCH_MAX_RESULTS);
+    } else {
+      resultsCount = SpatialHash_getTriangles(points + i, radius, spatialHash,
+                                              results, BENCH_MAX_RESULTS);
+    }
+    candidates += resultsCount;
+    for (k = 0; k < resultsCount; k++) {
+      checksum = checksum * 31 + results[k];
+    }
+  }
+  *resultTimeMS = Bench_nowMS() - startTime;
+  *resultChecksum = checksum;
+  *resultCandidates = candidates;
+}
+
+void Bench_spatialHashDedupCase(char* label,
+                                SpatialHash* spatialHash,
+                                Vec3d* points,
+                                Vec3d* rayEnds,
+                                float radius,
+                                int useRaycast) {
+  SpatialHashQueryContext* queryContext;
+  double epochTimeMS, scanTimeMS;
+  unsigned long epochChecksum, scanChecksum;
+  long epochCandidates, scanCandidates;
+
+  queryContext = spatialHash->queryContext;
+  invariant(queryContext != NULL);
+
+  Bench_spatialHashQueries(spatialHash, points, rayEnds, radius, useRaycast,
+                           &epochTimeMS, &epochChecksum, &epochCandidates);
+
+  spatialHash->queryContext = NULL;
+  Bench_spatialHashQueries(spatialHash, points, rayEnds, radius, useRaycast,
+                           &scanTimeMS, &scanChecksum, &scanCandidates);
+  spatialHash->queryContext = queryContext;
+
+  printf(
+      "%-28s epoch: %7.1f ns/query  scan: %7.1f ns/query  speedup: %5.2fx  "
+      "avg candidates: %5.1f  %s\n",
+      label, epochTimeMS * 1000000.0 / BENCH_QUERIES,
+      scanTimeMS * 1000000.0 / BENCH_QUERIES, scanTimeMS / epochTimeMS,
+      (double)epochCandidates / BENCH_QUERIES,
+      epochChecksum == scanChecksum && epochCandidates == scanCandidates
+          ? "results match"
+          : "RESULTS DIFFER");
+}
+
+void Bench_spatialHashDedup() {
+  int i;
+  AABB bounds;
+  Vec3d* points;
+  Vec3d* rayEnds;
+  Vec3d rayDirection;
+  char label[64];
+  float radii[] = {25.0f, 60.0f, 150.0f, 300.0f};
+  SpatialHash* spatialHash = &garden_map_collision_collision_mesh_hash;
+
+  points = (Vec3d*)malloc(BENCH_QUERIES * sizeof(Vec3d));
+  rayEnds = (Vec3d*)malloc(BENCH_QUERIES * sizeof(Vec3d));
+  invariant(points && rayEnds);
+
+  Bench_meshBounds(garden_map_collision_collision_mesh,
+                   GARDEN_MAP_COLLISION_LENGTH, &bounds);
+  benchRandState = 1;
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    Bench_randomPointInAABB(&bounds, points + i);
+    Vec3d_init(&rayDirection, Bench_randFloat() - 0.5f, 0.0f,
+               Bench_randFloat() - 0.5f);
+    Vec3d_normalise(&rayDirection);
+    Vec3d_mulScalar(&rayDirection, BENCH_RAY_LENGTH * Bench_randFloat());
+    rayEnds[i] = points[i];
+    Vec3d_add(rayEnds + i, &rayDirection);
+  }
+
+  printf("spatial hash dedup: garden map, %d tris, %d queries per case\n",
+         GARDEN_MAP_COLLISION_LENGTH, BENCH_QUERIES);
+  for (i = 0; i < (int)(sizeof(radii) / sizeof(float)); i++) {
+    sprintf(label, "getTriangles r=%.0f", radii[i]);
+    Bench_spatialHashDedupCase(label, spatialHash, points, rayEnds, radii[i],
+                               FALSE);
+  }
+  Bench_spatialHashDedupCase("getTrianglesForRaycast", spatialHash, points,
+                             rayEnds, 0.0f, TRUE);
+
+  free(points);
+  free(rayEnds);
+}
+
+#if COLLISION_SIMD_ENABLED
+// runs sphere queries against the mesh, hashing every result bit so the SIMD
+// and scalar paths can be compared exactly
+void Bench_meshSphereQueries(CollisionMesh* mesh,
+                             SpatialHash* spatialHash,
+                             Vec3d* points,
+                             float radius,
+                             double* resultTimeMS,
+                             unsigned long* resultChecksum,
+                             long* resultHits) {
+  int i;
+  unsigned int bits[4];
+  unsigned long checksum;
+  long hits;
+  double startTime;
+  SphereTriangleCollision collision;
+
+  checksum = 0;
+  hits = 0;
+  startTime = Bench_nowMS();
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    if (Collision_testMeshSphereCollision(mesh, points + i, radius,
+                                          spatialHash, NULL, &collision)) {
+      hits++;
+      memcpy(&bits[0], &collision.distance, sizeof(float));
+      memcpy(&bits[1], &collision.posInTriangle.x, sizeof(float));
+      memcpy(&bits[2], &collision.posInTriangle.y, sizeof(float));
+      memcpy(&bits[3], &collision.posInTriangle.z, sizeof(float));
+      checksum = checksum * 31 + collision.index;
+      checksum = checksum * 31 + bits[0];
+      checksum = checksum * 31 + bits[1];
+      checksum = checksum * 31 + bits[2];
+      checksum = checksum * 31 + bits[3];
+    }
+  }
+  *resultTimeMS = Bench_nowMS() - startTime;
+  *resultChecksum = checksum;
+  *resultHits = hits;
+}
+
+void Bench_meshSphereSIMD() {
+  int i, r;
+  AABB bounds;
+  Vec3d* points;
+  CollisionMesh* mesh = &garden_map_collision_collision_mesh_baked;
+  CollisionMeshSoA* soa;
+  SpatialHash* spatialHash = &garden_map_collision_collision_mesh_hash;
+  float radii[] = {25.0f, 60.0f, 150.0f};
+  double simdTimeMS, scalarTimeMS;
+  unsigned long simdChecksum, scalarChecksum;
+  long simdHits, scalarHits;
+
+  CollisionMesh_build(mesh);
+  soa = mesh->soa;
+  invariant(soa != NULL);
+
+  points = (Vec3d*)malloc(BENCH_QUERIES * sizeof(Vec3d));
+  invariant(points);
+
+  // keep the points near the ground so most queries touch some triangles
+  Bench_meshBounds(garden_map_collision_collision_mesh,
+                   GARDEN_MAP_COLLISION_LENGTH, &bounds);
+  bounds.max.y = MIN(bounds.max.y, bounds.min.y + 200.0f);
+  benchRandState = 1;
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    Bench_randomPointInAABB(&bounds, points + i);
+  }
+
+  printf("mesh sphere simd: garden map, %d tris, %d queries per case\n",
+         GARDEN_MAP_COLLISION_LENGTH, BENCH_QUERIES);
+  for (r = 0; r < (int)(sizeof(radii) / sizeof(float)); r++) {
+    Bench_meshSphereQueries(mesh, spatialHash, points, radii[r], &simdTimeMS,
+                            &simdChecksum, &simdHits);
+    mesh->soa = NULL;
+    Bench_meshSphereQueries(mesh, spatialHash, points, radii[r],
+                            &scalarTimeMS, &scalarChecksum, &scalarHits);
+    mesh->soa = soa;
+
+    printf(
+        "testMeshSphere r=%-10.0f simd: %7.1f ns/query  scalar: %7.1f "
+        "ns/query  speedup: %5.2fx  hits: %ld  %s\n",
+        radii[r], simdTimeMS * 1000000.0 / BENCH_QUERIES,
+        scalarTimeMS * 1000000.0 / BENCH_QUERIES, scalarTimeMS / simdTimeMS,
+        simdHits,
+        simdChecksum == scalarChecksum && simdHits == scalarHits
+            ? "results match"
+            : "RESULTS DIFFER");
+  }
+
+  free(points);
+}
+#endif
+
+// runs sphere or raycast candidate queries against the spatial hash or BVH
+void Bench_candidateQueries(SpatialHash* spatialHash,
+                            CollisionBVH* bvh,
+                            Vec3d* points,
+                            Vec3d* rayEnds,
+                            float radius,
+                            int useRaycast,
+                            double* resultTimeMS,
+                            long* resultCandidates) {
+  int i, resultsCount;
+  int results[BENCH_BVH_MAX_RESULTS];
+  long candidates;
+  double startTime;
+
+  candidates = 0;
+  startTime = Bench_nowMS();
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    if (useRaycast) {
+      resultsCount =
+          bvh ? CollisionBVH_getTrianglesForRaycast(points + i, rayEnds + i,
+                                                    radius, bvh, results,
+                                                    BENCH_BVH_MAX_RESULTS)
+              : SpatialHash_getTrianglesForRaycast(points + i, rayEnds + i,
+                                                   spatialHash, results,
+                                                   BENCH_BVH_MAX_RESULTS);
+    } else {
+      resultsCount =
+          bvh ? CollisionBVH_getTriangles(points + i, radius, bvh, results,
+                                          BENCH_BVH_MAX_RESULTS)
+              : SpatialHash_getTriangles(points + i, radius, spatialHash,
+                                         results, BENCH_BVH_MAX_RESULTS);
+    }
+    candidates += resultsCount;
+  }
+  *resultTimeMS = Bench_nowMS() - startTime;
+  *resultCandidates = candidates;
+}
+
+// full sphere vs mesh test, recording the distance of each hit so the
+// backends can be compared. which triangle is reported can differ when
+// several are exactly as close (eg. at a shared edge)
+void Bench_meshSphereCollisions(CollisionMesh* mesh,
+                                SpatialHash* spatialHash,
+                                CollisionBVH* bvh,
+                                Vec3d* points,
+                                float radius,
+                                float* distances,
+                                double* resultTimeMS) {
+  int i;
+  double startTime;
+  SphereTriangleCollision collision;
+
+  startTime = Bench_nowMS();
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    distances[i] =
+        Collision_testMeshSphereCollision(mesh, points + i, radius,
+                                          spatialHash, bvh, &collision)
+            ? collision.distance
+            : -1.0f;
+  }
+  *resultTimeMS = Bench_nowMS() - startTime;
+}
+
+void Bench_bvhCompare(char* mapName,
+                      CollisionMesh* mesh,
+                      SpatialHash* spatialHash,
+                      Vec3d* points,
+                      Vec3d* rayEnds,
+                      float radius) {
+  int i, mismatches;
+  long hashBytes;
+  double startTime, buildTimeMS, hashTimeMS, bvhTimeMS;
+  long hashCandidates, bvhCandidates;
+  float* hashDistances;
+  float* bvhDistances;
+  CollisionBVH bvh;
+
+  bvh.nodes = (CollisionBVHNode*)malloc(
+      COLLISION_BVH_MAX_NODES(mesh->trianglesLength) *
+      sizeof(CollisionBVHNode));
+  bvh.triangleIndices = (int*)malloc(mesh->trianglesLength * sizeof(int));
+  hashDistances = (float*)malloc(BENCH_QUERIES * sizeof(float));
+  bvhDistances = (float*)malloc(BENCH_QUERIES * sizeof(float));
+  invariant(bvh.nodes && bvh.triangleIndices && hashDistances &&
+            bvhDistances);
+
+  startTime = Bench_nowMS();
+  CollisionBVH_build(&bvh, mesh->triangles, mesh->trianglesLength);
+  buildTimeMS = Bench_nowMS() - startTime;
+  printf("bvh: %s, %d tris, %d nodes, built in %.1f ms, %d queries per case\n",
+         mapName, mesh->trianglesLength, bvh.nodesLength, buildTimeMS,
+         BENCH_QUERIES);
+
+  hashBytes =
+      (spatialHash->numBuckets + 1 +
+       SpatialHash_getEntry(spatialHash, spatialHash->bucketOffsets,
+                            spatialHash->numBuckets)) *
+      (spatialHash->wideIndices ? sizeof(unsigned int)
+                                : sizeof(unsigned short));
+  printf("%-22s hash: %7ld KB (%d buckets)  bvh: %7ld KB\n", "memory",
+         hashBytes / 1024, spatialHash->numBuckets,
+         (long)(bvh.nodesLength * sizeof(CollisionBVHNode) +
+                mesh->trianglesLength * sizeof(int)) /
+             1024);
+
+  Bench_candidateQueries(spatialHash, NULL, points, rayEnds, radius, FALSE,
+                         &hashTimeMS, &hashCandidates);
+  Bench_candidateQueries(spatialHash, &bvh, points, rayEnds, radius, FALSE,
+                         &bvhTimeMS, &bvhCandidates);
+  printf(
+      "%-22s hash: %7.1f ns/query %6.1f candidates  bvh: %7.1f ns/query "
+      "%6.1f candidates\n",
+      "getTriangles", hashTimeMS * 1000000.0 / BENCH_QUERIES,
+      (double)hashCandidates / BENCH_QUERIES,
+      bvhTimeMS * 1000000.0 / BENCH_QUERIES,
+      (double)bvhCandidates / BENCH_QUERIES);
+
+  Bench_candidateQueries(spatialHash, NULL, points, rayEnds, 0.0f, TRUE,
+                         &hashTimeMS, &hashCandidates);
+  Bench_candidateQueries(spatialHash, &bvh, points, rayEnds, 0.0f, TRUE,
+                         &bvhTimeMS, &bvhCandidates);
+  printf(
+      "%-22s hash: %7.1f ns/query %6.1f candidates  bvh: %7.1f ns/query "
+      "%6.1f candidates\n",
+      "getTrianglesForRaycast", hashTimeMS * 1000000.0 / BENCH_QUERIES,
+      (double)hashCandidates / BENCH_QUERIES,
+      bvhTimeMS * 1000000.0 / BENCH_QUERIES,
+      (double)bvhCandidates / BENCH_QUERIES);
+
+  Bench_meshSphereCollisions(mesh, spatialHash, NULL, points, radius,
+                             hashDistances, &hashTimeMS);
+  Bench_meshSphereCollisions(mesh, spatialHash, &bvh, points, radius,
+                             bvhDistances, &bvhTimeMS);
+  mismatches = 0;
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    if (hashDistances[i] != bvhDistances[i]) {
+      mismatches++;
+    }
+  }
+  printf(
+      "%-22s hash: %7.1f ns/query  bvh: %7.1f ns/query  speedup: %5.2fx  "
+      "%d results differ\n",
+      "testMeshSphere", hashTimeMS * 1000000.0 / BENCH_QUERIES,
+      bvhTimeMS * 1000000.0 / BENCH_QUERIES, hashTimeMS / bvhTimeMS,
+      mismatches);
+
+  free(bvh.nodes);
+  free(bvh.triangleIndices);
+  free(hashDistances);
+  free(bvhDistances);
+}
+
+// buckets each triangle into every cell its AABB covers. always uses 32 bit
+// entries, as the synthetic map has too many triangles for 16 bit ones
+void Bench_buildSpatialHash(Triangle* triangles,
+                            int trianglesLength,
+                            float gridCellSize,
+                            int cellsInDimension,
+                            SpatialHash* spatialHash,
+                            SpatialHashQueryContext* queryContext) {
+  int i, pass, cellX, cellY, minCellX, minCellY, maxCellX, maxCellY;
+  int bucketIndex;
+  AABB triangleAABB;
+  unsigned int* bucketOffsets;
+  unsigned int* bucketSizes;
+  unsigned int* triangleIndices;
+
+  spatialHash->gridCellSize = gridCellSize;
+  spatialHash->cellsInDimension = cellsInDimension;
+  spatialHash->cellOffsetInDimension = cellsInDimension / 2;
+  spatialHash->numBuckets =
+      spatialHash->cellsInDimension * spatialHash->cellsInDimension;
+  spatialHash->wideIndices = TRUE;
+  bucketOffsets = (unsigned int*)calloc(spatialHash->numBuckets + 1,
+                                        sizeof(unsigned int));
+  bucketSizes =
+      (unsigned int*)calloc(spatialHash->numBuckets, sizeof(unsigned int));
+  invariant(bucketOffsets && bucketSizes);
+  triangleIndices = NULL;
+
+  // first pass counts the bucket sizes, second fills them
+  for (pass = 0; pass < 2; pass++) {
+    for (i = 0; i < trianglesLength; i++) {
+      AABB_fromTriangle(triangles + i, &triangleAABB);
+      minCellX = SpatialHash_unitsToGridForDimension(triangleAABB.min.x,
+                                                     spatialHash);
+      maxCellX = SpatialHash_unitsToGridForDimension(triangleAABB.max.x,
+                                                     spatialHash);
+      minCellY = SpatialHash_unitsToGridForDimension(-triangleAABB.max.z,
+                                                     spatialHash);
+      maxCellY = SpatialHash_unitsToGridForDimension(-triangleAABB.min.z,
+                                                     spatialHash);
+      for (cellX = minCellX; cellX <= maxCellX; cellX++) {
+        for (cellY = minCellY; cellY <= maxCellY; cellY++) {
+          bucketIndex = cellY * spatialHash->cellsInDimension + cellX;
+          invariant(bucketIndex >= 0 &&
+                    bucketIndex < spatialHash->numBuckets);
+          if (pass == 1) {
+            triangleIndices[bucketOffsets[bucketIndex] +
+                            bucketSizes[bucketIndex]] = i;
+          }
+          bucketSizes[bucketIndex]++;
+        }
+      }
+    }
+    if (pass == 0) {
+      for (i = 0; i < spatialHash->numBuckets; i++) {
+        bucketOffsets[i + 1] = bucketOffsets[i] + bucketSizes[i];
+        bucketSizes[i] = 0;
+      }
+      triangleIndices = (unsigned int*)malloc(
+          bucketOffsets[spatialHash->numBuckets] * sizeof(unsigned int));
+      invariant(triangleIndices);
+    }
+  }
+  free(bucketSizes);
+  spatialHash->bucketOffsets = bucketOffsets;
+  spatialHash->triangleIndices = triangleIndices;
+
+  SpatialHashQueryContext_init(
+      queryContext, (unsigned int*)calloc(trianglesLength, sizeof(int)),
+      trianglesLength);
+  spatialHash->queryContext = queryContext;
+}
+
+void Bench_freeSpatialHash(SpatialHash* spatialHash) {
+  free(spatialHash->bucketOffsets);
+  free(spatialHash->triangleIndices);
+  free(spatialHash->queryContext->visitedEpochs);
+}
+
+float Bench_syntheticHeight(float x, float z, int floor) {
+  return floor * BENCH_SYNTHETIC_FLOOR_SPACING +
+         20.0f * sinf(x * 0.01f + floor) * cosf(z * 0.013f);
+}
+
+// stacked floors of bumpy terrain, like a multistorey level. every floor
+// lands in the same grid cells, which is the worst case for the hash
+int Bench_buildSyntheticMap(Triangle** resultTriangles) {
+  int floor, qx, qz, trianglesLength;
+  float quadSize, x0, z0, x1, z1;
+  Triangle* triangles;
+  Triangle* tri;
+
+  trianglesLength = BENCH_SYNTHETIC_FLOORS * BENCH_SYNTHETIC_QUADS_PER_SIDE *
+                    BENCH_SYNTHETIC_QUADS_PER_SIDE * 2;
+  triangles = (Triangle*)malloc(trianglesLength * sizeof(Triangle));
+  invariant(triangles);
+
+  quadSize = BENCH_SYNTHETIC_EXTENT * 2.0f / BENCH_SYNTHETIC_QUADS_PER_SIDE;
+  tri = triangles;
+  for (floor = 0; floor < BENCH_SYNTHETIC_FLOORS; floor++) {
+    for (qx = 0; qx < BENCH_SYNTHETIC_QUADS_PER_SIDE; qx++) {
+      for (qz = 0; qz < BENCH_SYNTHETIC_QUADS_PER_SIDE; qz++) {
+        x0 = -BENCH_SYNTHETIC_EXTENT + qx * quadSize;
+        z0 = -BENCH_SYNTHETIC_EXTENT + qz * quadSize;
+        x1 = x0 + quadSize;
+        z1 = z0 + quadSize;
+        Vec3d_init(&tri->a, x0, Bench_syntheticHeight(x0, z0, floor), z0);
+        Vec3d_init(&tri->b, x0, Bench_syntheticHeight(x0, z1, floor), z1);
+        Vec3d_init(&tri->c, x1, Bench_syntheticHeight(x1, z0, floor), z0);
+        tri++;
+        Vec3d_init(&tri->a, x1, Bench_syntheticHeight(x1, z0, floor), z0);
+        Vec3d_init(&tri->b, x0, Bench_syntheticHeight(x0, z1, floor), z1);
+        Vec3d_init(&tri->c, x1, Bench_syntheticHeight(x1, z1, floor), z1);
+        tri++;
+      }
+    }
+  }
+  *resultTriangles = triangles;
+  return trianglesLength;
+}
+
+void Bench_makeRays(Vec3d* points, Vec3d* rayEnds) {
+  int i;
+  Vec3d rayDirection;
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    Vec3d_init(&rayDirection, Bench_randFloat() - 0.5f, 0.0f,
+               Bench_randFloat() - 0.5f);
+    Vec3d_normalise(&rayDirection);
+    Vec3d_mulScalar(&rayDirection, BENCH_RAY_LENGTH * Bench_randFloat());
+    rayEnds[i] = points[i];
+    Vec3d_add(rayEnds + i, &rayDirection);
+  }
+}
+
+void Bench_bvh() {
+  int i;
+  float queryExtent;
+  AABB bounds;
+  Vec3d* points;
+  Vec3d* rayEnds;
+  Triangle* syntheticTriangles;
+  CollisionMesh syntheticMesh;
+  SpatialHash syntheticHash;
+  SpatialHashQueryContext syntheticHashQueryContext;
+
+  points = (Vec3d*)malloc(BENCH_QUERIES * sizeof(Vec3d));
+  rayEnds = (Vec3d*)malloc(BENCH_QUERIES * sizeof(Vec3d));
+  invariant(points && rayEnds);
+
+  // garden map, with points near the ground
+  CollisionMesh_build(&garden_map_collision_collision_mesh_baked);
+  Bench_meshBounds(garden_map_collision_collision_mesh,
+                   GARDEN_MAP_COLLISION_LENGTH, &bounds);
+  bounds.max.y = MIN(bounds.max.y, bounds.min.y + 200.0f);
+  benchRandState = 1;
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    Bench_randomPointInAABB(&bounds, points + i);
+  }
+  Bench_makeRays(points, rayEnds);
+  Bench_bvhCompare("garden map", &garden_map_collision_collision_mesh_baked,
+                   &garden_map_collision_collision_mesh_hash, points, rayEnds,
+                   60.0f);
+
+  // synthetic map, with points just above one of the floors
+  memset(&syntheticMesh, 0, sizeof(CollisionMesh));
+  syntheticMesh.trianglesLength = Bench_buildSyntheticMap(&syntheticTriangles);
+  syntheticMesh.triangles = syntheticTriangles;
+  syntheticMesh.triangleData = (CollisionMeshTriangle*)malloc(
+      syntheticMesh.trianglesLength * sizeof(CollisionMeshTriangle));
+  invariant(syntheticMesh.triangleData);
+  CollisionMesh_build(&syntheticMesh);
+  // with the garden map's 120 unit cells, buckets here would hold ~40 tris
+  // and most queries would overflow the results array, so the grid needs to
+  // be much finer (and bigger) for this map
+  Bench_buildSpatialHash(syntheticTriangles, syntheticMesh.trianglesLength,
+                         BENCH_SYNTHETIC_GRID_CELL_SIZE,
+                         BENCH_SYNTHETIC_GRID_CELLS_IN_DIMENSION,
+                         &syntheticHash, &syntheticHashQueryContext);
+  // the spatial hash doesn't handle rays leaving the grid, so keep the rays
+  // within the map
+  queryExtent = BENCH_SYNTHETIC_EXTENT - BENCH_RAY_LENGTH;
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    Vec3d_init(points + i, (Bench_randFloat() * 2.0f - 1.0f) * queryExtent,
+               (int)(Bench_randFloat() * (BENCH_SYNTHETIC_FLOORS - 1) + 0.5f) *
+                       BENCH_SYNTHETIC_FLOOR_SPACING +
+                   Bench_randFloat() * 40.0f,
+               (Bench_randFloat() * 2.0f - 1.0f) * queryExtent);
+  }
+  Bench_makeRays(points, rayEnds);
+  printf("\n");
+  Bench_bvhCompare("synthetic map", &syntheticMesh, &syntheticHash, points,
+                   rayEnds, 30.0f);
+
+  Bench_freeSpatialHash(&syntheticHash);
+  free(syntheticMesh.triangleData);
+#if COLLISION_SIMD_ENABLED
+  if (syntheticMesh.soa) {
+    free(syntheticMesh.soa->aabbMinX);
+    free(syntheticMesh.soa);
+  }
+#endif
+  free(syntheticTriangles);
+  free(points);
+  free(rayEnds);
+}
+
+// queries the compiled in garden map hash and the same hash loaded from the
+// binary file written by the exporter, checking both give the same results
+void Bench_spatialHashFile() {
+  int i;
+  AABB bounds;
+  Vec3d* points;
+  Vec3d* rayEnds;
+  SpatialHash fileHash;
+  double staticTimeMS, fileTimeMS;
+  unsigned long staticChecksum, fileChecksum;
+  long staticCandidates, fileCandidates;
+
+  fileHash = garden_map_collision_collision_mesh_hash;
+  if (!SpatialHash_mapFile(&fileHash, "garden_map_collision_hash.bin")) {
+    printf("spatial hash file: couldn't load garden_map_collision_hash.bin\n");
+    return;
+  }
+
+  points = (Vec3d*)malloc(BENCH_QUERIES * sizeof(Vec3d));
+  rayEnds = (Vec3d*)malloc(BENCH_QUERIES * sizeof(Vec3d));
+  invariant(points && rayEnds);
+  Bench_meshBounds(garden_map_collision_collision_mesh,
+                   GARDEN_MAP_COLLISION_LENGTH, &bounds);
+  benchRandState = 1;
+  for (i = 0; i < BENCH_QUERIES; i++) {
+    Bench_randomPointInAABB(&bounds, points + i);
+  }
+  Bench_makeRays(points, rayEnds);
+
+  printf("spatial hash file: garden map, %d queries per case\n",
+         BENCH_QUERIES);
+  for (i = 0; i < 2; i++) {
+    Bench_spatialHashQueries(&garden_map_collision_collision_mesh_hash,
+                             points, rayEnds, 60.0f, i, &staticTimeMS,
+                             &staticChecksum, &staticCandidates);
+    Bench_spatialHashQueries(&fileHash, points, rayEnds, 60.0f, i,
+                             &fileTimeMS, &fileChecksum, &fileCandidates);
+    printf("%-28s static: %7.1f ns/query  mapped: %7.1f ns/query  %s\n",
+           i ? "getTrianglesForRaycast" : "getTriangles r=60",
+           staticTimeMS * 1000000.0 / BENCH_QUERIES,
+           fileTimeMS * 1000000.0 / BENCH_QUERIES,
+           staticChecksum == fileChecksum && staticCandidates == fileCandidates
+               ? "results match"
+               : "RESULTS DIFFER");
+  }
+
+  free(points);
+  free(rayEnds);
+}
+
+// a crowd of bodies wandering around, separated each step
+void Bench_crowdSteps(PhysBody* bodies,
+                      int bodiesCount,
+                      PhysBroadphase* broadphase,
+                      double* resultTimeMS) {
+  int step, i;
+  double startTime;
+  Vec3d move, position;
+
+  benchRandState = 1;
+  *resultTimeMS = 0;
+  for (step = 0; step < BENCH_CROWD_STEPS; step++) {
+    for (i = 0; i < bodiesCount; i++) {
+      Vec3d_init(&move, (Bench_randFloat() - 0.5f) * 8.0f, 0.0f,
+                 (Bench_randFloat() - 0.5f) * 8.0f);
+      PhysBody_getPosition(bodies + i, &position);
+      Vec3d_add(&position, &move);
+      PhysBody_setPosition(bodies + i, &position);
+    }
+    startTime = Bench_nowMS();
+    PhysBehavior_bodiesCollisionResponse(broadphase, bodies, bodiesCount);
+    *resultTimeMS += Bench_nowMS() - startTime;
+  }
+}
+
+// fills the world with the bodies
+void Bench_crowdBodies(PhysBody* bodies, PhysWorld* world, int bodiesCount) {
+  int i;
+  float extent;
+  Vec3d pos;
+
+  PhysWorld_init(world, bodiesCount);
+  // keep the density constant, so only the number of bodies changes
+  extent = sqrtf(bodiesCount / BENCH_CROWD_DENSITY);
+  benchRandState = 2;
+  for (i = 0; i < bodiesCount; i++) {
+    Vec3d_init(&pos, Bench_randFloat() * extent, 0.0f,
+               Bench_randFloat() * extent);
+    PhysBody_init(bodies + i, world, 10.0f + Bench_randFloat() * 40.0f,
+                  10.0f + Bench_randFloat() * 20.0f, &pos, i);
+    // a few disabled bodies, like held items
+    if (i % 16 == 0) {
+      PhysBody_setEnabled(bodies + i, FALSE);
+    }
+  }
+}
+
+int Bench_samePosition(PhysBody* a, PhysBody* b) {
+  Vec3d positionA, positionB;
+
+  PhysBody_getPosition(a, &positionA);
+  PhysBody_getPosition(b, &positionB);
+  return memcmp(&positionA, &positionB, sizeof(Vec3d)) == 0;
+}
+
+// body vs body collision with every pair tested, and with the broadphase
+void Bench_bodyBody() {
+  int c, i, bodiesCount, same;
+  int counts[] = {50, 200, 800, 3200};
+  PhysBody* allPairsBodies;
+  PhysBody* broadphaseBodies;
+  PhysWorld allPairsWorld, broadphaseWorld;
+  PhysBroadphase broadphase;
+  double allPairsTimeMS, broadphaseTimeMS;
+
+  printf("body vs body: %d steps per case\n", BENCH_CROWD_STEPS);
+  for (c = 0; c < (int)(sizeof(counts) / sizeof(int)); c++) {
+    bodiesCount = counts[c];
+    allPairsBodies = (PhysBody*)malloc(bodiesCount * sizeof(PhysBody));
+    broadphaseBodies = (PhysBody*)malloc(bodiesCount * sizeof(PhysBody));
+    invariant(allPairsBodies && broadphaseBodies);
+    PhysBroadphase_init(&broadphase, bodiesCount);
+
+    Bench_crowdBodies(allPairsBodies, &allPairsWorld, bodiesCount);
+    Bench_crowdBodies(broadphaseBodies, &broadphaseWorld, bodiesCount);
+    Bench_crowdSteps(allPairsBodies, bodiesCount, NULL, &allPairsTimeMS);
+    Bench_crowdSteps(broadphaseBodies, bodiesCount, &broadphase,
+                     &broadphaseTimeMS);
+
+    same = TRUE;
+    for (i = 0; i < bodiesCount; i++) {
+      if (!Bench_samePosition(allPairsBodies + i, broadphaseBodies + i)) {
+        same = FALSE;
+      }
+    }
+    printf(
+        "%5d bodies  all pairs: %9.1f us/step  broadphase: %7.1f us/step  "
+        "%s\n",
+        bodiesCount, allPairsTimeMS * 1000.0 / BENCH_CROWD_STEPS,
+        broadphaseTimeMS * 1000.0 / BENCH_CROWD_STEPS,
+        same ? "results match" : "RESULTS DIFFER");
+
+    free(broadphase.buckets);
+    PhysWorld_destroy(&allPairsWorld);
+    PhysWorld_destroy(&broadphaseWorld);
+    free(allPairsBodies);
+    free(broadphaseBodies);
+  }
+}
+
+// whether two runs simulated the bodies the same way. only compares what the
+// simulation changes, as other fields (and padding) aren't always initialized
+int Bench_sameBodies(PhysBody* a, PhysBody* b, int bodiesCount) {
+  int i;
+  Vec3d vectorA, vectorB;
+
+  for (i = 0; i < bodiesCount; i++, a++, b++) {
+    if (!Bench_samePosition(a, b) ||
+        PhysBody_isSleeping(a) != PhysBody_isSleeping(b) ||
+        a->stillSteps != b->stillSteps) {
+      return FALSE;
+    }
+    PhysBody_getVelocity(a, &vectorA);
+    PhysBody_getVelocity(b, &vectorB);
+    if (memcmp(&vectorA, &vectorB, sizeof(Vec3d))) {
+      return FALSE;
+    }
+    PhysBody_getAcceleration(a, &vectorA);
+    PhysBody_getAcceleration(b, &vectorB);
+    if (memcmp(&vectorA, &vectorB, sizeof(Vec3d))) {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+// PhysBody as it was before its motion state moved into PhysWorld arrays, a
+// record for each body with the vectors inside it, for comparison
+typedef struct BenchRecordBody {
+  int id;
+  float mass;
+  float massInverse;
+  float radius;
+  float radiusSquared;
+  float restitution;
+  int enabled;
+  int controlled;
+  int sleeping;
+  int stillSteps;
+  Vec3d sleepPosition;
+  int moved;
+  Vec3d prevPosition;
+  Vec3d position;
+  Vec3d prevStepPosition;
+  Vec3d velocity;
+  Vec3d nonIntegralVelocity;
+  Vec3d acceleration;
+  Vec3d nonIntegralAcceleration;
+  Vec3d prevAcceleration;
+  CollisionCandidateCache worldCandidates;
+} BenchRecordBody;
+
+void Bench_recordBodies(BenchRecordBody* records,
+                        PhysBody* bodies,
+                        int bodiesCount) {
+  int i;
+  PhysBody* body;
+  BenchRecordBody* record;
+
+  memset(records, 0, bodiesCount * sizeof(BenchRecordBody));
+  for (i = 0, body = bodies, record = records; i < bodiesCount;
+       i++, body++, record++) {
+    record->mass = body->world->mass[body->index];
+    record->massInverse = body->world->massInverse[body->index];
+    record->radius = PhysBody_getRadius(body);
+    record->enabled = PhysBody_isEnabled(body);
+    record->sleeping = PhysBody_isSleeping(body);
+    PhysBody_getPosition(body, &record->position);
+    PhysBody_getPrevPosition(body, &record->prevPosition);
+    PhysBody_getVelocity(body, &record->velocity);
+    PhysBody_getNonIntegralVelocity(body, &record->nonIntegralVelocity);
+    PhysBody_getAcceleration(body, &record->acceleration);
+  }
+}
+
+// the one pass integration loop as it was for records
+void Bench_integrateRecords(BenchRecordBody* bodies,
+                            int numBodies,
+                            float dt,
+                            float drag,
+                            PhysWorldData* worldData) {
+  BenchRecordBody* body;
+  int i;
+  float gravityForce;
+  float accelerationX, accelerationY, accelerationZ;
+
+  for (i = 0, body = bodies; i < numBodies; i++, body++) {
+    if (!body->enabled || body->sleeping) {
+      continue;
+    }
+    gravityForce = worldData->gravity * body->mass;
+    body->acceleration.y += gravityForce;
+    if (body->position.y < worldData->waterHeight) {
+      body->position.y = worldData->waterHeight;
+      body->acceleration.y += -gravityForce;
+    }
+
+    accelerationX = body->acceleration.x * body->massInverse;
+    accelerationY = body->acceleration.y * body->massInverse;
+    accelerationZ = body->acceleration.z * body->massInverse;
+    Vec3d_init(&body->nonIntegralAcceleration, accelerationX, accelerationY,
+               accelerationZ);
+
+    accelerationX *= dt;
+    accelerationY *= dt;
+    accelerationZ *= dt;
+    body->nonIntegralVelocity.x += accelerationX;
+    body->nonIntegralVelocity.y += accelerationY;
+    body->nonIntegralVelocity.z += accelerationZ;
+
+    body->velocity.x = body->nonIntegralVelocity.x * dt * drag;
+    body->velocity.y = body->nonIntegralVelocity.y * dt * drag;
+    body->velocity.z = body->nonIntegralVelocity.z * dt * drag;
+    body->prevPosition = body->position;
+    body->position.x += body->velocity.x;
+    body->position.y += body->velocity.y;
+    body->position.z += body->velocity.z;
+
+    Vec3d_init(&body->prevAcceleration, accelerationX, accelerationY,
+               accelerationZ);
+    Vec3d_origin(&body->acceleration);
+  }
+}
+
+int Bench_sameAsRecords(PhysBody* bodies,
+                        BenchRecordBody* records,
+                        int bodiesCount) {
+  int i;
+  Vec3d position, velocity, acceleration;
+
+  for (i = 0; i < bodiesCount; i++) {
+    PhysBody_getPosition(bodies + i, &position);
+    PhysBody_getVelocity(bodies + i, &velocity);
+    PhysBody_getAcceleration(bodies + i, &acceleration);
+    if (memcmp(&position, &records[i].position, sizeof(Vec3d)) ||
+        memcmp(&velocity, &records[i].velocity, sizeof(Vec3d)) ||
+        memcmp(&acceleration, &records[i].acceleration, sizeof(Vec3d))) {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+// motion integration of the same bodies: with a pass for forces and another
+// calling the Vec3d functions for each body through the PhysBody functions,
+// like PhysState_step() used to; with one pass over a record for each body,
+// as PhysBody was before the PhysWorld arrays; and with the vectorized pass
+// over the PhysWorld arrays, PhysBody_integrateBodiesSemiImplicitEuler()
+void Bench_integrate() {
+  int c, i, step, bodiesCount, same;
+  int counts[] = {200, 3200, 51200};
+  PhysBody* twoPassBodies;
+  PhysBody* arraysBodies;
+  PhysWorld twoPassWorld, arraysWorld;
+  BenchRecordBody* records;
+  PhysState physics;
+  PhysWorldData worldData;
+  double startTime, twoPassTimeMS, recordsTimeMS, arraysTimeMS;
+  float dt = 1.0f / 60.0f;
+  float drag = 0.9f;
+
+  // the water is high enough to hold some of the bodies up
+  memset(&worldData, 0, sizeof(PhysWorldData));
+  worldData.gravity = -9.8f;
+  worldData.waterHeight = -100.0f;
+  memset(&physics, 0, sizeof(PhysState));
+  physics.worldData = &worldData;
+
+  printf("integration: %d steps per case, us/step\n", BENCH_INTEGRATE_STEPS);
+  for (c = 0; c < (int)(sizeof(counts) / sizeof(int)); c++) {
+    bodiesCount = counts[c];
+    twoPassBodies = (PhysBody*)malloc(bodiesCount * sizeof(PhysBody));
+    arraysBodies = (PhysBody*)malloc(bodiesCount * sizeof(PhysBody));
+    records =
+        (BenchRecordBody*)malloc(bodiesCount * sizeof(BenchRecordBody));
+    invariant(twoPassBodies && arraysBodies && records);
+    Bench_crowdBodies(twoPassBodies, &twoPassWorld, bodiesCount);
+    Bench_crowdBodies(arraysBodies, &arraysWorld, bodiesCount);
+    Bench_recordBodies(records, arraysBodies, bodiesCount);
+
+    startTime = Bench_nowMS();
+    for (step = 0; step < BENCH_INTEGRATE_STEPS; step++) {
+      for (i = 0; i < bodiesCount; i++) {
+        if (PhysBody_isEnabled(twoPassBodies + i) &&
+            !PhysBody_isSleeping(twoPassBodies + i)) {
+          PhysBody_update(twoPassBodies + i, dt, drag, twoPassBodies,
+                          bodiesCount, &physics);
+        }
+      }
+      for (i = 0; i < bodiesCount; i++) {
+        if (PhysBody_isEnabled(twoPassBodies + i) &&
+            !PhysBody_isSleeping(twoPassBodies + i)) {
+          PhysBody_integrateMotionSemiImplicitEuler(twoPassBodies + i, dt,
+                                                    drag);
+        }
+      }
+    }
+    twoPassTimeMS = Bench_nowMS() - startTime;
+
+    startTime = Bench_nowMS();
+    for (step = 0; step < BENCH_INTEGRATE_STEPS; step++) {
+      Bench_integrateRecords(records, bodiesCount, dt, drag, &worldData);
+    }
+    recordsTimeMS = Bench_nowMS() - startTime;
+
+    startTime = Bench_nowMS();
+    for (step = 0; step < BENCH_INTEGRATE_STEPS; step++) {
+      PhysBody_integrateBodiesSemiImplicitEuler(arraysBodies, bodiesCount, dt,
+                                                drag, &physics);
+    }
+    arraysTimeMS = Bench_nowMS() - startTime;
+
+    same = Bench_sameBodies(twoPassBodies, arraysBodies, bodiesCount) &&
+           Bench_sameAsRecords(arraysBodies, records, bodiesCount);
+    printf(
+        "%6d bodies  per body: %8.1f  records: %8.1f  arrays: %8.1f  %s\n",
+        bodiesCount, twoPassTimeMS * 1000.0 / BENCH_INTEGRATE_STEPS,
+        recordsTimeMS * 1000.0 / BENCH_INTEGRATE_STEPS,
+        arraysTimeMS * 1000.0 / BENCH_INTEGRATE_STEPS,
+        same ? "results match" : "RESULTS DIFFER");
+
+    PhysWorld_destroy(&twoPassWorld);
+    PhysWorld_destroy(&arraysWorld);
+    free(twoPassBodies);
+    free(arraysBodies);
+    free(records);
+  }
+}
+
+// bodies dropped onto the garden map, with the world collision response split
+// between threadsCount threads, or done on this thread if threadsCount is 0.
+// the bodies are added to world, which the caller destroys
+void Bench_threadsCase(PhysWorldData* worldData,
+                       int threadsCount,
+                       PhysBody* bodies,
+                       PhysWorld* world,
+                       double* resultTimeMS) {
+  int i, step;
+  double startTime;
+  AABB bounds;
+  Vec3d pos;
+  PhysState physics;
+
+  PhysState_init(&physics, worldData);
+  physics.dynamicTimestep = FALSE;
+  PhysBroadphase_init(&physics.broadphase, BENCH_THREADS_BODIES);
+  if (threadsCount) {
+    PhysState_startWorkers(&physics, threadsCount);
+  }
+
+  Bench_meshBounds(garden_map_collision_collision_mesh,
+                   GARDEN_MAP_COLLISION_LENGTH, &bounds);
+  bounds.max.y = MIN(bounds.max.y, bounds.min.y + 200.0f);
+  benchRandState = 4;
+  PhysWorld_init(world, BENCH_THREADS_BODIES);
+  for (i = 0; i < BENCH_THREADS_BODIES; i++) {
+    Bench_randomPointInAABB(&bounds, &pos);
+    PhysBody_init(bodies + i, world, 10.0f + Bench_randFloat() * 40.0f,
+                  10.0f + Bench_randFloat() * 20.0f, &pos, i);
+  }
+
+  startTime = Bench_nowMS();
+  for (step = 0; step < BENCH_THREADS_STEPS; step++) {
+    PhysState_step(&physics, bodies, BENCH_THREADS_BODIES,
+                   (step + 1) * 16.667f);
+  }
+  *resultTimeMS = Bench_nowMS() - startTime;
+
+  PhysState_stopWorkers(&physics);
+  free(physics.broadphase.buckets);
+}
+
+void Bench_threads() {
+  int t, same;
+  int threadsCounts[] = {1, 2, 4, 8};
+  PhysBody* serialBodies;
+  PhysBody* threadedBodies;
+  PhysWorld serialWorld, threadedWorld;
+  double serialTimeMS, threadedTimeMS;
+  PhysWorldData worldData;
+
+  worldData.worldMesh = &garden_map_collision_collision_mesh_baked;
+  worldData.worldMeshSpatialHash = &garden_map_collision_collision_mesh_hash;
+  worldData.worldMeshBVH = NULL;
+  worldData.gravity = -9.8f * N64_SCALE_FACTOR;
+  worldData.viscosity = 0.05f;
+  worldData.waterHeight = -100000.0f;
+
+  serialBodies = (PhysBody*)malloc(BENCH_THREADS_BODIES * sizeof(PhysBody));
+  threadedBodies = (PhysBody*)malloc(BENCH_THREADS_BODIES * sizeof(PhysBody));
+  invariant(serialBodies && threadedBodies);
+
+  printf("world collision threads: %d bodies, %d steps\n",
+         BENCH_THREADS_BODIES, BENCH_THREADS_STEPS);
+  Bench_threadsCase(&worldData, 0, serialBodies, &serialWorld, &serialTimeMS);
+  printf("   no workers: %8.2f ms\n", serialTimeMS);
+  for (t = 0; t < (int)(sizeof(threadsCounts) / sizeof(int)); t++) {
+    Bench_threadsCase(&worldData, threadsCounts[t], threadedBodies,
+                      &threadedWorld, &threadedTimeMS);
+    same = Bench_sameBodies(serialBodies, threadedBodies,
+                            BENCH_THREADS_BODIES);
+    printf("%2d thread(s): %8.2f ms  %s\n", threadsCounts[t], threadedTimeMS,
+           same ? "results match" : "RESULTS DIFFER");
+    PhysWorld_destroy(&threadedWorld);
+  }
+
+  PhysWorld_destroy(&serialWorld);
+  free(serialBodies);
+  free(threadedBodies);
+}
+
+// bodies thrown at a wall with no thickness, counting how many end up on the
+// other side of it
+void Bench_wallCase(PhysWorldData* worldData,
+                    int continuousCollision,
+                    float timeScale,
+                    float speed,
+                    int* resultTunnelled,
+                    double* resultTimeMS) {
+  int i, step;
+  double startTime;
+  Vec3d pos, velocity;
+  PhysState physics;
+  PhysBody* bodies;
+  PhysWorld world;
+
+  bodies = (PhysBody*)malloc(BENCH_WALL_BODIES * sizeof(PhysBody));
+  invariant(bodies);
+  PhysWorld_init(&world, BENCH_WALL_BODIES);
+  PhysState_init(&physics, worldData);
+  physics.dynamicTimestep = FALSE;
+  physics.timeScale = timeScale;
+  physics.continuousCollision = continuousCollision;
+  PhysBroadphase_init(&physics.broadphase, BENCH_WALL_BODIES);
+  benchRandState = 3;
+  for (i = 0; i < BENCH_WALL_BODIES; i++) {
+    Vec3d_init(&pos, -200.0f - Bench_randFloat() * 400.0f,
+               (Bench_randFloat() - 0.5f) * BENCH_WALL_SIZE,
+               (Bench_randFloat() - 0.5f) * BENCH_WALL_SIZE);
+    PhysBody_init(bodies + i, &world, 10.0f, 10.0f, &pos, i);
+    Vec3d_init(&velocity, speed, 0.0f, 0.0f);
+    PhysBody_setNonIntegralVelocity(bodies + i, &velocity);
+  }
+
+  startTime = Bench_nowMS();
+  for (step = 0; step < BENCH_WALL_STEPS; step++) {
+    PhysState_step(&physics, bodies, BENCH_WALL_BODIES,
+                   (step + 1) * 16.667f * timeScale);
+  }
+  *resultTimeMS = Bench_nowMS() - startTime;
+  free(physics.broadphase.buckets);
+
+  *resultTunnelled = 0;
+  for (i = 0; i < BENCH_WALL_BODIES; i++) {
+    PhysBody_getPosition(bodies + i, &pos);
+    if (pos.x > 0.0f) {
+      (*resultTunnelled)++;
+    }
+  }
+  PhysWorld_destroy(&world);
+  free(bodies);
+}
+
+void Bench_continuousCollision() {
+  int i, discreteTunnelled, continuousTunnelled;
+  double discreteTimeMS, continuousTimeMS;
+  Triangle wall[2];
+  CollisionMeshTriangle wallData[2];
+  CollisionMesh wallMesh;
+  SpatialHash wallHash;
+  SpatialHashQueryContext wallHashQueryContext;
+  PhysWorldData worldData;
+  float speeds[] = {300.0f, 1200.0f, 3000.0f};
+  float timeScales[] = {1.0f, 2.0f};
+
+  // a square wall on the x = 0 plane, facing the bodies coming from -x
+  Vec3d_init(&wall[0].a, 0.0f, -BENCH_WALL_SIZE, -BENCH_WALL_SIZE);
+  Vec3d_init(&wall[0].b, 0.0f, -BENCH_WALL_SIZE, BENCH_WALL_SIZE);
+  Vec3d_init(&wall[0].c, 0.0f, BENCH_WALL_SIZE, -BENCH_WALL_SIZE);
+  Vec3d_init(&wall[1].a, 0.0f, BENCH_WALL_SIZE, -BENCH_WALL_SIZE);
+  Vec3d_init(&wall[1].b, 0.0f, -BENCH_WALL_SIZE, BENCH_WALL_SIZE);
+  Vec3d_init(&wall[1].c, 0.0f, BENCH_WALL_SIZE, BENCH_WALL_SIZE);
+  memset(&wallMesh, 0, sizeof(CollisionMesh));
+  wallMesh.triangles = wall;
+  wallMesh.trianglesLength = 2;
+  wallMesh.triangleData = wallData;
+  CollisionMesh_build(&wallMesh);
+  Bench_buildSpatialHash(wall, 2, 120.0f, 64, &wallHash,
+                         &wallHashQueryContext);
+
+  worldData.worldMesh = &wallMesh;
+  worldData.worldMeshSpatialHash = &wallHash;
+  worldData.worldMeshBVH = NULL;
+  worldData.gravity = 0.0f;
+  worldData.viscosity = 0.0f;
+  worldData.waterHeight = -100000.0f;
+
+  printf("continuous collision: %d bodies of radius 10 thrown at a wall, %d "
+         "steps\n",
+         BENCH_WALL_BODIES, BENCH_WALL_STEPS);
+  for (i = 0; i < (int)(sizeof(speeds) / sizeof(float)) * 2; i++) {
+    Bench_wallCase(&worldData, FALSE, timeScales[i % 2], speeds[i / 2],
+                   &discreteTunnelled, &discreteTimeMS);
+    Bench_wallCase(&worldData, TRUE, timeScales[i % 2], speeds[i / 2],
+                   &continuousTunnelled, &continuousTimeMS);
+    printf(
+        "speed %4.0f at %2.0fHz  discrete: %4d tunnelled %6.2f ms  "
+        "continuous: %4d tunnelled %6.2f ms\n",
+        speeds[i / 2], 60.0f / timeScales[i % 2], discreteTunnelled,
+        discreteTimeMS, continuousTunnelled, continuousTimeMS);
+  }
+
+  Bench_freeSpatialHash(&wallHash);
+#if COLLISION_SIMD_ENABLED
+  if (wallMesh.soa) {
+    free(wallMesh.soa->aabbMinX);
+    free(wallMesh.soa);
+  }
+#endif
+}
+
+// a grid of nodes with edges to the 4 nodes around them, except for some
+// blocked nodes which have no edges, so searches have to go around them
+void Bench_buildGridGraph(Graph* graph, int side) {
+  int x, z, i, blocked;
+  int* edgeElements;
+  char* blockedNodes;
+  EdgeList* edgeList;
+
+  graph->size = side * side;
+  graph->nextHops = NULL;
+  graph->nodes = (Node*)malloc(graph->size * sizeof(Node));
+  graph->edges = (EdgeList*)malloc(graph->size * sizeof(EdgeList));
+  edgeElements = (int*)malloc(graph->size * 4 * sizeof(int));
+  blockedNodes = (char*)malloc(graph->size);
+  invariant(graph->nodes && graph->edges && edgeElements && blockedNodes);
+
+  benchRandState = 3;
+  for (z = 0; z < side; z++) {
+    for (x = 0; x < side; x++) {
+      // the searches start and end in the corners, so don't wall them in
+      blocked = (x < 2 || x >= side - 2) && (z < 2 || z >= side - 2);
+      blockedNodes[z * side + x] =
+          !blocked && Bench_randFloat() < BENCH_PATH_BLOCKED_FRACTION;
+    }
+  }
+
+  for (z = 0; z < side; z++) {
+    for (x = 0; x < side; x++) {
+      i = z * side + x;
+      graph->nodes[i].id = i;
+      Vec3d_init(&graph->nodes[i].position, x * BENCH_PATH_NODE_SPACING, 0.0f,
+                 z * BENCH_PATH_NODE_SPACING);
+      edgeList = &graph->edges[i];
+      edgeList->elements = edgeElements + i * 4;
+      edgeList->size = 0;
+      if (blockedNodes[i]) {
+        continue;
+      }
+      blocked = x == 0 || blockedNodes[i - 1];
+      if (!blocked) {
+        edgeList->elements[edgeList->size++] = i - 1;
+      }
+      blocked = x == side - 1 || blockedNodes[i + 1];
+      if (!blocked) {
+        edgeList->elements[edgeList->size++] = i + 1;
+      }
+      blocked = z == 0 || blockedNodes[i - side];
+      if (!blocked) {
+        edgeList->elements[edgeList->size++] = i - side;
+      }
+      blocked = z == side - 1 || blockedNodes[i + side];
+      if (!blocked) {
+        edgeList->elements[edgeList->size++] = i + side;
+      }
+    }
+  }
+  free(blockedNodes);
+}
+
+void Bench_freeGridGraph(Graph* graph) {
+  free(graph->edges[0].elements);
+  free(graph->edges);
+  free(graph->nodes);
+}
+
+// runs searches between opposite corners of the grid, keeping the last result
+void Bench_pathSearches(Graph* graph,
+                        int side,
+                        PathfindingState* state,
+                        NodeState* nodeStates,
+                        int* openList,
+                        int* result,
+                        double* resultTimeMS) {
+  int search, start, end;
+  double startTime;
+
+  startTime = Bench_nowMS();
+  for (search = 0; search < BENCH_PATH_SEARCHES; search++) {
+    if (search % 2 == 0) {
+      start = 0;
+      end = graph->size - 1;
+    } else {
+      start = side - 1;
+      end = graph->size - side;
+    }
+    Path_initState(graph, state, Path_getNodeByID(graph, start),
+                   Path_getNodeByID(graph, end), nodeStates, graph->size,
+                   openList, result);
+    Path_findAStar(graph, state);
+  }
+  *resultTimeMS = Bench_nowMS() - startTime;
+}
+
+// A* with the open node with the smallest cost found by scanning every node
+// state, and with the open list binary heap
+void Bench_pathfinding() {
+  int c, i, side, same;
+  int sides[] = {32, 64, 128, 224};
+  Graph graph;
+  PathfindingState scanState, heapState;
+  NodeState* nodeStates;
+  int* openList;
+  int* scanResult;
+  int* heapResult;
+  double scanTimeMS, heapTimeMS;
+
+  printf("pathfinding: %d searches per case, %.0f%% of nodes blocked\n",
+         BENCH_PATH_SEARCHES, BENCH_PATH_BLOCKED_FRACTION * 100.0f);
+  for (c = 0; c < (int)(sizeof(sides) / sizeof(int)); c++) {
+    side = sides[c];
+    Bench_buildGridGraph(&graph, side);
+    nodeStates = (NodeState*)malloc(graph.size * sizeof(NodeState));
+    openList = (int*)malloc(graph.size * sizeof(int));
+    scanResult = (int*)malloc(graph.size * sizeof(int));
+    heapResult = (int*)malloc(graph.size * sizeof(int));
+    invariant(nodeStates && openList && scanResult && heapResult);
+
+    Bench_pathSearches(&graph, side, &scanState, nodeStates, NULL, scanResult,
+                       &scanTimeMS);
+    Bench_pathSearches(&graph, side, &heapState, nodeStates, openList,
+                       heapResult, &heapTimeMS);
+
+    same = scanState.resultSize == heapState.resultSize;
+    for (i = 0; same && i < scanState.resultSize; i++) {
+      same = scanResult[i] == heapResult[i];
+    }
+    printf(
+        "%6d nodes  scan: %9.3f ms/search  heap: %7.3f ms/search  "
+        "path %d nodes  %s\n",
+        graph.size, scanTimeMS / BENCH_PATH_SEARCHES,
+        heapTimeMS / BENCH_PATH_SEARCHES, heapState.resultSize,
+        same ? "results match" : "RESULTS DIFFER");
+
+    free(nodeStates);
+    free(openList);
+    free(scanResult);
+    free(heapResult);
+    Bench_freeGridGraph(&graph);
+  }
+}
+
+float Bench_pathCost(Graph* graph, PathfindingState* state) {
+  int i;
+  float cost;
+
+  cost = 0.0f;
+  for (i = 1; i < state->resultSize; i++) {
+    cost += Vec3d_distanceTo(
+        &Path_getNodeByID(graph, state->result[i - 1])->position,
+        &Path_getNodeByID(graph, state->result[i])->position);
+  }
+  return cost;
+}
+
+// searches between every pair of connected nodes in small graphs with A* and
+// by following a next hop table
+void Bench_nextHops() {
+  int c, from, to, side, same, searches;
+  int sides[] = {4, 6, 8};
+  Graph graph;
+  PathfindingState state;
+  NodeState* nodeStates;
+  int* openList;
+  int* result;
+  float* costs;
+  float* aStarCosts;
+  unsigned char* nextHops;
+  double startTime, aStarTimeMS, nextHopsTimeMS;
+
+  printf("next hops: searches between every pair of connected nodes\n");
+  for (c = 0; c < (int)(sizeof(sides) / sizeof(int)); c++) {
+    side = sides[c];
+    Bench_buildGridGraph(&graph, side);
+    nodeStates = (NodeState*)malloc(graph.size * sizeof(NodeState));
+    openList = (int*)malloc(graph.size * sizeof(int));
+    result = (int*)malloc(graph.size * sizeof(int));
+    costs = (float*)malloc(graph.size * graph.size * sizeof(float));
+    aStarCosts = (float*)malloc(graph.size * graph.size * sizeof(float));
+    nextHops = (unsigned char*)malloc(graph.size * graph.size);
+    invariant(nodeStates && openList && result && costs && aStarCosts &&
+              nextHops);
+    Path_buildNextHopTable(&graph, costs, nextHops);
+
+    searches = 0;
+    startTime = Bench_nowMS();
+    for (from = 0; from < graph.size; from++) {
+      for (to = 0; to < graph.size; to++) {
+        if (nextHops[from * graph.size + to] == PATH_NO_NEXT_HOP) {
+          continue;
+        }
+        searches++;
+        Path_initState(&graph, &state, Path_getNodeByID(&graph, from),
+                       Path_getNodeByID(&graph, to), nodeStates, graph.size,
+                       openList, result);
+        aStarCosts[from * graph.size + to] =
+            Path_findAStar(&graph, &state) ? Bench_pathCost(&graph, &state)
+                                           : -1.0f;
+      }
+    }
+    aStarTimeMS = Bench_nowMS() - startTime;
+
+    graph.nextHops = nextHops;
+    same = TRUE;
+    startTime = Bench_nowMS();
+    for (from = 0; from < graph.size; from++) {
+      for (to = 0; to < graph.size; to++) {
+        if (nextHops[from * graph.size + to] == PATH_NO_NEXT_HOP) {
+          continue;
+        }
+        Path_initState(&graph, &state, Path_getNodeByID(&graph, from),
+                       Path_getNodeByID(&graph, to), nodeStates, graph.size,
+                       openList, result);
+        if ((Path_findAStar(&graph, &state) ? Bench_pathCost(&graph, &state)
+                                            : -1.0f) !=
+            aStarCosts[from * graph.size + to]) {
+          same = FALSE;
+        }
+      }
+    }
+    nextHopsTimeMS = Bench_nowMS() - startTime;
+    printf(
+        "%3d nodes  A*: %7.3f us/search  next hops: %7.3f us/search  "
+        "%d bytes  %s\n",
+        graph.size, aStarTimeMS * 1000.0 / searches,
+        nextHopsTimeMS * 1000.0 / searches,
+        graph.size * graph.size,
+        same ? "path costs match" : "PATH COSTS DIFFER");
+
+    free(nodeStates);
+    free(openList);
+    free(result);
+    free(costs);
+    free(aStarCosts);
+    free(nextHops);
+    Bench_freeGridGraph(&graph);
+  }
+}
+
+// finding the closest node to random positions by measuring the distance to
+// every node, and with the PathNodeGrid
+void Bench_quantize() {
+  int c, i, side, same;
+  int sides[] = {6, 32, 64, 128, 224};
+  Graph graph;
+  PathNodeGrid grid;
+  Vec3d* positions;
+  int* scanResults;
+  int* gridResults;
+  float extent;
+  double startTime, scanTimeMS, gridTimeMS;
+
+  printf("quantize: %d positions per case\n", BENCH_QUANTIZE_QUERIES);
+  positions = (Vec3d*)malloc(BENCH_QUANTIZE_QUERIES * sizeof(Vec3d));
+  scanResults = (int*)malloc(BENCH_QUANTIZE_QUERIES * sizeof(int));
+  gridResults = (int*)malloc(BENCH_QUANTIZE_QUERIES * sizeof(int));
+  invariant(positions && scanResults && gridResults);
+  for (c = 0; c < (int)(sizeof(sides) / sizeof(int)); c++) {
+    side = sides[c];
+    Bench_buildGridGraph(&graph, side);
+    PathNodeGrid_init(&grid, &graph);
+    // a little outside the graph too
+    extent = side * BENCH_PATH_NODE_SPACING;
+    benchRandState = 4;
+    for (i = 0; i < BENCH_QUANTIZE_QUERIES; i++) {
+      Vec3d_init(&positions[i], (Bench_randFloat() * 1.2f - 0.1f) * extent,
+                 Bench_randFloat() * 20.0f,
+                 (Bench_randFloat() * 1.2f - 0.1f) * extent);
+    }
+
+    startTime = Bench_nowMS();
+    for (i = 0; i < BENCH_QUANTIZE_QUERIES; i++) {
+      scanResults[i] = Path_quantizePosition(&graph, &positions[i]);
+    }
+    scanTimeMS = Bench_nowMS() - startTime;
+
+    startTime = Bench_nowMS();
+    for (i = 0; i < BENCH_QUANTIZE_QUERIES; i++) {
+      gridResults[i] = PathNodeGrid_quantizePosition(&grid, &positions[i]);
+    }
+    gridTimeMS = Bench_nowMS() - startTime;
+
+    same = memcmp(scanResults, gridResults,
+                  BENCH_QUANTIZE_QUERIES * sizeof(int)) == 0;
+    printf(
+        "%6d nodes  scan: %9.3f us/query  grid: %6.3f us/query  %s\n",
+        graph.size, scanTimeMS * 1000.0 / BENCH_QUANTIZE_QUERIES,
+        gridTimeMS * 1000.0 / BENCH_QUANTIZE_QUERIES,
+        same ? "results match" : "RESULTS DIFFER");
+
+    PathNodeGrid_destroy(&grid);
+    Bench_freeGridGraph(&graph);
+  }
+  free(positions);
+  free(scanResults);
+  free(gridResults);
+}
+
+// a search across the grid done in one go, and then a few nodes at a time, to
+// see how long the longest slice takes compared to the whole search
+void Bench_pathSlices() {
+  int c, i, side, same, slices, end;
+  int sides[] = {32, 64, 128, 224};
+  Graph graph;
+  PathfindingState wholeState, slicedState;
+  NodeState* nodeStates;
+  int* openList;
+  int* wholeResult;
+  int* slicedResult;
+  PathSearchStatus status;
+  double startTime, sliceTimeMS, wholeTimeMS, maxSliceTimeMS;
+
+  printf("path slices: searches expanding up to %d nodes per slice\n",
+         BENCH_PATH_SLICE_EXPANSIONS);
+  for (c = 0; c < (int)(sizeof(sides) / sizeof(int)); c++) {
+    side = sides[c];
+    end = side * side - 1;
+    Bench_buildGridGraph(&graph, side);
+    nodeStates = (NodeState*)malloc(graph.size * sizeof(NodeState));
+    openList = (int*)malloc(graph.size * sizeof(int));
+    wholeResult = (int*)malloc(graph.size * sizeof(int));
+    slicedResult = (int*)malloc(graph.size * sizeof(int));
+    invariant(nodeStates && openList && wholeResult && slicedResult);
+
+    Path_initState(&graph, &wholeState, Path_getNodeByID(&graph, 0),
+                   Path_getNodeByID(&graph, end), nodeStates, graph.size,
+                   openList, wholeResult);
+    startTime = Bench_nowMS();
+    Path_findAStar(&graph, &wholeState);
+    wholeTimeMS = Bench_nowMS() - startTime;
+
+    Path_initState(&graph, &slicedState, Path_getNodeByID(&graph, 0),
+                   Path_getNodeByID(&graph, end), nodeStates, graph.size,
+                   openList, slicedResult);
+    Path_startAStar(&graph, &slicedState);
+    slices = 0;
+    maxSliceTimeMS = 0.0;
+    do {
+      startTime = Bench_nowMS();
+      status = Path_continueAStar(&graph, &slicedState,
+                                  BENCH_PATH_SLICE_EXPANSIONS);
+      sliceTimeMS = Bench_nowMS() - startTime;
+      if (sliceTimeMS > maxSliceTimeMS) {
+        maxSliceTimeMS = sliceTimeMS;
+      }
+      slices++;
+    } while (status == PathSearchInProgress);
+
+    same = wholeState.resultSize == slicedState.resultSize;
+    for (i = 0; same && i < wholeState.resultSize; i++) {
+      same = wholeResult[i] == slicedResult[i];
+    }
+    printf(
+        "%6d nodes  whole: %7.3f ms  %5d slices, longest %6.3f ms  "
+        "%d nodes expanded  %s\n",
+        graph.size, wholeTimeMS, slices, maxSliceTimeMS,
+        slicedState.expanded, same ? "results match" : "RESULTS DIFFER");
+
+    free(nodeStates);
+    free(openList);
+    free(wholeResult);
+    free(slicedResult);
+    Bench_freeGridGraph(&graph);
+  }
+}
+
+static Benchmark benchmarks[] = {
+    {"spatialhash", Bench_spatialHashDedup},
+    {"hashfile", Bench_spatialHashFile},
+#if COLLISION_SIMD_ENABLED
+    {"meshsphere", Bench_meshSphereSIMD},
+#endif
+    {"bvh", Bench_bvh},
+    {"bodybody", Bench_bodyBody},
+    {"ccd", Bench_continuousCollision},
+    {"integrate", Bench_integrate},
+    {"threads", Bench_threads},
+    {"pathfinding", Bench_pathfinding},
+    {"nexthops", Bench_nextHops},
+    {"quantize", Bench_quantize},
+    {"pathslices", Bench_pathSlices},
+};
+
+int main(int argc, char** argv) {
+  int i, ran;
+  ran = 0;
+  for (i = 0; i < (int)(sizeof(benchmarks) / sizeof(Benchmark)); i++) {
+    if (argc < 2 || strcmp(argv[1], benchmarks[i].name) == 0) {
+      benchmarks[i].run();
+      ran++;
+    }
+  }
+  if (!ran) {
+    printf("unknown benchmark: %s\n", argv[1]);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,10 @@
+#!/bin/bash
+set -eu
+
+# builds and runs the native benchmarks in bench.c
+# usage: ./benchbuild.sh [benchmark name]
+
+BENCH_SOURCE_FILES="bench.c collision.c vec3d.c compat.c trace.c physics.c pathfinding.c garden_map_collision.c"
+
+cc $BENCH_SOURCE_FILES -std=gnu90 -O2 -Wall -Wno-comment -lm -lpthread -o bench
+./bench "$@"
@@ -1,10 +1,10 @@
+#include <assert.h>
 #include <math.h>
 
 #include "character.h"
 #include "game.h"
 #include "item.h"
 #include "modeltype.h"
-#include "trace.h"
 #include "vec2d.h"
 #include "vec3d.h"
 
@@ -44,6 +44,9 @@
 #define CHARACTER_SPEED_MULTIPLIER_WALK 0.5
 #define CHARACTER_TARGET_PATH_PARAM 0
 #define DEBUG_CHARACTER_PATH_SMOOTHING 0
+// skip path nodes which the character, or its target, can't reach in a
+// straight line when choosing where paths start and end
+#define CHARACTER_UNOBSTRUCTED_PATH_NODES 0
 
 static Vec3d characterItemOffset = {0.0F, 60.0F, 0.0F};
 
@@ -56,13 +59,13 @@ void Character_print(Character* self) {
                           : "none");
 }
 
-void Character_toString(Character* self, char* buffer) {
+void Character_toString(Character* self, char* buffer, Game* game) {
   char pos[60];
   char rot[60];
   float angleToPlayer;
 
   angleToPlayer =
-      Character_topDownAngleMagToObj(self, Game_get()->player.goose);
+      Character_topDownAngleMagToObj(self, game->player.goose);
 
   Vec3d_toString(&self->obj->position, pos);
   Vec3d_toString((Vec3d*)&self->obj->rotation, rot);
@@ -110,6 +113,18 @@ void Character_init(Character* self,
   self->startedActivityTick = 0;
 
   self->pathfindingResult = NULL;
+  // the result array is provided by Game_initPathfinding()
+  self->path.start = NULL;
+  self->path.end = NULL;
+  self->path.nodeStates = NULL;
+  self->path.nodeStateSize = 0;
+  self->path.open = 0;
+  self->path.openList = NULL;
+  self->path.result = NULL;
+  self->path.resultSize = 0;
+  self->path.expanded = 0;
+  Vec3d_origin(&self->quantizedTarget);
+  self->quantizedTargetNode = -1;
 
   self->pathProgress = 0;
   self->pathSegmentProgress = 0.0f;
@@ -159,42 +174,15 @@ int Character_posIsInViewArc(Character* self, Vec3d* position) {
 }
 
 int Character_canSeeItem(Character* self, Item* item, Game* game) {
-  GameObject visibilityCheckObjects[MAX_WORLD_OBJECTS];
-  int visibilityCheckObjectsCount = 0;
-  int i;
-  Vec3d vecToObject;
-  GameObject* obj;
-
   if (!Character_posIsInViewArc(self, &item->obj->position)) {
     return FALSE;
   }
 
-  // build list of occluding objects for line of sight raycasting
-  for (obj = game->worldObjects, i = 0; i < game->worldObjectsCount;
-       obj++, i++) {
-    // these object types don't occlude
-    // TODO: move this somewhere else
-    switch (obj->modelType) {
-      case UniFloorModel:
-      case UniBldgModel:
-      case FlagpoleModel:
-      case GooseModel:
-        continue;
-      default:
-        break;
-    }
-
-    Vec3d_directionTo(&self->obj->position, &obj->position, &vecToObject);
-
-    visibilityCheckObjects[visibilityCheckObjectsCount] = *obj;
-    visibilityCheckObjectsCount++;
-  }
-
   // check line of sight by raycasting
   return Game_canSeeOtherObject(
-      self->obj, item->obj,
+      game, self->obj, item->obj,
       /*viewer eye pos y offset*/ CHARACTER_EYE_OFFSET_Y,
-      visibilityCheckObjects, visibilityCheckObjectsCount);
+      GameObjectOccluderFlag);
 }
 
 int Character_canSeePlayer(Character* self, Game* game) {
@@ -202,11 +190,11 @@ int Character_canSeePlayer(Character* self, Game* game) {
   if (!Character_posIsInViewArc(self, &game->player.goose->position)) {
     return FALSE;
   }
-  // check line of sight by raycasting
+  // check line of sight by raycasting. anything can hide the goose, not just
+  // occluders
   return Game_canSeeOtherObject(
-      self->obj, game->player.goose,
-      /*viewer eye pos y offset*/ CHARACTER_EYE_OFFSET_Y, game->worldObjects,
-      game->worldObjectsCount);
+      game, self->obj, game->player.goose,
+      /*viewer eye pos y offset*/ CHARACTER_EYE_OFFSET_Y, /*any object*/ 0);
 }
 
 float Character_getDistanceTopDown(Vec3d* from, Vec3d* to) {
@@ -270,7 +258,7 @@ void Character_moveTowards(Character* self,
 
   Vec3d_copyFrom(&movement, &headingDirection);
   Vec3d_mulScalar(&movement, derivedSpeed);
-  Vec3d_add(&self->obj->position, &movement);
+  GameObject_translate(self->obj, &movement);
 }
 
 void Character_setVisibleItemAttachment(Character* self, ModelType modelType) {
@@ -294,9 +282,6 @@ void Character_goToTarget(Character* self,
                           int shouldStopAtTarget) {
   int from;
   int to;
-  float profStartPathfinding;
-  Graph* pathfindingGraph;
-  PathfindingState* pathfindingState;
   Vec3d* nextNodePos;
 #if CHARACTER_TARGET_PATH_PARAM
   Vec3d* pathSegmentP0;
@@ -305,23 +290,21 @@ void Character_goToTarget(Character* self,
   Vec3d movementTarget;
   Vec3d objCenter;
   float objRadius;
-
-  int spatialHashResults[100];
-  int spatialHashResultsCount;
-  int spatialHashMaxResults;
   int pathToNextNodeUnobstructed;
-  int i;
-  AABB triangleAABB;
-
-  spatialHashMaxResults = 100;
 
   Game_getObjCenter(self->obj, &objCenter);
   objRadius = Game_getObjRadius(self->obj);
 
-  pathfindingGraph = game->pathfindingGraph;
-  pathfindingState = game->pathfindingState;
-
-  to = Path_quantizePosition(pathfindingGraph, target);
+  // targets often stay put (eg. the default activity location), so their
+  // closest node is only found again when they move
+  if (self->quantizedTargetNode == -1 || self->quantizedTarget.x != target->x ||
+      self->quantizedTarget.y != target->y ||
+      self->quantizedTarget.z != target->z) {
+    self->quantizedTarget = *target;
+    self->quantizedTargetNode = Game_quantizePosition(
+        game, target, CHARACTER_UNOBSTRUCTED_PATH_NODES);
+  }
+  to = self->quantizedTargetNode;
 
   // check that the goal is still the closest node to the destination
   if (self->pathfindingResult && self->pathfindingResult->end->id != to) {
@@ -331,33 +314,27 @@ void Character_goToTarget(Character* self,
 
   // find a path if we need one
   if (!self->pathfindingResult) {
-    profStartPathfinding = CUR_TIME_MS();
-
-    from = Path_quantizePosition(pathfindingGraph, &self->obj->position);
-
-    Path_initState(pathfindingGraph,                          // graph
-                   pathfindingState,                          // state
-                   Path_getNodeByID(pathfindingGraph, from),  // start
-                   Path_getNodeByID(pathfindingGraph, to),    // end
-                   pathfindingState->nodeStates,     // nodeStates array
-                   pathfindingState->nodeStateSize,  // nodeStateSize
-                   pathfindingState->result          // results array
-    );
-
-    if (Path_findAStar(pathfindingGraph, pathfindingState)) {
-      // pathfinding complete
-      self->pathfindingResult = pathfindingState;
-      self->pathProgress = 0;
-      self->pathSegmentProgress = 0;
-    } else {
-      debugPrintf("character: pathfinding failed\n");
+    from = Game_quantizePosition(game, &self->obj->position,
+                                 CHARACTER_UNOBSTRUCTED_PATH_NODES);
+
+    switch (Game_findPath(game, self, from, to)) {
+      case PathSearchFound:
+        // pathfinding complete
+        self->pathfindingResult = &self->path;
+        self->pathProgress = 0;
+        self->pathSegmentProgress = 0;
+        break;
+      case PathSearchFailed:
+        debugPrintf("character: pathfinding failed\n");
+        break;
+      default:
+        // the search will carry on next tick
+        break;
     }
-
-    Trace_addEvent(PathfindingTraceEvent, profStartPathfinding, CUR_TIME_MS());
   }
 
   if (!self->pathfindingResult) {
-    // no path or at end of path, just head towards target
+    // no path, or still waiting for one, just head towards target
     Character_moveTowards(self, target, speedMultiplier, shouldStopAtTarget);
   } else {
     // path smoothing
@@ -369,7 +346,6 @@ void Character_goToTarget(Character* self,
 #endif
       if (self->pathProgress == self->pathfindingResult->resultSize)
         break;
-      pathToNextNodeUnobstructed = TRUE;
 
       // is cast ray unobstructed from where we are to the n+1 node?
 
@@ -379,33 +355,8 @@ void Character_goToTarget(Character* self,
                      ->position  // path node
               : target;          // final target
 
-      // find triangles to raycast
-      spatialHashResultsCount = SpatialHash_getTrianglesForRaycast(
-          &objCenter, nextNodePos,
-          game->physicsState.worldData->worldMeshSpatialHash,
-          spatialHashResults, spatialHashMaxResults);
-
-      // actually do raycast
-      for (i = 0; i < spatialHashResultsCount; i++) {
-        AABB_fromTriangle(
-            /*tri*/ game->physicsState.worldData->worldMeshTris +
-                spatialHashResults[i],
-            &triangleAABB);
-
-        triangleAABB.min.x -= objRadius;
-        triangleAABB.min.z -= objRadius;
-
-        triangleAABB.max.x += objRadius;
-        triangleAABB.max.z += objRadius;
-        if (Collision_testSegmentAABBCollision(&objCenter, nextNodePos,
-                                               &triangleAABB)) {
-          pathToNextNodeUnobstructed = FALSE;
-#if DEBUG_CHARACTER_PATH_SMOOTHING
-          printf("hit tri %d\n", spatialHashResults[i]);
-#endif
-          break;
-        }
-      }
+      pathToNextNodeUnobstructed = Game_isSegmentUnobstructed(
+          game, &objCenter, nextNodePos, objRadius);
 
       if (pathToNextNodeUnobstructed) {
 #if DEBUG_CHARACTER_PATH_SMOOTHING
@@ -414,12 +365,6 @@ void Character_goToTarget(Character* self,
                Character_getPathNode(self, game, self->pathProgress)->id,
                self->pathfindingResult->resultSize);
 
-        printf("no collision with tris: ");
-        for (i = 0; i < spatialHashResultsCount; i++) {
-          printf("%d, ", spatialHashResults[i]);
-        }
-        printf("\n");
-
         printf(
             "advancing due to no collisions with this segment "
             "pathProgress=%d\n",
@@ -498,7 +443,7 @@ void Character_goToTarget(Character* self,
 }
 
 void Character_update(Character* self, Game* game) {
-  Vec3d startPos;
+  Vec3d startPos, heldItemPosition;
   float startRot;
   float animationMovementSpeed;
   int isTurning;
@@ -508,8 +453,9 @@ void Character_update(Character* self, Game* game) {
   startRot = self->obj->rotation.y;
   if (self->itemHolder.heldItem) {
     // bring item with you
-    self->itemHolder.heldItem->obj->position = self->obj->position;
-    Vec3d_add(&self->itemHolder.heldItem->obj->position, &characterItemOffset);
+    heldItemPosition = self->obj->position;
+    Vec3d_add(&heldItemPosition, &characterItemOffset);
+    GameObject_setPosition(self->itemHolder.heldItem->obj, &heldItemPosition);
   }
 
   // update held item visual attachment
@@ -563,14 +509,16 @@ void Character_update(Character* self, Game* game) {
   }
 }
 
-void Character_transitionToState(Character* self, CharacterState nextState) {
+void Character_transitionToState(Character* self,
+                                 CharacterState nextState,
+                                 Game* game) {
 #ifndef DEBUG_CHARACTER
   if (nextState == SeekingItemState) {
     printf("starting SeekingItemState\n");
   }
   Character_printStateTransition(self, nextState);
 #endif
-  self->enteredStateTick = Game_get()->tick;
+  self->enteredStateTick = game->tick;
   self->state = nextState;
 }
 
@@ -588,7 +536,7 @@ void Character_maybeTransitionToHigherPriorityState(Character* self,
       printf(
           "transitioning to higher priority state: SeekingSoundSourceState\n");
 #endif
-      Character_transitionToState(self, SeekingSoundSourceState);
+      Character_transitionToState(self, SeekingSoundSourceState, game);
       return;
     }
   }
@@ -604,7 +552,7 @@ void Character_maybeTransitionToHigherPriorityState(Character* self,
             "saw stolen item. transitioning to higher priority state: "
             "SeekingItemState\n");
 #endif
-        Character_transitionToState(self, SeekingItemState);
+        Character_transitionToState(self, SeekingItemState, game);
         return;
       }
     }
@@ -612,14 +560,14 @@ void Character_maybeTransitionToHigherPriorityState(Character* self,
 }
 
 void Character_updateIdleState(Character* self, Game* game) {
-  Character_transitionToState(self, DefaultActivityState);
+  Character_transitionToState(self, DefaultActivityState, game);
 }
 
 void Character_updateConfusionState(Character* self, Game* game) {
   if (game->tick < self->enteredStateTick + CHARACTER_CONFUSION_TIME) {
     return;
   }
-  Character_transitionToState(self, IdleState);
+  Character_transitionToState(self, IdleState, game);
 }
 
 int Character_isCloseToAndFacing(Character* self,
@@ -647,7 +595,7 @@ void Character_updateDefaultActivityState(Character* self, Game* game) {
       if (game->tick >
           self->startedActivityTick + CHARACTER_DEFAULT_ACTIVITY_TIME) {
         self->startedActivityTick = 0;
-        Character_transitionToState(self, IdleState);
+        Character_transitionToState(self, IdleState, game);
       } else {
         // continue doing
         return;
@@ -663,18 +611,16 @@ void Character_updateDefaultActivityState(Character* self, Game* game) {
   }
 }
 
-void Character_haveItemTaken(Character* self, Item* item) {
-  Game* game;
+void Character_haveItemTaken(Character* self, Item* item, Game* game) {
   // let nature take its course
   self->state = ConfusionState;
 
   // make sure that the character can find the player after having item stolen
   self->targetType = ItemCharacterTarget;
   self->targetItem = item;
-  game = Game_get();
   self->targetLocation = game->player.goose->position;
 
-  Character_transitionToState(self, SeekingItemState);
+  Character_transitionToState(self, SeekingItemState, game);
 }
 
 int Character_isSomeoneElseIsHoldingItem(Character* self) {
@@ -692,12 +638,12 @@ void Character_updateSeekingItemState(Character* self, Game* game) {
         CHARACTER_NEAR_OBJ_DROP_DIST) {
       // close enough to return item
 
-      Vec3d_copyFrom(&self->itemHolder.heldItem->obj->position,
-                     &self->targetItem->initialLocation);
+      GameObject_setPosition(self->itemHolder.heldItem->obj,
+                             &self->targetItem->initialLocation);
 
       Item_drop(self->itemHolder.heldItem);
       self->targetItem = NULL;
-      Character_transitionToState(self, IdleState);
+      Character_transitionToState(self, IdleState, game);
     } else {
       // bringing item back to initial location
       Character_goToTarget(self, game, &self->targetItem->initialLocation,
@@ -712,7 +658,7 @@ void Character_updateSeekingItemState(Character* self, Game* game) {
       debugPrintf(
           "can't see the item anymore, looking in last seen location\n");
 #endif
-      Character_transitionToState(self, SeekingLastSeenState);
+      Character_transitionToState(self, SeekingLastSeenState, game);
       return;
     }
 
@@ -731,7 +677,7 @@ void Character_updateSeekingItemState(Character* self, Game* game) {
         debugPrintf("stealing item back\n");
 #endif
       }
-      Item_take(self->targetItem, &self->itemHolder);
+      Item_take(self->targetItem, &self->itemHolder, game);
       self->targetType = NoneCharacterTarget;
 
     } else {
@@ -760,7 +706,7 @@ void Character_updateSeekingTargetState(Character* self, Game* game) {
 #endif
 
     self->targetType = NoneCharacterTarget;
-    Character_transitionToState(self, IdleState);
+    Character_transitionToState(self, IdleState, game);
     return;
   } else if (self->targetType == HonkCharacterTarget) {
     if (Character_canSeePlayer(self, game)) {
@@ -768,7 +714,7 @@ void Character_updateSeekingTargetState(Character* self, Game* game) {
       debugPrintf("can see player that honked, giving up\n");
 #endif
       self->targetType = NoneCharacterTarget;
-      Character_transitionToState(self, IdleState);
+      Character_transitionToState(self, IdleState, game);
       return;
     }
   } else {
@@ -787,11 +733,11 @@ void Character_updateFleeingState(Character* self, Game* game) {
   Vec3d movement;
   Vec3d_directionTo(&game->player.goose->position, &self->obj->position,
                     &movement);
-  Vec3d_add(&self->obj->position, &movement);
+  GameObject_translate(self->obj, &movement);
 
   if (Vec3d_distanceTo(&game->player.goose->position, &self->obj->position) <
       CHARACTER_FLEE_DIST) {
-    Character_transitionToState(self, IdleState);
+    Character_transitionToState(self, IdleState, game);
   }
 }
 
@@ -12,13 +12,13 @@ void Character_init(Character* self,
 void Character_update(Character* self, Game* game);
 void Character_updateState(Character* self, Game* game);
 
-void Character_haveItemTaken(Character* self, Item* item);
+void Character_haveItemTaken(Character* self, Item* item, Game* game);
 
 float Character_topDownAngleMagToObj(Character* self, GameObject* obj);
 
 #ifndef __N64__
 void Character_print(Character* self);
-void Character_toString(Character* self, char* buffer);
+void Character_toString(Character* self, char* buffer, Game* game);
 #endif
 
 #endif /* !CHARACTER_H */
@@ -13,6 +13,18 @@
 // otherwise this stuff is in constants.h
 #endif
 
+#if COLLISION_SIMD_ENABLED
+#include <emmintrin.h>
+#endif
+
+#ifndef __N64__
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 void Triangle_getCentroid(Triangle* triangle, Vec3d* result) {
   *result = triangle->a;
   Vec3d_add(result, &triangle->b);
@@ -296,29 +308,26 @@ int Collision_sphereTriangleIsSeparated(Triangle* triangle,
   return FALSE;
 }
 
-void Collision_distancePointTriangleExact(Vec3d* point,
-                                          Triangle* triangle,
-                                          Vec3d* closest) {
-  Vec3d diff, edge0, edge1, t0edge0, t1edge1;
-  double a00, a01, a11, b0, b1, zero, one, det, t0, t1;
+// closest point on triangle (a, a + edge0, a + edge1) to point, given the
+// edge dot products a00 = edge0.edge0, a01 = edge0.edge1, a11 = edge1.edge1
+void Collision_closestPointOnTriangleEdges(Vec3d* point,
+                                           Vec3d* a,
+                                           Vec3d* edge0,
+                                           Vec3d* edge1,
+                                           double a00,
+                                           double a01,
+                                           double a11,
+                                           Vec3d* closest) {
+  Vec3d diff, t0edge0, t1edge1;
+  double b0, b1, zero, one, det, t0, t1;
   double invDet;
   double tmp0, tmp1, numer, denom;
-  // diff = point - triangle->a
+  // diff = point - a
   diff = *point;
-  Vec3d_sub(&diff, &triangle->a);
-  // edge0 = triangle->b - triangle->a
-  edge0 = triangle->b;
-  Vec3d_sub(&edge0, &triangle->a);
+  Vec3d_sub(&diff, a);
 
-  // edge1 = triangle->c - triangle->a
-  edge1 = triangle->c;
-  Vec3d_sub(&edge1, &triangle->a);
-
-  a00 = Vec3d_dot(&edge0, &edge0);
-  a01 = Vec3d_dot(&edge0, &edge1);
-  a11 = Vec3d_dot(&edge1, &edge1);
-  b0 = -Vec3d_dot(&diff, &edge0);
-  b1 = -Vec3d_dot(&diff, &edge1);
+  b0 = -Vec3d_dot(&diff, edge0);
+  b1 = -Vec3d_dot(&diff, edge1);
   zero = (double)0;
   one = (double)1;
   det = a00 * a11 - a01 * a01;
@@ -465,12 +474,12 @@ void Collision_distancePointTriangleExact(Vec3d* point,
     }
   }
 
-  // closest = triangle->a + t0 * edge0 + t1 * edge1;
-  t0edge0 = edge0;
+  // closest = a + t0 * edge0 + t1 * edge1;
+  t0edge0 = *edge0;
   Vec3d_mulScalar(&t0edge0, t0);
-  t1edge1 = edge1;
+  t1edge1 = *edge1;
   Vec3d_mulScalar(&t1edge1, t1);
-  *closest = triangle->a;
+  *closest = *a;
   Vec3d_add(closest, &t0edge0);
   Vec3d_add(closest, &t1edge1);
 
@@ -490,6 +499,117 @@ void Collision_distancePointTriangleExact(Vec3d* point,
   // sqrDistance = Vec3d_dot(diff, diff);
 }
 
+void Collision_distancePointTriangleExact(Vec3d* point,
+                                          Triangle* triangle,
+                                          Vec3d* closest) {
+  Vec3d edge0, edge1;
+  // edge0 = triangle->b - triangle->a
+  edge0 = triangle->b;
+  Vec3d_sub(&edge0, &triangle->a);
+
+  // edge1 = triangle->c - triangle->a
+  edge1 = triangle->c;
+  Vec3d_sub(&edge1, &triangle->a);
+
+  Collision_closestPointOnTriangleEdges(
+      point, &triangle->a, &edge0, &edge1, Vec3d_dot(&edge0, &edge0),
+      Vec3d_dot(&edge0, &edge1), Vec3d_dot(&edge1, &edge1), closest);
+}
+
+#if COLLISION_SIMD_ENABLED
+#define COLLISION_MESH_SOA_FIELDS 18
+
+void CollisionMesh_buildSoA(CollisionMesh* self) {
+  int i, n;
+  float* data;
+  Triangle* tri;
+  CollisionMeshTriangle* triData;
+  CollisionMeshSoA* soa;
+
+  n = self->trianglesLength;
+  if (!self->soa) {
+    soa = (CollisionMeshSoA*)malloc(sizeof(CollisionMeshSoA));
+    data = (float*)malloc(COLLISION_MESH_SOA_FIELDS * n * sizeof(float));
+    invariant(soa && data);
+    soa->aabbMinX = data + 0 * n;
+    soa->aabbMinY = data + 1 * n;
+    soa->aabbMinZ = data + 2 * n;
+    soa->aabbMaxX = data + 3 * n;
+    soa->aabbMaxY = data + 4 * n;
+    soa->aabbMaxZ = data + 5 * n;
+    soa->aX = data + 6 * n;
+    soa->aY = data + 7 * n;
+    soa->aZ = data + 8 * n;
+    soa->edge0X = data + 9 * n;
+    soa->edge0Y = data + 10 * n;
+    soa->edge0Z = data + 11 * n;
+    soa->edge1X = data + 12 * n;
+    soa->edge1Y = data + 13 * n;
+    soa->edge1Z = data + 14 * n;
+    soa->edge0LengthSq = data + 15 * n;
+    soa->edge0DotEdge1 = data + 16 * n;
+    soa->edge1LengthSq = data + 17 * n;
+    self->soa = soa;
+  }
+  soa = self->soa;
+
+  for (i = 0, tri = self->triangles, triData = self->triangleData; i < n;
+       i++, tri++, triData++) {
+    soa->aabbMinX[i] = triData->aabb.min.x;
+    soa->aabbMinY[i] = triData->aabb.min.y;
+    soa->aabbMinZ[i] = triData->aabb.min.z;
+    soa->aabbMaxX[i] = triData->aabb.max.x;
+    soa->aabbMaxY[i] = triData->aabb.max.y;
+    soa->aabbMaxZ[i] = triData->aabb.max.z;
+    soa->aX[i] = tri->a.x;
+    soa->aY[i] = tri->a.y;
+    soa->aZ[i] = tri->a.z;
+    soa->edge0X[i] = triData->edge0.x;
+    soa->edge0Y[i] = triData->edge0.y;
+    soa->edge0Z[i] = triData->edge0.z;
+    soa->edge1X[i] = triData->edge1.x;
+    soa->edge1Y[i] = triData->edge1.y;
+    soa->edge1Z[i] = triData->edge1.z;
+    soa->edge0LengthSq[i] = triData->edge0LengthSq;
+    soa->edge0DotEdge1[i] = triData->edge0DotEdge1;
+    soa->edge1LengthSq[i] = triData->edge1LengthSq;
+  }
+}
+#endif
+
+void CollisionMesh_build(CollisionMesh* self) {
+  int i;
+  Triangle* tri;
+  CollisionMeshTriangle* triData;
+
+  for (i = 0, tri = self->triangles, triData = self->triangleData;
+       i < self->trianglesLength; i++, tri++, triData++) {
+    AABB_fromTriangle(tri, &triData->aabb);
+
+    Triangle_getNormal(tri, &triData->normal);
+    triData->planeDistance = Vec3d_dot(&triData->normal, &tri->a);
+
+    triData->edge0 = tri->b;
+    Vec3d_sub(&triData->edge0, &tri->a);
+    triData->edge1 = tri->c;
+    Vec3d_sub(&triData->edge1, &tri->a);
+
+    triData->edge0LengthSq = Vec3d_dot(&triData->edge0, &triData->edge0);
+    triData->edge0DotEdge1 = Vec3d_dot(&triData->edge0, &triData->edge1);
+    triData->edge1LengthSq = Vec3d_dot(&triData->edge1, &triData->edge1);
+  }
+
+#if COLLISION_SIMD_ENABLED
+  CollisionMesh_buildSoA(self);
+#endif
+}
+
+// same as Triangle_comparePoint, using the precomputed plane
+float CollisionMesh_comparePoint(CollisionMeshTriangle* triangleData,
+                                 Vec3d* point) {
+  return Vec3d_dot(&triangleData->normal, point) - triangleData->planeDistance;
+}
+
 #ifndef __N64__
 #ifdef __cplusplus
 
@@ -501,7 +621,6 @@ std::map<int, SphereTriangleCollision> testCollisionResults;
 #endif
 #endif
 
-#define COLLISION_SPATIAL_HASH_MAX_RESULTS 100
 #define COLLISION_SPATIAL_HASH_PRUNING_ENABLED 1
 
 float Collision_sqDistancePointAABB(Vec3d* p, AABB* b) {
@@ -552,53 +671,372 @@ int Collision_testSphereAABBCollision(Vec3d* sphereCenter,
   return sqDist <= sphereRadius * sphereRadius;
 }
 
-int Collision_testMeshSphereCollision(Triangle* triangles,
-                                      int trianglesLength,
-                                      Vec3d* objCenter,
-                                      float objRadius,
-                                      SpatialHash* spatialHash,
-                                      SphereTriangleCollision* result) {
+#if COLLISION_SIMD_ENABLED
+// SIMD version of the candidate loop in Collision_testMeshSphereCollision.
+// each step uses the same float/double operations in the same order as the
+// scalar code, so the results are bit identical to the scalar path
+
+#define COLLISION_SIMD_WIDTH 4
+#define COLLISION_SIMD_GATHER(array, idx) \
+  _mm_set_ps((array)[(idx)[3]], (array)[(idx)[2]], (array)[(idx)[1]], \
+             (array)[(idx)[0]])
+
+static __m128d Collision_select2(__m128d mask, __m128d a, __m128d b) {
+  return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+// computes t0, t1 for 2 lanes, following the region tree in
+// Collision_closestPointOnTriangleEdges. every branch is evaluated and the
+// one the scalar code would have taken is selected per lane
+static void Collision_closestPointParams2(__m128d b0,
+                                          __m128d b1,
+                                          __m128d a00,
+                                          __m128d a01,
+                                          __m128d a11,
+                                          __m128d* resultT0,
+                                          __m128d* resultT1) {
+  __m128d zero, one, det, t0, t1, negB0, negB1, denom, invDet;
+  __m128d t0Neg, t1Neg, b0Neg, edge01, edge20, b0Div, b1Div;
+  __m128d tmp0, tmp1, numer, quot, cond, atEnd;
+  __m128d insideT0, insideT1, r2T0, r2T1, r6T0, r6T1, r1T0, r1T1;
+
+  zero = _mm_setzero_pd();
+  one = _mm_set1_pd(1.0);
+  negB0 = _mm_xor_pd(b0, _mm_set1_pd(-0.0));
+  negB1 = _mm_xor_pd(b1, _mm_set1_pd(-0.0));
+  det = _mm_sub_pd(_mm_mul_pd(a00, a11), _mm_mul_pd(a01, a01));
+  t0 = _mm_sub_pd(_mm_mul_pd(a01, b1), _mm_mul_pd(a11, b0));
+  t1 = _mm_sub_pd(_mm_mul_pd(a01, b0), _mm_mul_pd(a00, b1));
+  denom = _mm_add_pd(_mm_sub_pd(a00, _mm_mul_pd(_mm_set1_pd(2.0), a01)), a11);
+  t0Neg = _mm_cmplt_pd(t0, zero);
+  t1Neg = _mm_cmplt_pd(t1, zero);
+  b0Neg = _mm_cmplt_pd(b0, zero);
+  b0Div = _mm_div_pd(negB0, a00);
+  b1Div = _mm_div_pd(negB1, a11);
+
+  // V0 / V1 / E01 and V0 / V2 / E20 cases of regions 3, 4 and 5
+  edge01 = Collision_select2(
+      _mm_cmpge_pd(b0, zero), zero,
+      Collision_select2(_mm_cmpge_pd(negB0, a00), one, b0Div));
+  edge20 = Collision_select2(
+      _mm_cmpge_pd(b1, zero), zero,
+      Collision_select2(_mm_cmpge_pd(negB1, a11), one, b1Div));
+
+  // regions 0, 3, 4, 5
+  invDet = Collision_select2(_mm_cmpeq_pd(det, zero), zero,
+                             _mm_div_pd(one, det));
+  insideT0 = Collision_select2(
+      t0Neg, Collision_select2(_mm_and_pd(t1Neg, b0Neg), edge01, zero),
+      Collision_select2(t1Neg, edge01, _mm_mul_pd(t0, invDet)));
+  insideT1 = Collision_select2(
+      t0Neg, Collision_select2(_mm_and_pd(t1Neg, b0Neg), zero, edge20),
+      Collision_select2(t1Neg, zero, _mm_mul_pd(t1, invDet)));
+
+  // region 2
+  tmp0 = _mm_add_pd(a01, b0);
+  tmp1 = _mm_add_pd(a11, b1);
+  numer = _mm_sub_pd(tmp1, tmp0);
+  quot = _mm_div_pd(numer, denom);
+  cond = _mm_cmpgt_pd(tmp1, tmp0);
+  atEnd = _mm_cmpge_pd(numer, denom);
+  r2T0 = Collision_select2(cond, Collision_select2(atEnd, one, quot), zero);
+  r2T1 = Collision_select2(
+      cond, Collision_select2(atEnd, zero, _mm_sub_pd(one, quot)),
+      Collision_select2(
+          _mm_cmple_pd(tmp1, zero), one,
+          Collision_select2(_mm_cmpge_pd(b1, zero), zero, b1Div)));
+
+  // region 6
+  tmp0 = _mm_add_pd(a01, b1);
+  tmp1 = _mm_add_pd(a00, b0);
+  numer = _mm_sub_pd(tmp1, tmp0);
+  quot = _mm_div_pd(numer, denom);
+  cond = _mm_cmpgt_pd(tmp1, tmp0);
+  atEnd = _mm_cmpge_pd(numer, denom);
+  r6T1 = Collision_select2(cond, Collision_select2(atEnd, one, quot), zero);
+  r6T0 = Collision_select2(
+      cond, Collision_select2(atEnd, zero, _mm_sub_pd(one, quot)),
+      Collision_select2(
+          _mm_cmple_pd(tmp1, zero), one,
+          Collision_select2(_mm_cmpge_pd(b0, zero), zero, b0Div)));
+
+  // region 1
+  numer = _mm_sub_pd(_mm_sub_pd(_mm_add_pd(a11, b1), a01), b0);
+  quot = _mm_div_pd(numer, denom);
+  cond = _mm_cmple_pd(numer, zero);
+  atEnd = _mm_cmpge_pd(numer, denom);
+  r1T0 = Collision_select2(cond, zero, Collision_select2(atEnd, one, quot));
+  r1T1 = Collision_select2(
+      cond, one, Collision_select2(atEnd, zero, _mm_sub_pd(one, quot)));
+
+  cond = _mm_cmple_pd(_mm_add_pd(t0, t1), det);
+  *resultT0 = Collision_select2(
+      cond, insideT0,
+      Collision_select2(t0Neg, r2T0, Collision_select2(t1Neg, r6T0, r1T0)));
+  *resultT1 = Collision_select2(
+      cond, insideT1,
+      Collision_select2(t0Neg, r2T1, Collision_select2(t1Neg, r6T1, r1T1)));
+}
+
+// sphere vs AABB test for the 4 triangles in indices. returns a bitmask of
+// the triangles whose AABB overlaps the sphere
+static int Collision_testSphereAABBs4(CollisionMeshSoA* soa,
+                                      Vec3d* sphereCenter,
+                                      float sphereRadius,
+                                      int* indices) {
+  __m128 zero, p, dist, sqDist;
+
+  zero = _mm_setzero_ps();
+
+  p = _mm_set1_ps(sphereCenter->x);
+  dist = _mm_max_ps(
+      _mm_max_ps(_mm_sub_ps(COLLISION_SIMD_GATHER(soa->aabbMinX, indices), p),
+                 _mm_sub_ps(p, COLLISION_SIMD_GATHER(soa->aabbMaxX, indices))),
+      zero);
+  sqDist = _mm_mul_ps(dist, dist);
+
+  p = _mm_set1_ps(sphereCenter->y);
+  dist = _mm_max_ps(
+      _mm_max_ps(_mm_sub_ps(COLLISION_SIMD_GATHER(soa->aabbMinY, indices), p),
+                 _mm_sub_ps(p, COLLISION_SIMD_GATHER(soa->aabbMaxY, indices))),
+      zero);
+  sqDist = _mm_add_ps(sqDist, _mm_mul_ps(dist, dist));
+
+  p = _mm_set1_ps(sphereCenter->z);
+  dist = _mm_max_ps(
+      _mm_max_ps(_mm_sub_ps(COLLISION_SIMD_GATHER(soa->aabbMinZ, indices), p),
+                 _mm_sub_ps(p, COLLISION_SIMD_GATHER(soa->aabbMaxZ, indices))),
+      zero);
+  sqDist = _mm_add_ps(sqDist, _mm_mul_ps(dist, dist));
+
+  return _mm_movemask_ps(
+      _mm_cmple_ps(sqDist, _mm_set1_ps(sphereRadius * sphereRadius)));
+}
+
+// closest point on each of the 4 triangles in indices to point, and the
+// squared distance to it
+static void Collision_closestPointsOnTriangles4(CollisionMeshSoA* soa,
+                                                Vec3d* point,
+                                                int* indices,
+                                                Vec3d* resultClosest,
+                                                float* resultDistSq) {
+  __m128 px, py, pz, ax, ay, az, e0x, e0y, e0z, e1x, e1y, e1z;
+  __m128 dx, dy, dz, b0, b1, a00, a01, a11, t0, t1, cx, cy, cz, valid;
+  __m128d t0Lo, t0Hi, t1Lo, t1Hi;
+  float closestX[COLLISION_SIMD_WIDTH];
+  float closestY[COLLISION_SIMD_WIDTH];
+  float closestZ[COLLISION_SIMD_WIDTH];
+  int j;
+
+  px = _mm_set1_ps(point->x);
+  py = _mm_set1_ps(point->y);
+  pz = _mm_set1_ps(point->z);
+  ax = COLLISION_SIMD_GATHER(soa->aX, indices);
+  ay = COLLISION_SIMD_GATHER(soa->aY, indices);
+  az = COLLISION_SIMD_GATHER(soa->aZ, indices);
+  e0x = COLLISION_SIMD_GATHER(soa->edge0X, indices);
+  e0y = COLLISION_SIMD_GATHER(soa->edge0Y, indices);
+  e0z = COLLISION_SIMD_GATHER(soa->edge0Z, indices);
+  e1x = COLLISION_SIMD_GATHER(soa->edge1X, indices);
+  e1y = COLLISION_SIMD_GATHER(soa->edge1Y, indices);
+  e1z = COLLISION_SIMD_GATHER(soa->edge1Z, indices);
+  a00 = COLLISION_SIMD_GATHER(soa->edge0LengthSq, indices);
+  a01 = COLLISION_SIMD_GATHER(soa->edge0DotEdge1, indices);
+  a11 = COLLISION_SIMD_GATHER(soa->edge1LengthSq, indices);
+
+  // diff = point - a
+  dx = _mm_sub_ps(px, ax);
+  dy = _mm_sub_ps(py, ay);
+  dz = _mm_sub_ps(pz, az);
+  // b0 = -(diff . edge0), b1 = -(diff . edge1)
+  b0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, e0x), _mm_mul_ps(dy, e0y)),
+                  _mm_mul_ps(dz, e0z));
+  b0 = _mm_xor_ps(b0, _mm_set1_ps(-0.0f));
+  b1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, e1x), _mm_mul_ps(dy, e1y)),
+                  _mm_mul_ps(dz, e1z));
+  b1 = _mm_xor_ps(b1, _mm_set1_ps(-0.0f));
+
+  // the region logic is done in double precision, 2 lanes at a time
+  Collision_closestPointParams2(
+      _mm_cvtps_pd(b0), _mm_cvtps_pd(b1), _mm_cvtps_pd(a00),
+      _mm_cvtps_pd(a01), _mm_cvtps_pd(a11), &t0Lo, &t1Lo);
+  Collision_closestPointParams2(
+      _mm_cvtps_pd(_mm_movehl_ps(b0, b0)), _mm_cvtps_pd(_mm_movehl_ps(b1, b1)),
+      _mm_cvtps_pd(_mm_movehl_ps(a00, a00)),
+      _mm_cvtps_pd(_mm_movehl_ps(a01, a01)),
+      _mm_cvtps_pd(_mm_movehl_ps(a11, a11)), &t0Hi, &t1Hi);
+  t0 = _mm_movelh_ps(_mm_cvtpd_ps(t0Lo), _mm_cvtpd_ps(t0Hi));
+  t1 = _mm_movelh_ps(_mm_cvtpd_ps(t1Lo), _mm_cvtpd_ps(t1Hi));
+
+  // closest = a + t0 * edge0 + t1 * edge1
+  cx = _mm_add_ps(_mm_add_ps(ax, _mm_mul_ps(e0x, t0)), _mm_mul_ps(e1x, t1));
+  cy = _mm_add_ps(_mm_add_ps(ay, _mm_mul_ps(e0y, t0)), _mm_mul_ps(e1y, t1));
+  cz = _mm_add_ps(_mm_add_ps(az, _mm_mul_ps(e0z, t0)), _mm_mul_ps(e1z, t1));
+
+  valid = _mm_cmpord_ps(cx, cx);
+  if (_mm_movemask_ps(valid) != 0xf) {
+    debugPrintf("got NAN\n");
+    cx = _mm_and_ps(valid, cx);
+    cy = _mm_and_ps(valid, cy);
+    cz = _mm_and_ps(valid, cz);
+  }
+
+  _mm_storeu_ps(closestX, cx);
+  _mm_storeu_ps(closestY, cy);
+  _mm_storeu_ps(closestZ, cz);
+  for (j = 0; j < COLLISION_SIMD_WIDTH; j++) {
+    Vec3d_init(resultClosest + j, closestX[j], closestY[j], closestZ[j]);
+  }
+
+  dx = _mm_sub_ps(px, cx);
+  dy = _mm_sub_ps(py, cy);
+  dz = _mm_sub_ps(pz, cz);
+  _mm_storeu_ps(resultDistSq,
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                           _mm_mul_ps(dz, dz)));
+}
+
+// fills each batch of indices, repeating the last candidate to pad the
+// final batch out to the SIMD width
+static void Collision_fillSIMDBatch(int* candidates,
+                                    int candidatesCount,
+                                    int start,
+                                    int* indices) {
+  int j;
+  for (j = 0; j < COLLISION_SIMD_WIDTH; j++) {
+    indices[j] = candidates[MIN(start + j, candidatesCount - 1)];
+  }
+}
+
+// tests the sphere against the candidate triangles. writes the index, closest
+// point and squared distance of each triangle which is actually within the
+// sphere, in candidate order. returns the number of hits
+int CollisionMesh_testSphereCandidatesSIMD(CollisionMeshSoA* soa,
+                                           Vec3d* sphereCenter,
+                                           float sphereRadius,
+                                           int* candidates,
+                                           int candidatesCount,
+                                           int* hitIndices,
+                                           Vec3d* hitPoints,
+                                           float* hitDistSqs) {
+  int k, j, mask, survivorsCount, hitsCount;
+  int indices[COLLISION_SIMD_WIDTH];
+  int survivors[COLLISION_SPATIAL_HASH_MAX_RESULTS];
+  Vec3d closest[COLLISION_SIMD_WIDTH];
+  float distSq[COLLISION_SIMD_WIDTH];
+  float radiusSq;
+
+  radiusSq = sphereRadius * sphereRadius;
+
+  // first reject triangles whose AABB doesn't overlap the sphere
+  survivorsCount = 0;
+  for (k = 0; k < candidatesCount; k += COLLISION_SIMD_WIDTH) {
+    Collision_fillSIMDBatch(candidates, candidatesCount, k, indices);
+    mask = Collision_testSphereAABBs4(soa, sphereCenter, sphereRadius, indices);
+    for (j = 0; j < COLLISION_SIMD_WIDTH && k + j < candidatesCount; j++) {
+      if (mask & (1 << j)) {
+        survivors[survivorsCount++] = indices[j];
+      }
+    }
+  }
+
+  // then find the closest point on each remaining triangle
+  hitsCount = 0;
+  for (k = 0; k < survivorsCount; k += COLLISION_SIMD_WIDTH) {
+    Collision_fillSIMDBatch(survivors, survivorsCount, k, indices);
+    Collision_closestPointsOnTriangles4(soa, sphereCenter, indices, closest,
+                                        distSq);
+    for (j = 0; j < COLLISION_SIMD_WIDTH && k + j < survivorsCount; j++) {
+      if (distSq[j] > radiusSq) {
+        continue;
+      }
+      hitIndices[hitsCount] = indices[j];
+      hitPoints[hitsCount] = closest[j];
+      hitDistSqs[hitsCount] = distSq[j];
+      hitsCount++;
+    }
+  }
+  return hitsCount;
+}
+#endif
+
+// fills in a collision result for a triangle within the sphere
+void Collision_fillMeshSphereHit(CollisionMesh* mesh,
+                                 int index,
+                                 float hitDistSq,
+                                 Vec3d* closestPointOnTriangle,
+                                 SphereTriangleCollision* result) {
+  CollisionMeshTriangle* triData;
+
+  triData = mesh->triangleData + index;
+  result->index = index;
+  result->distance = sqrtf(hitDistSq);
+  result->triangle = mesh->triangles + index;
+  result->posInTriangle = *closestPointOnTriangle;
+  result->triangleAABB = triData->aabb;
+  result->triangleData = triData;
+}
+
+typedef void (*CollisionMeshSphereHitCallback)(CollisionMesh*,
+                                               int,
+                                               float,
+                                               Vec3d*,
+                                               void*);
+
+// calls hitVisitor for each candidate triangle which is actually within the
+// sphere, in candidate order, with the squared distance to its closest point
+void Collision_visitMeshSphereHits(CollisionMesh* mesh,
+                                   Vec3d* objCenter,
+                                   float objRadius,
+                                   int* candidates,
+                                   int candidatesCount,
+                                   CollisionMeshSphereHitCallback hitVisitor,
+                                   void* visitorState) {
   int i, k;
   Triangle* tri;
+  CollisionMeshTriangle* triData;
   Vec3d closestPointOnTriangle;
 
-  float closestHitDistSq;
   float hitDistSq;
   float objRadiusSq;
-  AABB triangleAABB;
   // AABB sphereAABB;
-  int hit, closestHitTriangleIndex, spatialHashResultsCount;
-  int spatialHashResults[COLLISION_SPATIAL_HASH_MAX_RESULTS];
-  // float profStartTriangleExact = CUR_TIME_MS();
-  closestHitDistSq = FLT_MAX;
-  closestHitTriangleIndex = -1;
+  int hit;
+#if COLLISION_SIMD_ENABLED
+  int hitsCount;
+  int hitIndices[COLLISION_SPATIAL_HASH_MAX_RESULTS];
+  Vec3d hitPoints[COLLISION_SPATIAL_HASH_MAX_RESULTS];
+  float hitDistSqs[COLLISION_SPATIAL_HASH_MAX_RESULTS];
+#endif
+  invariant(candidatesCount <= COLLISION_SPATIAL_HASH_MAX_RESULTS);
   objRadiusSq = objRadius * objRadius;
 
   // AABB_fromSphere(objCenter, objRadius, &sphereAABB);
 
-#ifndef __N64__
-#ifdef __cplusplus
-  if (testCollisionTrace) {
-    testCollisionResults.clear();
+#if COLLISION_SIMD_ENABLED && COLLISION_SPATIAL_HASH_PRUNING_ENABLED
+  if (mesh->soa) {
+    hitsCount = CollisionMesh_testSphereCandidatesSIMD(
+        mesh->soa, objCenter, objRadius, candidates, candidatesCount,
+        hitIndices, hitPoints, hitDistSqs);
+    for (k = 0; k < hitsCount; k++) {
+      hitVisitor(mesh, hitIndices[k], hitDistSqs[k], hitPoints + k,
+                 visitorState);
+    }
+    // every candidate has been handled, so skip the scalar loop
+    candidatesCount = 0;
   }
-#endif
 #endif
 
-  spatialHashResultsCount = SpatialHash_getTriangles(
-      objCenter, objRadius, spatialHash, spatialHashResults,
-      COLLISION_SPATIAL_HASH_MAX_RESULTS);
-
 #if COLLISION_SPATIAL_HASH_PRUNING_ENABLED
-  for (k = 0; k < spatialHashResultsCount; k++) {
-    i = spatialHashResults[k];
-    tri = triangles + i;
+  for (k = 0; k < candidatesCount; k++) {
+    i = candidates[k];
 #else
-  for (i = 0, tri = triangles; i < trianglesLength; i++, tri++) {
+  for (i = 0; i < mesh->trianglesLength; i++) {
 #endif
+    tri = mesh->triangles + i;
+    triData = mesh->triangleData + i;
     // as an optimization, first test AABB overlap
-    AABB_fromTriangle(tri, &triangleAABB);
     if (!Collision_testSphereAABBCollision(objCenter, objRadius,
-                                           &triangleAABB)) {
+                                           &triData->aabb)) {
       continue;
     }
     // if (!Collision_intersectAABBAABB(&sphereAABB, &triangleAABB)) {
@@ -610,8 +1048,10 @@ int Collision_testMeshSphereCollision(Triangle* triangles,
     hit = TRUE;
 
     if (hit) {
-      Collision_distancePointTriangleExact(objCenter, tri,
-                                           &closestPointOnTriangle);
+      Collision_closestPointOnTriangleEdges(
+          objCenter, &tri->a, &triData->edge0, &triData->edge1,
+          triData->edge0LengthSq, triData->edge0DotEdge1,
+          triData->edge1LengthSq, &closestPointOnTriangle);
 
       hitDistSq = Vec3d_distanceToSq(objCenter, &closestPointOnTriangle);
       if (hitDistSq > objRadiusSq) {
@@ -619,41 +1059,432 @@ int Collision_testMeshSphereCollision(Triangle* triangles,
         continue;
       }
 
+      hitVisitor(mesh, i, hitDistSq, &closestPointOnTriangle, visitorState);
+    }
+  }
+}
+
+typedef struct ClosestMeshSphereHitState {
+  float closestHitDistSq;
+  int closestHitTriangleIndex;
+  SphereTriangleCollision* result;
+} ClosestMeshSphereHitState;
+
+// keeps the closest triangle in the result
+void Collision_visitClosestMeshSphereHit(CollisionMesh* mesh,
+                                         int index,
+                                         float hitDistSq,
+                                         Vec3d* closestPointOnTriangle,
+                                         ClosestMeshSphereHitState* state) {
 #ifndef __N64__
 #ifdef __cplusplus
-      if (testCollisionTrace) {
-        SphereTriangleCollision debugResult = {
-            i, hitDistSq, closestPointOnTriangle, tri, triangleAABB};
-        testCollisionResults.insert(
-            std::pair<int, SphereTriangleCollision>(i, debugResult));
-      }
+  if (testCollisionTrace) {
+    SphereTriangleCollision debugResult;
+    Collision_fillMeshSphereHit(mesh, index, hitDistSq, closestPointOnTriangle,
+                                &debugResult);
+    debugResult.distance = hitDistSq;
+    testCollisionResults.insert(
+        std::pair<int, SphereTriangleCollision>(index, debugResult));
+  }
 #endif
 #endif
 
-      if (hitDistSq < closestHitDistSq) {
-        closestHitDistSq = hitDistSq;
-        closestHitTriangleIndex = i;
+  if (hitDistSq < state->closestHitDistSq) {
+    state->closestHitDistSq = hitDistSq;
+    state->closestHitTriangleIndex = index;
+    Collision_fillMeshSphereHit(mesh, index, hitDistSq, closestPointOnTriangle,
+                                state->result);
+  }
+}
 
-        result->index = i;
-        result->distance = sqrtf(closestHitDistSq);
-        result->triangle = tri;
-        result->posInTriangle = closestPointOnTriangle;
-        result->triangleAABB = triangleAABB;
-      }
-    }
+int Collision_testMeshSphereCollision(CollisionMesh* mesh,
+                                      Vec3d* objCenter,
+                                      float objRadius,
+                                      SpatialHash* spatialHash,
+                                      CollisionBVH* bvh,
+                                      SphereTriangleCollision* result) {
+  int spatialHashResultsCount;
+  int spatialHashResults[COLLISION_SPATIAL_HASH_MAX_RESULTS];
+
+  spatialHashResultsCount =
+      Collision_getMeshSphereCandidates(objCenter, objRadius, spatialHash, bvh,
+                                        spatialHashResults);
+
+  return Collision_testMeshSphereCandidates(mesh, objCenter, objRadius,
+                                            spatialHashResults,
+                                            spatialHashResultsCount, result);
+}
+
+// finds the closest of the candidate triangles which the sphere intersects
+int Collision_testMeshSphereCandidates(CollisionMesh* mesh,
+                                       Vec3d* objCenter,
+                                       float objRadius,
+                                       int* candidates,
+                                       int candidatesCount,
+                                       SphereTriangleCollision* result) {
+  ClosestMeshSphereHitState state;
+  // float profStartTriangleExact = CUR_TIME_MS();
+
+  state.closestHitDistSq = FLT_MAX;
+  state.closestHitTriangleIndex = -1;
+  state.result = result;
+
+#ifndef __N64__
+#ifdef __cplusplus
+  if (testCollisionTrace) {
+    testCollisionResults.clear();
   }
+#endif
+#endif
+
+  Collision_visitMeshSphereHits(
+      mesh, objCenter, objRadius, candidates, candidatesCount,
+      (CollisionMeshSphereHitCallback)&Collision_visitClosestMeshSphereHit,
+      (void*)&state);
 
 #ifndef __N64__
 #ifdef __cplusplus
   if (testCollisionTrace) {
-    testCollisionResult = closestHitTriangleIndex;
+    testCollisionResult = state.closestHitTriangleIndex;
   }
 #endif
 #endif
 
   // Trace_addEvent(CollisionTestMeshSphereTraceEvent, profStartTriangleExact,
   //                CUR_TIME_MS());
-  return closestHitTriangleIndex > -1;
+  return state.closestHitTriangleIndex > -1;
+}
+
+typedef struct MeshSphereContactsState {
+  SphereTriangleCollision* results;
+  int resultsFound;
+  int maxResults;
+} MeshSphereContactsState;
+
+void Collision_visitMeshSphereContact(CollisionMesh* mesh,
+                                      int index,
+                                      float hitDistSq,
+                                      Vec3d* closestPointOnTriangle,
+                                      MeshSphereContactsState* state) {
+  if (state->resultsFound == state->maxResults) {
+    debugPrintf("ran out of space in contacts array\n");
+    return;
+  }
+  Collision_fillMeshSphereHit(mesh, index, hitDistSq, closestPointOnTriangle,
+                              state->results + state->resultsFound);
+  state->resultsFound++;
+}
+
+// finds all of the candidate triangles which the sphere intersects, in
+// candidate order. returns the number found
+int Collision_getMeshSphereContacts(CollisionMesh* mesh,
+                                    Vec3d* objCenter,
+                                    float objRadius,
+                                    int* candidates,
+                                    int candidatesCount,
+                                    SphereTriangleCollision* results,
+                                    int maxResults) {
+  MeshSphereContactsState state;
+
+  state.results = results;
+  state.resultsFound = 0;
+  state.maxResults = maxResults;
+
+  Collision_visitMeshSphereHits(
+      mesh, objCenter, objRadius, candidates, candidatesCount,
+      (CollisionMeshSphereHitCallback)&Collision_visitMeshSphereContact,
+      (void*)&state);
+  return state.resultsFound;
+}
+
+// finds the triangles which might intersect the sphere, using the BVH if
+// there is one, otherwise the spatial hash. results needs room for
+// COLLISION_SPATIAL_HASH_MAX_RESULTS
+int Collision_getMeshSphereCandidates(Vec3d* objCenter,
+                                      float objRadius,
+                                      SpatialHash* spatialHash,
+                                      CollisionBVH* bvh,
+                                      int* results) {
+  if (bvh) {
+    return CollisionBVH_getTriangles(objCenter, objRadius, bvh, results,
+                                     COLLISION_SPATIAL_HASH_MAX_RESULTS);
+  }
+  return SpatialHash_getTriangles(objCenter, objRadius, spatialHash, results,
+                                  COLLISION_SPATIAL_HASH_MAX_RESULTS);
+}
+
+// finds the triangles which might be hit by a sphere swept from start to end,
+// using the BVH if there is one, otherwise the spatial hash. results needs
+// room for COLLISION_SPATIAL_HASH_MAX_RESULTS
+int Collision_getSweptSphereCandidates(Vec3d* start,
+                                       Vec3d* end,
+                                       float radius,
+                                       SpatialHash* spatialHash,
+                                       CollisionBVH* bvh,
+                                       int* results) {
+  int minCellX, minCellY, maxCellX, maxCellY, resultsFound;
+
+  if (bvh) {
+    return CollisionBVH_getTrianglesForRaycast(
+        start, end, radius, bvh, results, COLLISION_SPATIAL_HASH_MAX_RESULTS);
+  }
+  SpatialHash_getSweptSphereCells(start, end, radius, spatialHash, &minCellX,
+                                  &minCellY, &maxCellX, &maxCellY);
+  resultsFound = SpatialHash_getTrianglesInCells(
+      minCellX, minCellY, maxCellX, maxCellY, spatialHash, results,
+      COLLISION_SPATIAL_HASH_MAX_RESULTS);
+#ifndef __N64__
+  if (resultsFound == COLLISION_SPATIAL_HASH_MAX_RESULTS) {
+    debugPrintf("possibly ran out of space in results array\n");
+  }
+#endif
+  return resultsFound;
+}
+
+// smallest root of a*x^2 + b*x + c = 0 between 0 and maxRoot, if any
+int Collision_getLowestRoot(float a,
+                            float b,
+                            float c,
+                            float maxRoot,
+                            float* root) {
+  float determinant, sqrtD, r1, r2, temp;
+
+  determinant = b * b - 4.0f * a * c;
+  if (determinant < 0.0f || a == 0.0f) {
+    return FALSE;
+  }
+  sqrtD = sqrtf(determinant);
+  r1 = (-b - sqrtD) / (2.0f * a);
+  r2 = (-b + sqrtD) / (2.0f * a);
+  if (r1 > r2) {
+    temp = r2;
+    r2 = r1;
+    r1 = temp;
+  }
+  if (r1 > 0.0f && r1 < maxRoot) {
+    *root = r1;
+    return TRUE;
+  }
+  // r1 might be negative because the sphere starts out touching
+  if (r2 > 0.0f && r2 < maxRoot) {
+    *root = r2;
+    return TRUE;
+  }
+  return FALSE;
+}
+
+// barycentric test of a point which lies in the triangle's plane
+int Collision_pointInTriangle(Vec3d* point,
+                              Vec3d* a,
+                              CollisionMeshTriangle* triData) {
+  Vec3d toPoint;
+  float dot02, dot12, denom, u, v;
+
+  toPoint = *point;
+  Vec3d_sub(&toPoint, a);
+  dot02 = Vec3d_dot(&triData->edge0, &toPoint);
+  dot12 = Vec3d_dot(&triData->edge1, &toPoint);
+  denom = triData->edge0LengthSq * triData->edge1LengthSq -
+          triData->edge0DotEdge1 * triData->edge0DotEdge1;
+  u = triData->edge1LengthSq * dot02 - triData->edge0DotEdge1 * dot12;
+  v = triData->edge0LengthSq * dot12 - triData->edge0DotEdge1 * dot02;
+  return u >= 0.0f && v >= 0.0f && u + v <= denom;
+}
+
+// sweep of a sphere (at start, moving by velocity) against the edge p0,p1,
+// treated as a capsule. updates time if it's hit sooner
+int Collision_sweepSphereEdge(Vec3d* start,
+                              Vec3d* velocity,
+                              float radius,
+                              Vec3d* p0,
+                              Vec3d* p1,
+                              float* time,
+                              Vec3d* contactPoint) {
+  Vec3d edge, baseToVertex;
+  float edgeSq, edgeDotVelocity, edgeDotBaseToVertex, velocitySq, a, b, c,
+      newTime, f;
+
+  edge = *p1;
+  Vec3d_sub(&edge, p0);
+  baseToVertex = *p0;
+  Vec3d_sub(&baseToVertex, start);
+  edgeSq = Vec3d_magSq(&edge);
+  edgeDotVelocity = Vec3d_dot(&edge, velocity);
+  edgeDotBaseToVertex = Vec3d_dot(&edge, &baseToVertex);
+  velocitySq = Vec3d_magSq(velocity);
+
+  // first the infinite cylinder around the edge
+  a = edgeSq * -velocitySq + edgeDotVelocity * edgeDotVelocity;
+  b = edgeSq * (2.0f * Vec3d_dot(velocity, &baseToVertex)) -
+      2.0f * edgeDotVelocity * edgeDotBaseToVertex;
+  c = edgeSq * (radius * radius - Vec3d_magSq(&baseToVertex)) +
+      edgeDotBaseToVertex * edgeDotBaseToVertex;
+  if (!Collision_getLowestRoot(a, b, c, *time, &newTime)) {
+    return FALSE;
+  }
+  // then check the hit is within the edge
+  f = (edgeDotVelocity * newTime - edgeDotBaseToVertex) / edgeSq;
+  if (f < 0.0f || f > 1.0f) {
+    return FALSE;
+  }
+  *time = newTime;
+  Vec3d_mulScalar(&edge, f);
+  *contactPoint = *p0;
+  Vec3d_add(contactPoint, &edge);
+  return TRUE;
+}
+
+// sweep of a sphere (at start, moving by velocity) against a vertex. updates
+// time if it's hit sooner
+int Collision_sweepSphereVertex(Vec3d* start,
+                                Vec3d* velocity,
+                                float radius,
+                                Vec3d* vertex,
+                                float* time,
+                                Vec3d* contactPoint) {
+  Vec3d vertexToBase;
+  float newTime;
+
+  vertexToBase = *start;
+  Vec3d_sub(&vertexToBase, vertex);
+  if (!Collision_getLowestRoot(Vec3d_magSq(velocity),
+                               2.0f * Vec3d_dot(velocity, &vertexToBase),
+                               Vec3d_magSq(&vertexToBase) - radius * radius,
+                               *time, &newTime)) {
+    return FALSE;
+  }
+  *time = newTime;
+  *contactPoint = *vertex;
+  return TRUE;
+}
+
+// sweep of a sphere at start, moving by velocity, against one triangle. time
+// is the fraction of velocity at which the sphere first touches the triangle,
+// only updated if it's sooner than the value passed in. only the side of the
+// triangle the sphere starts on is considered, and triangles the sphere is
+// moving away from are ignored, so a sphere which is already touching can
+// still move off of them
+// based on 'Improved Collision detection and Response' by Kasper Fauerby
+int Collision_sweepSphereTriangle(Triangle* tri,
+                                  CollisionMeshTriangle* triData,
+                                  Vec3d* start,
+                                  Vec3d* velocity,
+                                  float radius,
+                                  float* time,
+                                  Vec3d* contactPoint) {
+  Vec3d normal, planeContact, offset;
+  float signedDistance, normalDotVelocity, t0, t1;
+  int found;
+
+  normal = triData->normal;
+  signedDistance = CollisionMesh_comparePoint(triData, start);
+  if (signedDistance < 0.0f) {
+    // the sphere starts behind the face, so sweep against the back of it
+    Vec3d_mulScalar(&normal, -1.0f);
+    signedDistance = -signedDistance;
+  }
+  normalDotVelocity = Vec3d_dot(&normal, velocity);
+  if (normalDotVelocity >= 0.0f) {
+    return FALSE;
+  }
+
+  // the interval in which the sphere overlaps the plane
+  t0 = (radius - signedDistance) / normalDotVelocity;
+  t1 = (-radius - signedDistance) / normalDotVelocity;
+  if (t0 > *time || t1 < 0.0f) {
+    return FALSE;
+  }
+  t0 = MAX(t0, 0.0f);
+
+  // first, the sphere might hit the inside of the triangle, which is always
+  // the first contact if it happens
+  planeContact = normal;
+  Vec3d_mulScalar(&planeContact, -radius);
+  Vec3d_add(&planeContact, start);
+  offset = *velocity;
+  Vec3d_mulScalar(&offset, t0);
+  Vec3d_add(&planeContact, &offset);
+  if (Collision_pointInTriangle(&planeContact, &tri->a, triData)) {
+    *time = t0;
+    *contactPoint = planeContact;
+    return TRUE;
+  }
+
+  // otherwise it can only hit a vertex or an edge
+  found = FALSE;
+  found = Collision_sweepSphereVertex(start, velocity, radius, &tri->a, time,
+                                      contactPoint) ||
+          found;
+  found = Collision_sweepSphereVertex(start, velocity, radius, &tri->b, time,
+                                      contactPoint) ||
+          found;
+  found = Collision_sweepSphereVertex(start, velocity, radius, &tri->c, time,
+                                      contactPoint) ||
+          found;
+  found = Collision_sweepSphereEdge(start, velocity, radius, &tri->a, &tri->b,
+                                    time, contactPoint) ||
+          found;
+  found = Collision_sweepSphereEdge(start, velocity, radius, &tri->b, &tri->c,
+                                    time, contactPoint) ||
+          found;
+  found = Collision_sweepSphereEdge(start, velocity, radius, &tri->c, &tri->a,
+                                    time, contactPoint) ||
+          found;
+  return found;
+}
+
+// finds the first of the candidate triangles hit by a sphere moving from
+// start to end
+int Collision_sweepSphereCandidates(CollisionMesh* mesh,
+                                    Vec3d* start,
+                                    Vec3d* end,
+                                    float radius,
+                                    int* candidates,
+                                    int candidatesCount,
+                                    SphereSweepCollision* result) {
+  int k, i, hitIndex;
+  float time;
+  Vec3d velocity, contactPoint, hitContactPoint;
+  AABB sweptAABB;
+  CollisionMeshTriangle* triData;
+
+  velocity = *end;
+  Vec3d_sub(&velocity, start);
+  Vec3d_init(&sweptAABB.min, MIN(start->x, end->x) - radius,
+             MIN(start->y, end->y) - radius, MIN(start->z, end->z) - radius);
+  Vec3d_init(&sweptAABB.max, MAX(start->x, end->x) + radius,
+             MAX(start->y, end->y) + radius, MAX(start->z, end->z) + radius);
+
+  time = 1.0f;
+  hitIndex = -1;
+  for (k = 0; k < candidatesCount; k++) {
+    i = candidates[k];
+    triData = mesh->triangleData + i;
+    if (!Collision_intersectAABBAABB(&sweptAABB, &triData->aabb)) {
+      continue;
+    }
+    if (Collision_sweepSphereTriangle(mesh->triangles + i, triData, start,
+                                      &velocity, radius, &time,
+                                      &contactPoint)) {
+      hitIndex = i;
+      hitContactPoint = contactPoint;
+    }
+  }
+
+  if (hitIndex == -1) {
+    return FALSE;
+  }
+
+  result->index = hitIndex;
+  result->time = time;
+  result->contactPoint = hitContactPoint;
+  // the contact normal points from the contact point to the sphere center
+  Vec3d_mulScalar(&velocity, time);
+  result->normal = *start;
+  Vec3d_add(&result->normal, &velocity);
+  Vec3d_sub(&result->normal, &hitContactPoint);
+  Vec3d_normalise(&result->normal);
+  return TRUE;
 }
 
 // Test if segment specified by points p0 and p1 intersects AABB b
@@ -807,9 +1638,91 @@ void SpatialHash_raycast(float x0,
   }
 }
 
-SpatialHashBucket* SpatialHash_getBucket(float x,
-                                         float y,
-                                         SpatialHash* spatialHash) {
+// reads an entry of bucketOffsets or triangleIndices
+unsigned int SpatialHash_getEntry(SpatialHash* spatialHash,
+                                  void* entries,
+                                  int index) {
+  return spatialHash->wideIndices ? ((unsigned int*)entries)[index]
+                                  : ((unsigned short*)entries)[index];
+}
+
+#ifndef __N64__
+// layout of the spatial hash files written by spatial_hash.py. the header is
+// followed by the bucketOffsets and triangleIndices arrays, little endian
+typedef struct SpatialHashFileHeader {
+  char magic[4];  // "SHCR"
+  int version;
+  int numBuckets;
+  float gridCellSize;
+  int cellsInDimension;
+  int cellOffsetInDimension;
+  int wideIndices;
+  int triangleIndicesLength;
+} SpatialHashFileHeader;
+
+#define SPATIAL_HASH_FILE_VERSION 1
+
+// maps a spatial hash file into memory, pointing the bucket arrays into the
+// mapping (which is never unmapped). the query context is left as is.
+// returns FALSE and leaves self unchanged if the file can't be used
+int SpatialHash_mapFile(SpatialHash* self, char* filepath) {
+  int fd, entrySize;
+  long expectedSize;
+  struct stat fileStat;
+  char* data;
+  SpatialHashFileHeader* header;
+
+  fd = open(filepath, O_RDONLY);
+  if (fd < 0) {
+    debugPrintf("couldn't open spatial hash file %s\n", filepath);
+    return FALSE;
+  }
+  if (fstat(fd, &fileStat) < 0 ||
+      fileStat.st_size < (long)sizeof(SpatialHashFileHeader)) {
+    debugPrintf("spatial hash file %s is too small\n", filepath);
+    close(fd);
+    return FALSE;
+  }
+  data = (char*)mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == (char*)MAP_FAILED) {
+    debugPrintf("couldn't map spatial hash file %s\n", filepath);
+    return FALSE;
+  }
+
+  header = (SpatialHashFileHeader*)data;
+  entrySize =
+      header->wideIndices ? sizeof(unsigned int) : sizeof(unsigned short);
+  expectedSize = sizeof(SpatialHashFileHeader) +
+                 (long)(header->numBuckets + 1 + header->triangleIndicesLength) *
+                     entrySize;
+  if (memcmp(header->magic, "SHCR", 4) != 0 ||
+      header->version != SPATIAL_HASH_FILE_VERSION ||
+      fileStat.st_size != expectedSize) {
+    debugPrintf("invalid spatial hash file %s\n", filepath);
+    munmap(data, fileStat.st_size);
+    return FALSE;
+  }
+
+  self->numBuckets = header->numBuckets;
+  self->gridCellSize = header->gridCellSize;
+  self->cellsInDimension = header->cellsInDimension;
+  self->cellOffsetInDimension = header->cellOffsetInDimension;
+  self->wideIndices = header->wideIndices;
+  self->bucketOffsets = data + sizeof(SpatialHashFileHeader);
+  self->triangleIndices =
+      data + sizeof(SpatialHashFileHeader) +
+      (header->numBuckets + 1) * entrySize;
+  return TRUE;
+}
+#endif
+
+// returns the number of triangles in the bucket containing (x, y), and
+// their position in triangleIndices in resultStart
+int SpatialHash_getBucket(float x,
+                          float y,
+                          SpatialHash* spatialHash,
+                          int* resultStart) {
   int bucketIndex, cellX, cellY;
 
   cellX = SpatialHash_unitsToGridForDimension(x, spatialHash);
@@ -819,7 +1732,38 @@ SpatialHashBucket* SpatialHash_getBucket(float x,
 
   invariant(bucketIndex < spatialHash->numBuckets);
 
-  return *(spatialHash->data + bucketIndex);
+  *resultStart = SpatialHash_getEntry(spatialHash, spatialHash->bucketOffsets,
+                                      bucketIndex);
+  return SpatialHash_getEntry(spatialHash, spatialHash->bucketOffsets,
+                              bucketIndex + 1) -
+         *resultStart;
+}
+
+void SpatialHashQueryContext_init(SpatialHashQueryContext* self,
+                                  unsigned int* visitedEpochs,
+                                  int visitedEpochsSize) {
+  int i;
+  self->epoch = 0;
+  self->visitedEpochs = visitedEpochs;
+  self->visitedEpochsSize = visitedEpochsSize;
+  for (i = 0; i < visitedEpochsSize; ++i) {
+    visitedEpochs[i] = 0;
+  }
+}
+
+// start a new query, returning the epoch which marks triangles as visited
+unsigned int SpatialHashQueryContext_nextEpoch(SpatialHashQueryContext* self) {
+  int i;
+  self->epoch++;
+  if (self->epoch == 0) {
+    // wrapped around, so old stamps could alias the new epoch. this only
+    // happens once every 2^32 queries so we can afford to clear here
+    for (i = 0; i < self->visitedEpochsSize; ++i) {
+      self->visitedEpochs[i] = 0;
+    }
+    self->epoch = 1;
+  }
+  return self->epoch;
 }
 
 typedef struct GetTrianglesVisitBucketState {
@@ -827,36 +1771,76 @@ typedef struct GetTrianglesVisitBucketState {
   int* results;
   int maxResults;
   int resultsFound;
+  SpatialHashQueryContext* queryContext;
+  unsigned int epoch;
 } GetTrianglesVisitBucketState;
 
+void SpatialHash_initVisitBucketState(GetTrianglesVisitBucketState* state,
+                                      SpatialHash* spatialHash,
+                                      int* results,
+                                      int maxResults) {
+  state->spatialHash = spatialHash;
+  state->results = results;
+  state->maxResults = maxResults;
+  state->resultsFound = 0;
+  state->queryContext = spatialHash->queryContext;
+  state->epoch = state->queryContext
+                     ? SpatialHashQueryContext_nextEpoch(state->queryContext)
+                     : 0;
+}
+
 void SpatialHash_getTrianglesVisitBucket(int cellX,
                                          int cellY,
                                          GetTrianglesVisitBucketState* state) {
-  int bucketIndex, bucketItemIndex, resultIndex;
-  SpatialHashBucket* bucket;
-  int *bucketItem, *currentResult;
+  int bucketIndex, bucketItemIndex, bucketEnd, bucketItem, resultIndex;
+  int* currentResult;
+  unsigned int* visitedEpochs;
+  SpatialHash* spatialHash;
 
-  bucketIndex = SpatialHash_getBucketIndex(
-      cellX, cellY, state->spatialHash->cellsInDimension);
+  spatialHash = state->spatialHash;
+  bucketIndex =
+      SpatialHash_getBucketIndex(cellX, cellY, spatialHash->cellsInDimension);
 
-  invariant(bucketIndex < state->spatialHash->numBuckets);
+  invariant(bucketIndex < spatialHash->numBuckets);
 
-  bucket = *(state->spatialHash->data + bucketIndex);
-  if (!bucket) {
-    // nothing in this bucket
+  bucketItemIndex = SpatialHash_getEntry(
+      spatialHash, spatialHash->bucketOffsets, bucketIndex);
+  bucketEnd = SpatialHash_getEntry(spatialHash, spatialHash->bucketOffsets,
+                                   bucketIndex + 1);
+
+  if (state->queryContext) {
+    // O(1) duplicate check using the epoch stamped on each collected triangle
+    visitedEpochs = state->queryContext->visitedEpochs;
+    for (; bucketItemIndex < bucketEnd; ++bucketItemIndex) {
+      bucketItem = SpatialHash_getEntry(
+          spatialHash, spatialHash->triangleIndices, bucketItemIndex);
+      invariant(bucketItem < state->queryContext->visitedEpochsSize);
+      if (visitedEpochs[bucketItem] == state->epoch) {
+        // already have this triangle in the results
+        continue;
+      }
+      if (state->resultsFound == state->maxResults) {
+        // out of space
+        return;
+      }
+      visitedEpochs[bucketItem] = state->epoch;
+      state->results[state->resultsFound] = bucketItem;
+      state->resultsFound++;
+    }
     return;
   }
+
   // collect results from this bucket
-  for (bucketItemIndex = 0; bucketItemIndex < bucket->size; ++bucketItemIndex) {
-    bucketItem = bucket->data + bucketItemIndex;
+  for (; bucketItemIndex < bucketEnd; ++bucketItemIndex) {
+    bucketItem = SpatialHash_getEntry(spatialHash, spatialHash->triangleIndices,
+                                      bucketItemIndex);
 
     // look through results and add if not duplicate
-    // TODO: optimize this, as it's currently O(n^2)
-    // could qsort then remove duplicates to get to O(n log n)
+    // this is O(n^2), so only used if there's no query context
     for (resultIndex = 0; resultIndex < state->maxResults; ++resultIndex) {
       currentResult = state->results + resultIndex;
       if (resultIndex < state->resultsFound) {
-        if (*currentResult == *bucketItem) {
+        if (*currentResult == bucketItem) {
           // already have this triangle in the results
           break;
         } else {
@@ -865,7 +1849,7 @@ void SpatialHash_getTrianglesVisitBucket(int cellX,
       } else {
         // at end of found results and this result is not already in the
         // list
-        *currentResult = *bucketItem;
+        *currentResult = bucketItem;
         state->resultsFound++;
         break;  // continue to next item in bucket
       }
@@ -879,10 +1863,8 @@ int SpatialHash_getTrianglesForRaycast(Vec3d* rayStart,
                                        int* results,
                                        int maxResults) {
   GetTrianglesVisitBucketState traversalState;
-  traversalState.spatialHash = spatialHash;
-  traversalState.results = results;
-  traversalState.maxResults = maxResults;
-  traversalState.resultsFound = 0;
+  SpatialHash_initVisitBucketState(&traversalState, spatialHash, results,
+                                   maxResults);
   SpatialHash_raycast(
       SpatialHash_unitsToGridFloatForDimension(rayStart->x, spatialHash),
       SpatialHash_unitsToGridFloatForDimension(-rayStart->z, spatialHash),
@@ -900,20 +1882,39 @@ int SpatialHash_getTrianglesForRaycast(Vec3d* rayStart,
   return traversalState.resultsFound;
 }
 
+// collects the (unique) set of triangles in a rectangle of cells. max is
+// exclusive
+int SpatialHash_getTrianglesInCells(int minCellX,
+                                    int minCellY,
+                                    int maxCellX,
+                                    int maxCellY,
+                                    SpatialHash* spatialHash,
+                                    int* results,
+                                    int maxResults) {
+  int cellX, cellY;
+  GetTrianglesVisitBucketState traversalState;
+
+  SpatialHash_initVisitBucketState(&traversalState, spatialHash, results,
+                                   maxResults);
+
+  // walk range of overlapping buckets and collect (unique) set of triangles
+  for (cellX = minCellX; cellX < maxCellX; ++cellX) {
+    for (cellY = minCellY; cellY < maxCellY; ++cellY) {
+      SpatialHash_getTrianglesVisitBucket(cellX, cellY, &traversalState);
+    }
+  }
+
+  return traversalState.resultsFound;
+}
+
 int SpatialHash_getTriangles(Vec3d* position,
                              float radius,
                              SpatialHash* spatialHash,
                              int* results,
                              int maxResults) {
-  int minCellX, minCellY, maxCellX, maxCellY, cellX, cellY;
-  GetTrianglesVisitBucketState traversalState;
+  int minCellX, minCellY, maxCellX, maxCellY, resultsFound;
   // float profStartCollisionGetTriangles = CUR_TIME_MS();
 
-  traversalState.spatialHash = spatialHash;
-  traversalState.results = results;
-  traversalState.maxResults = maxResults;
-  traversalState.resultsFound = 0;
-
   minCellX =
       SpatialHash_unitsToGridForDimension(position->x - radius, spatialHash);
   minCellY =
@@ -925,20 +1926,428 @@ int SpatialHash_getTriangles(Vec3d* position,
       SpatialHash_unitsToGridForDimension(-position->z + radius, spatialHash) +
       1;
 
-  // walk range of overlapping buckets and collect (unique) set of triangles
-  for (cellX = minCellX; cellX < maxCellX; ++cellX) {
-    for (cellY = minCellY; cellY < maxCellY; ++cellY) {
-      SpatialHash_getTrianglesVisitBucket(cellX, cellY, &traversalState);
-    }
-  }
+  resultsFound = SpatialHash_getTrianglesInCells(
+      minCellX, minCellY, maxCellX, maxCellY, spatialHash, results, maxResults);
 
 #ifndef __N64__
-  if (traversalState.resultsFound == maxResults) {
+  if (resultsFound == maxResults) {
     debugPrintf("possibly ran out of space in results array\n");
   }
 #endif
 
   // Trace_addEvent(CollisionGetTrianglesTraceEvent,
   //                profStartCollisionGetTriangles, CUR_TIME_MS());
-  return traversalState.resultsFound;
+  return resultsFound;
+}
+
+// the rectangle of cells covered by a sphere swept from sweptStart to
+// sweptEnd. max is exclusive
+void SpatialHash_getSweptSphereCells(Vec3d* sweptStart,
+                                     Vec3d* sweptEnd,
+                                     float radius,
+                                     SpatialHash* spatialHash,
+                                     int* minCellX,
+                                     int* minCellY,
+                                     int* maxCellX,
+                                     int* maxCellY) {
+  // the hash grid is on the x,-z plane
+  *minCellX = SpatialHash_unitsToGridForDimension(
+      MIN(sweptStart->x, sweptEnd->x) - radius, spatialHash);
+  *minCellY = SpatialHash_unitsToGridForDimension(
+      MIN(-sweptStart->z, -sweptEnd->z) - radius, spatialHash);
+  *maxCellX = SpatialHash_unitsToGridForDimension(
+                  MAX(sweptStart->x, sweptEnd->x) + radius, spatialHash) +
+              1;
+  *maxCellY = SpatialHash_unitsToGridForDimension(
+                  MAX(-sweptStart->z, -sweptEnd->z) + radius, spatialHash) +
+              1;
+}
+
+void CollisionCandidateCache_init(CollisionCandidateCache* self) {
+  self->valid = FALSE;
+  self->candidatesCount = 0;
+}
+
+// makes sure the cache holds the candidate triangles for the sphere swept from
+// sweptStart to sweptEnd. the cached list is reused while the swept bounds stay
+// within the cells it was collected from and the radius is unchanged, otherwise
+// it's collected again for the cells the swept bounds now cover. returns TRUE
+// if the cached list was reused. if there are too many triangles to fit, the
+// cache is left invalid and the caller must query the spatial hash itself
+int CollisionCandidateCache_update(CollisionCandidateCache* self,
+                                   Vec3d* sweptStart,
+                                   Vec3d* sweptEnd,
+                                   float radius,
+                                   SpatialHash* spatialHash) {
+  int minCellX, minCellY, maxCellX, maxCellY;
+
+  SpatialHash_getSweptSphereCells(sweptStart, sweptEnd, radius, spatialHash,
+                                  &minCellX, &minCellY, &maxCellX, &maxCellY);
+
+  if (self->valid && self->radius == radius && minCellX >= self->minCellX &&
+      minCellY >= self->minCellY && maxCellX <= self->maxCellX &&
+      maxCellY <= self->maxCellY) {
+    return TRUE;
+  }
+
+  self->minCellX = minCellX;
+  self->minCellY = minCellY;
+  self->maxCellX = maxCellX;
+  self->maxCellY = maxCellY;
+  self->radius = radius;
+  self->candidatesCount = SpatialHash_getTrianglesInCells(
+      minCellX, minCellY, maxCellX, maxCellY, spatialHash, self->candidates,
+      COLLISION_CANDIDATE_CACHE_SIZE);
+  // a full list might have been truncated
+  self->valid = self->candidatesCount < COLLISION_CANDIDATE_CACHE_SIZE;
+  return FALSE;
+}
+
+#define COLLISION_BVH_MAX_LEAF_TRIANGLES 4
+#define COLLISION_BVH_MAX_DEPTH 64
+#define COLLISION_BVH_SAH_BINS 16
+
+// triangle centroid along an axis, scaled by 3 (only used for ordering)
+float CollisionBVH_centroidOnAxis(Triangle* triangle, int axis) {
+  switch (axis) {
+    case 0:
+      return triangle->a.x + triangle->b.x + triangle->c.x;
+    case 1:
+      return triangle->a.y + triangle->b.y + triangle->c.y;
+    default:
+      return triangle->a.z + triangle->b.z + triangle->c.z;
+  }
+}
+
+float CollisionBVH_surfaceArea(AABB* aabb) {
+  Vec3d size;
+  size = aabb->max;
+  Vec3d_sub(&size, &aabb->min);
+  return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+void CollisionBVH_emptyAABB(AABB* aabb) {
+  Vec3d_init(&aabb->min, FLT_MAX, FLT_MAX, FLT_MAX);
+  Vec3d_init(&aabb->max, -FLT_MAX, -FLT_MAX, -FLT_MAX);
+}
+
+int CollisionBVH_centroidBin(Triangle* triangle,
+                             int axis,
+                             float centroidMin,
+                             float centroidExtent) {
+  int bin;
+  bin = (int)((CollisionBVH_centroidOnAxis(triangle, axis) - centroidMin) *
+              COLLISION_BVH_SAH_BINS / centroidExtent);
+  return MIN(MAX(bin, 0), COLLISION_BVH_SAH_BINS - 1);
+}
+
+// finds the split with the lowest surface area heuristic cost, by bucketing
+// the centroids into bins along each axis. returns the number of triangles
+// which go to the left child, or 0 if there's no useful split
+int CollisionBVH_partitionSAH(CollisionBVH* self,
+                              Triangle* triangles,
+                              int start,
+                              int count,
+                              AABB* centroidBounds) {
+  int i, j, axis, bin, bestAxis, bestBin, leftCount, tmp;
+  int binCounts[COLLISION_BVH_SAH_BINS];
+  AABB binBounds[COLLISION_BVH_SAH_BINS];
+  float rightCosts[COLLISION_BVH_SAH_BINS];
+  float axisMin[3], axisExtent[3];
+  float cost, bestCost;
+  AABB triangleAABB, sweepAABB;
+  int* indices;
+
+  indices = self->triangleIndices + start;
+  axisMin[0] = centroidBounds->min.x;
+  axisMin[1] = centroidBounds->min.y;
+  axisMin[2] = centroidBounds->min.z;
+  axisExtent[0] = centroidBounds->max.x - centroidBounds->min.x;
+  axisExtent[1] = centroidBounds->max.y - centroidBounds->min.y;
+  axisExtent[2] = centroidBounds->max.z - centroidBounds->min.z;
+
+  bestCost = FLT_MAX;
+  bestAxis = -1;
+  bestBin = 0;
+  for (axis = 0; axis < 3; axis++) {
+    if (axisExtent[axis] <= 0.0f) {
+      continue;
+    }
+    for (bin = 0; bin < COLLISION_BVH_SAH_BINS; bin++) {
+      binCounts[bin] = 0;
+      CollisionBVH_emptyAABB(binBounds + bin);
+    }
+    for (i = 0; i < count; i++) {
+      bin = CollisionBVH_centroidBin(triangles + indices[i], axis,
+                                     axisMin[axis], axisExtent[axis]);
+      binCounts[bin]++;
+      AABB_fromTriangle(triangles + indices[i], &triangleAABB);
+      AABB_expandByPoint(binBounds + bin, &triangleAABB.min);
+      AABB_expandByPoint(binBounds + bin, &triangleAABB.max);
+    }
+
+    // sweep from the right, then from the left, to cost each split plane
+    CollisionBVH_emptyAABB(&sweepAABB);
+    leftCount = 0;
+    for (bin = COLLISION_BVH_SAH_BINS - 1; bin > 0; bin--) {
+      if (binCounts[bin]) {
+        AABB_expandByPoint(&sweepAABB, &binBounds[bin].min);
+        AABB_expandByPoint(&sweepAABB, &binBounds[bin].max);
+      }
+      leftCount += binCounts[bin];
+      rightCosts[bin] =
+          leftCount ? leftCount * CollisionBVH_surfaceArea(&sweepAABB) : 0.0f;
+    }
+    CollisionBVH_emptyAABB(&sweepAABB);
+    leftCount = 0;
+    for (bin = 0; bin < COLLISION_BVH_SAH_BINS - 1; bin++) {
+      if (binCounts[bin]) {
+        AABB_expandByPoint(&sweepAABB, &binBounds[bin].min);
+        AABB_expandByPoint(&sweepAABB, &binBounds[bin].max);
+      }
+      leftCount += binCounts[bin];
+      if (!leftCount || leftCount == count) {
+        continue;
+      }
+      cost = leftCount * CollisionBVH_surfaceArea(&sweepAABB) +
+             rightCosts[bin + 1];
+      if (cost < bestCost) {
+        bestCost = cost;
+        bestAxis = axis;
+        bestBin = bin;
+      }
+    }
+  }
+
+  if (bestAxis == -1) {
+    return 0;
+  }
+
+  // move the triangles left of the split to the front
+  i = 0;
+  j = count - 1;
+  while (i <= j) {
+    if (CollisionBVH_centroidBin(triangles + indices[i], bestAxis,
+                                 axisMin[bestAxis],
+                                 axisExtent[bestAxis]) <= bestBin) {
+      i++;
+    } else {
+      tmp = indices[i];
+      indices[i] = indices[j];
+      indices[j] = tmp;
+      j--;
+    }
+  }
+  return i;
+}
+
+void CollisionBVH_buildNode(CollisionBVH* self,
+                            Triangle* triangles,
+                            int nodeIndex,
+                            int start,
+                            int count,
+                            int depth) {
+  int i, leftCount;
+  Vec3d centroid;
+  AABB triangleAABB, centroidBounds;
+  CollisionBVHNode* node;
+
+  node = self->nodes + nodeIndex;
+
+  CollisionBVH_emptyAABB(&node->aabb);
+  CollisionBVH_emptyAABB(&centroidBounds);
+  for (i = start; i < start + count; i++) {
+    AABB_fromTriangle(triangles + self->triangleIndices[i], &triangleAABB);
+    AABB_expandByPoint(&node->aabb, &triangleAABB.min);
+    AABB_expandByPoint(&node->aabb, &triangleAABB.max);
+
+    Vec3d_init(
+        &centroid,
+        CollisionBVH_centroidOnAxis(triangles + self->triangleIndices[i], 0),
+        CollisionBVH_centroidOnAxis(triangles + self->triangleIndices[i], 1),
+        CollisionBVH_centroidOnAxis(triangles + self->triangleIndices[i], 2));
+    AABB_expandByPoint(&centroidBounds, &centroid);
+  }
+
+  if (count <= COLLISION_BVH_MAX_LEAF_TRIANGLES) {
+    node->start = start;
+    node->count = count;
+    return;
+  }
+
+  leftCount =
+      CollisionBVH_partitionSAH(self, triangles, start, count, &centroidBounds);
+  if (!leftCount) {
+    // all the centroids are in the same place, just split the list in half
+    leftCount = count / 2;
+  }
+
+  // if the tree ends up this deep, the mesh is probably broken
+  invariant(depth < COLLISION_BVH_MAX_DEPTH - 1);
+
+  node->start = self->nodesLength;
+  node->count = 0;
+  self->nodesLength += 2;
+  CollisionBVH_buildNode(self, triangles, node->start, start, leftCount,
+                         depth + 1);
+  CollisionBVH_buildNode(self, triangles, node->start + 1, start + leftCount,
+                         count - leftCount, depth + 1);
+}
+
+void CollisionBVH_build(CollisionBVH* self,
+                        Triangle* triangles,
+                        int trianglesLength) {
+  int i;
+  for (i = 0; i < trianglesLength; i++) {
+    self->triangleIndices[i] = i;
+  }
+  self->nodesLength = 0;
+  if (!trianglesLength) {
+    return;
+  }
+  self->nodesLength = 1;
+  CollisionBVH_buildNode(self, triangles, 0, 0, trianglesLength, 0);
+  invariant(self->nodesLength <= COLLISION_BVH_MAX_NODES(trianglesLength));
+}
+
+// the segment vs AABB test from Collision_testSegmentAABBCollision, with the
+// segment values precomputed as they're the same for every node
+typedef struct CollisionBVHSegment {
+  Vec3d midpoint;
+  Vec3d halfLength;
+  Vec3d absHalfLength;
+  Vec3d absHalfLengthEpsilon;
+  float radius;  // AABBs are expanded by this
+} CollisionBVHSegment;
+
+void CollisionBVHSegment_init(CollisionBVHSegment* self,
+                              Vec3d* p0,
+                              Vec3d* p1,
+                              float radius) {
+  self->midpoint = *p0;
+  Vec3d_add(&self->midpoint, p1);
+  Vec3d_mulScalar(&self->midpoint, 0.5f);
+  self->halfLength = *p1;
+  Vec3d_sub(&self->halfLength, &self->midpoint);
+  Vec3d_init(&self->absHalfLength, fabsf(self->halfLength.x),
+             fabsf(self->halfLength.y), fabsf(self->halfLength.z));
+  Vec3d_init(&self->absHalfLengthEpsilon,
+             self->absHalfLength.x + FLT_EPSILON,
+             self->absHalfLength.y + FLT_EPSILON,
+             self->absHalfLength.z + FLT_EPSILON);
+  self->radius = radius;
+}
+
+int CollisionBVHSegment_testAABB(CollisionBVHSegment* self, AABB* b) {
+  Vec3d c, e, m;
+  Vec3d* d;
+  Vec3d* ad;
+
+  // box center and halflength extents, expanded by the radius
+  c = b->min;
+  Vec3d_add(&c, &b->max);
+  Vec3d_mulScalar(&c, 0.5f);
+  e = b->max;
+  Vec3d_sub(&e, &c);
+  e.x += self->radius;
+  e.y += self->radius;
+  e.z += self->radius;
+
+  // translate box and segment to origin
+  m = self->midpoint;
+  Vec3d_sub(&m, &c);
+
+  d = &self->halfLength;
+  ad = &self->absHalfLength;
+  // try world coordinate axes as separating axes
+  if (fabsf(m.x) > e.x + ad->x || fabsf(m.y) > e.y + ad->y ||
+      fabsf(m.z) > e.z + ad->z) {
+    return FALSE;
+  }
+  // try cross products of segment direction vector with coordinate axes
+  ad = &self->absHalfLengthEpsilon;
+  if (fabsf(m.y * d->z - m.z * d->y) > e.y * ad->z + e.z * ad->y ||
+      fabsf(m.z * d->x - m.x * d->z) > e.x * ad->z + e.z * ad->x ||
+      fabsf(m.x * d->y - m.y * d->x) > e.x * ad->y + e.y * ad->x) {
+    return FALSE;
+  }
+  return TRUE;
+}
+
+// collects the triangles of every leaf whose AABB overlaps the sphere, or the
+// segment (swept by radius) if segment is not NULL
+int CollisionBVH_collectTriangles(CollisionBVH* bvh,
+                                  Vec3d* position,
+                                  float radius,
+                                  CollisionBVHSegment* segment,
+                                  int* results,
+                                  int maxResults) {
+  int stack[COLLISION_BVH_MAX_DEPTH];
+  int stackSize, resultsFound, i, child;
+  CollisionBVHNode* node;
+
+  resultsFound = 0;
+  if (!bvh->nodesLength) {
+    return 0;
+  }
+
+  // children are tested before being pushed, so only the root is tested here
+  if (segment ? !CollisionBVHSegment_testAABB(segment, &bvh->nodes->aabb)
+              : !Collision_testSphereAABBCollision(position, radius,
+                                                   &bvh->nodes->aabb)) {
+    return 0;
+  }
+
+  stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize) {
+    node = bvh->nodes + stack[--stackSize];
+
+    if (node->count) {
+      for (i = node->start; i < node->start + node->count; i++) {
+        if (resultsFound == maxResults) {
+#ifndef __N64__
+          debugPrintf("possibly ran out of space in results array\n");
+#endif
+          return resultsFound;
+        }
+        results[resultsFound++] = bvh->triangleIndices[i];
+      }
+      continue;
+    }
+
+    // push right first so the left subtree is visited first
+    for (child = node->start + 1; child >= node->start; child--) {
+      if (segment ? CollisionBVHSegment_testAABB(segment,
+                                                 &bvh->nodes[child].aabb)
+                  : Collision_testSphereAABBCollision(
+                        position, radius, &bvh->nodes[child].aabb)) {
+        invariant(stackSize < COLLISION_BVH_MAX_DEPTH);
+        stack[stackSize++] = child;
+      }
+    }
+  }
+  return resultsFound;
+}
+
+int CollisionBVH_getTriangles(Vec3d* position,
+                              float radius,
+                              CollisionBVH* bvh,
+                              int* results,
+                              int maxResults) {
+  return CollisionBVH_collectTriangles(bvh, position, radius, NULL, results,
+                                       maxResults);
+}
+
+// rayRadius widens the query to everything within that distance of the ray
+int CollisionBVH_getTrianglesForRaycast(Vec3d* rayStart,
+                                        Vec3d* rayEnd,
+                                        float rayRadius,
+                                        CollisionBVH* bvh,
+                                        int* results,
+                                        int maxResults) {
+  CollisionBVHSegment segment;
+  CollisionBVHSegment_init(&segment, rayStart, rayEnd, rayRadius);
+  return CollisionBVH_collectTriangles(bvh, rayStart, 0.0f, &segment, results,
+                                       maxResults);
 }
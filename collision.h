@@ -15,27 +15,146 @@ typedef struct AABB {
   Vec3d max;
 } AABB;
 
+// values derived from a static triangle's vertices. these are precomputed
+// when the collision mesh is loaded so collision tests can just read them
+typedef struct CollisionMeshTriangle {
+  AABB aabb;
+  Vec3d normal;         // unit normal
+  float planeDistance;  // normal . a
+  Vec3d edge0;          // b - a
+  Vec3d edge1;          // c - a
+  float edge0LengthSq;  // edge0 . edge0
+  float edge0DotEdge1;  // edge0 . edge1
+  float edge1LengthSq;  // edge1 . edge1
+} CollisionMeshTriangle;
+
+// the desktop build tests mesh triangles 4 at a time with SSE2. on N64 (and
+// desktop targets without SSE2) the scalar path is used
+#if !defined(__N64__) && defined(__SSE2__)
+#define COLLISION_SIMD_ENABLED 1
+#else
+#define COLLISION_SIMD_ENABLED 0
+#endif
+
+#if COLLISION_SIMD_ENABLED
+// structure-of-arrays copy of the triangle data, so the SIMD kernel can load
+// one field of 4 triangles at a time. all arrays are trianglesLength long
+typedef struct CollisionMeshSoA {
+  float* aabbMinX;
+  float* aabbMinY;
+  float* aabbMinZ;
+  float* aabbMaxX;
+  float* aabbMaxY;
+  float* aabbMaxZ;
+  float* aX;
+  float* aY;
+  float* aZ;
+  float* edge0X;
+  float* edge0Y;
+  float* edge0Z;
+  float* edge1X;
+  float* edge1Y;
+  float* edge1Z;
+  float* edge0LengthSq;
+  float* edge0DotEdge1;
+  float* edge1LengthSq;
+} CollisionMeshSoA;
+#endif
+
+typedef struct CollisionMesh {
+  Triangle* triangles;
+  int trianglesLength;
+  // same length as triangles, filled by CollisionMesh_build()
+  CollisionMeshTriangle* triangleData;
+#if COLLISION_SIMD_ENABLED
+  // allocated by CollisionMesh_build(). if NULL the scalar path is used
+  CollisionMeshSoA* soa;
+#endif
+} CollisionMesh;
+
 typedef struct SphereTriangleCollision {
   int index;
   float distance;
   Vec3d posInTriangle;
   Triangle* triangle;
   AABB triangleAABB;
+  CollisionMeshTriangle* triangleData;
 } SphereTriangleCollision;
 
-typedef struct SpatialHashBucket {
-  int size;
-  int* data;
-} SpatialHashBucket;
+// the first contact of a sphere moving along a segment
+typedef struct SphereSweepCollision {
+  int index;
+  float time;          // fraction of the segment travelled before the hit
+  Vec3d contactPoint;  // on the triangle
+  Vec3d normal;        // unit, from the contact point to the sphere center
+} SphereSweepCollision;
 
+// per-mesh scratch state for spatial hash queries. each query stamps the
+// triangles it collects with a new epoch, so duplicates from overlapping
+// buckets can be skipped in O(1) without clearing anything between queries
+typedef struct SpatialHashQueryContext {
+  unsigned int epoch;
+  unsigned int* visitedEpochs;  // indexed by triangle index
+  int visitedEpochsSize;
+} SpatialHashQueryContext;
+
+// buckets are stored in compressed sparse row form: the triangles in bucket i
+// are triangleIndices[bucketOffsets[i]] up to (not including)
+// triangleIndices[bucketOffsets[i + 1]]. both arrays hold unsigned shorts, or
+// unsigned ints if wideIndices is set (for meshes too big for 16 bits)
 typedef struct SpatialHash {
   int numBuckets;
   float gridCellSize;
   int cellsInDimension;
   int cellOffsetInDimension;
-  SpatialHashBucket** data;
+  int wideIndices;
+  void* bucketOffsets;  // numBuckets + 1 entries
+  void* triangleIndices;
+  // optional, if NULL queries fall back to scanning the results found so far
+  SpatialHashQueryContext* queryContext;
 } SpatialHash;
 
+// most candidate triangles a single collision query can return
+#define COLLISION_SPATIAL_HASH_MAX_RESULTS 100
+
+#define COLLISION_CANDIDATE_CACHE_SIZE 64
+
+// the candidate triangles for a rectangle of spatial hash cells. a moving body
+// keeps one of these so it can skip the hash lookup for as long as it stays
+// within the same cells
+typedef struct CollisionCandidateCache {
+  int valid;  // boolean
+  // covered cells, max is exclusive
+  int minCellX;
+  int minCellY;
+  int maxCellX;
+  int maxCellY;
+  float radius;
+  int candidatesCount;
+  int candidates[COLLISION_CANDIDATE_CACHE_SIZE];
+} CollisionCandidateCache;
+
+// bounding volume hierarchy over a triangle mesh, an alternative to the
+// spatial hash which handles vertically layered geometry and large maps
+typedef struct CollisionBVHNode {
+  AABB aabb;
+  // for leaves (count > 0), the first entry in triangleIndices.
+  // otherwise the index of the left child, the right child follows it
+  int start;
+  int count;
+} CollisionBVHNode;
+
+// buffers are provided by the owner: nodes needs room for
+// COLLISION_BVH_MAX_NODES(trianglesLength) nodes, triangleIndices for
+// trianglesLength ints
+typedef struct CollisionBVH {
+  CollisionBVHNode* nodes;
+  int nodesLength;
+  int* triangleIndices;
+} CollisionBVH;
+
+#define COLLISION_BVH_MAX_NODES(trianglesLength) (2 * (trianglesLength))
+
 #ifndef __N64__
 #ifdef __cplusplus
 
@@ -53,6 +172,10 @@ float Triangle_comparePoint(Triangle* triangle, Vec3d* point);
 
 void AABB_fromTriangle(Triangle* triangle, AABB* result);
 
+void CollisionMesh_build(CollisionMesh* self);
+float CollisionMesh_comparePoint(CollisionMeshTriangle* triangleData,
+                                 Vec3d* point);
+
 int Collision_intersectAABBAABB(AABB* a, AABB* b);
 
 int Collision_sphereTriangleIsSeparated(Triangle* triangle,
@@ -63,13 +186,57 @@ void Collision_distancePointTriangleExact(Vec3d* point,
                                           Triangle* triangle,
                                           Vec3d* closest);
 
-int Collision_testMeshSphereCollision(Triangle* triangles,
-                                      int trianglesLength,
+int Collision_testMeshSphereCollision(CollisionMesh* mesh,
                                       Vec3d* objCenter,
                                       float objRadius,
                                       SpatialHash* spatialHash,
+                                      CollisionBVH* bvh,
                                       SphereTriangleCollision* result);
 
+int Collision_testMeshSphereCandidates(CollisionMesh* mesh,
+                                       Vec3d* objCenter,
+                                       float objRadius,
+                                       int* candidates,
+                                       int candidatesCount,
+                                       SphereTriangleCollision* result);
+
+int Collision_getMeshSphereContacts(CollisionMesh* mesh,
+                                    Vec3d* objCenter,
+                                    float objRadius,
+                                    int* candidates,
+                                    int candidatesCount,
+                                    SphereTriangleCollision* results,
+                                    int maxResults);
+
+int Collision_getMeshSphereCandidates(Vec3d* objCenter,
+                                      float objRadius,
+                                      SpatialHash* spatialHash,
+                                      CollisionBVH* bvh,
+                                      int* results);
+
+int Collision_getSweptSphereCandidates(Vec3d* start,
+                                       Vec3d* end,
+                                       float radius,
+                                       SpatialHash* spatialHash,
+                                       CollisionBVH* bvh,
+                                       int* results);
+
+int Collision_sweepSphereTriangle(Triangle* tri,
+                                  CollisionMeshTriangle* triData,
+                                  Vec3d* start,
+                                  Vec3d* velocity,
+                                  float radius,
+                                  float* time,
+                                  Vec3d* contactPoint);
+
+int Collision_sweepSphereCandidates(CollisionMesh* mesh,
+                                    Vec3d* start,
+                                    Vec3d* end,
+                                    float radius,
+                                    int* candidates,
+                                    int candidatesCount,
+                                    SphereSweepCollision* result);
+
 int Collision_testSegmentAABBCollision(Vec3d* p0, Vec3d* p1, AABB* b);
 
 int SpatialHash_unitsToGridForDimension(float unitsPos,
@@ -80,9 +247,23 @@ float SpatialHash_unitsToGridFloatForDimension(float unitsPos,
 float SpatialHash_gridToUnitsForDimension(float unitsPos,
                                           SpatialHash* spatialHash);
 
-SpatialHashBucket* SpatialHash_getBucket(float x,
-                                         float y,
-                                         SpatialHash* spatialHash);
+int SpatialHash_getBucket(float x,
+                          float y,
+                          SpatialHash* spatialHash,
+                          int* resultStart);
+
+unsigned int SpatialHash_getEntry(SpatialHash* spatialHash,
+                                  void* entries,
+                                  int index);
+
+#ifndef __N64__
+int SpatialHash_mapFile(SpatialHash* self, char* filepath);
+#endif
+
+void SpatialHashQueryContext_init(SpatialHashQueryContext* self,
+                                  unsigned int* visitedEpochs,
+                                  int visitedEpochsSize);
+unsigned int SpatialHashQueryContext_nextEpoch(SpatialHashQueryContext* self);
 
 typedef void (*SpatialHashRaycastCallback)(int, int, void*);
 
@@ -99,9 +280,51 @@ int SpatialHash_getTriangles(Vec3d* position,
                              int* results,
                              int maxResults);
 
+int SpatialHash_getTrianglesInCells(int minCellX,
+                                    int minCellY,
+                                    int maxCellX,
+                                    int maxCellY,
+                                    SpatialHash* spatialHash,
+                                    int* results,
+                                    int maxResults);
+
+void SpatialHash_getSweptSphereCells(Vec3d* sweptStart,
+                                     Vec3d* sweptEnd,
+                                     float radius,
+                                     SpatialHash* spatialHash,
+                                     int* minCellX,
+                                     int* minCellY,
+                                     int* maxCellX,
+                                     int* maxCellY);
+
 int SpatialHash_getTrianglesForRaycast(Vec3d* rayStart,
                                        Vec3d* rayEnd,
                                        SpatialHash* spatialHash,
                                        int* results,
                                        int maxResults);
+
+void CollisionCandidateCache_init(CollisionCandidateCache* self);
+
+int CollisionCandidateCache_update(CollisionCandidateCache* self,
+                                   Vec3d* sweptStart,
+                                   Vec3d* sweptEnd,
+                                   float radius,
+                                   SpatialHash* spatialHash);
+
+void CollisionBVH_build(CollisionBVH* self,
+                        Triangle* triangles,
+                        int trianglesLength);
+
+int CollisionBVH_getTriangles(Vec3d* position,
+                              float radius,
+                              CollisionBVH* bvh,
+                              int* results,
+                              int maxResults);
+
+int CollisionBVH_getTrianglesForRaycast(Vec3d* rayStart,
+                                        Vec3d* rayEnd,
+                                        float rayRadius,
+                                        CollisionBVH* bvh,
+                                        int* results,
+                                        int maxResults);
 #endif /* !_COLLISION_H_ */
@@ -11,7 +11,7 @@ double getElapsedTimeMS(void) {
   struct timeval tv;
 
   gettimeofday(&tv, NULL);
-  double curTime = (((long long)tv.tv_sec) * 1000) + (tv.tv_usec / 1000);
+  double curTime = (((long long)tv.tv_sec) * 1000) + (tv.tv_usec / 1000.0);
 
   if (startTime == 0) {
     startTime = curTime;
@@ -103,6 +103,13 @@ out += """
 )
 
 
+# mesh with precomputed per-triangle data
+out += """
+extern CollisionMesh %s_collision_mesh_baked;
+""" % (
+    filename,
+)
+
 out += """
 extern SpatialHash %s_collision_mesh_hash;
 """ % (
@@ -144,40 +151,66 @@ out_c += """
 };
 """
 
-# spatial hash buckets contents
-for bucket_index, bucket in enumerate(spatial_hash_data.buckets):
-    if bucket is not None:
-        out_c += "int %s_collision_mesh_hash_bucket_%d_data[] = {" % (
-            filename,
-            bucket_index,
-        )
-        out_c += ", ".join([str(game_tri_index) for game_tri_index in bucket])
-        out_c += "};\n"
-
-# definition of each bucket with length and ptr to contents
-for bucket_index, bucket in enumerate(spatial_hash_data.buckets):
-    if bucket is not None:
-        out_c += (
-            "SpatialHashBucket %s_collision_mesh_hash_bucket_%d = {%d, (int *)%s_collision_mesh_hash_bucket_%d_data};\n"
-            % (filename, bucket_index, len(bucket), filename, bucket_index)
-        )
+# storage for per-triangle data, which is derived from the triangles at load
+out_c += """
+CollisionMeshTriangle %s_collision_mesh_triangle_data[%s_LENGTH];
 
+CollisionMesh %s_collision_mesh_baked = {
+  %s_collision_mesh, // Triangle* triangles;
+  %s_LENGTH, // int trianglesLength;
+  // filled by CollisionMesh_build() at load
+  %s_collision_mesh_triangle_data, // triangleData;
+};
+""" % (
+    filename,
+    filename.upper(),
+    filename,
+    filename,
+    filename.upper(),
+    filename,
+)
+
+# spatial hash buckets in compressed sparse row form: offsets of each bucket's
+# contents in one packed array of triangle indices
+hash_offsets, hash_triangle_indices = spatial_hash.to_csr(spatial_hash_data)
+hash_wide_indices = spatial_hash.csr_needs_wide_indices(
+    hash_offsets, hash_triangle_indices
+)
+hash_entry_type = "unsigned int" if hash_wide_indices else "unsigned short"
 
-# spatial hash of pointers to buckets (or NULL ptrs)
 out_c += """
-SpatialHashBucket* %s_collision_mesh_hash_data[] = {
+%s %s_collision_mesh_hash_offsets[] = {
+%s
+};
+
+%s %s_collision_mesh_hash_triangles[] = {
+%s
+};
 """ % (
-    filename
+    hash_entry_type,
+    filename,
+    ", ".join([str(offset) for offset in hash_offsets]),
+    hash_entry_type,
+    filename,
+    ", ".join([str(game_tri_index) for game_tri_index in hash_triangle_indices]),
 )
-for bucket_index, bucket in enumerate(spatial_hash_data.buckets):
-    if bucket is None:
-        out_c += "NULL,\n"
-    else:
-        out_c += "&%s_collision_mesh_hash_bucket_%d,\n" % (filename, bucket_index)
 
+# per-triangle visited stamps used to dedup spatial hash query results
 out_c += """
+unsigned int %s_collision_mesh_hash_visited[%s_LENGTH];
+
+SpatialHashQueryContext %s_collision_mesh_hash_query = {
+  0, // unsigned int epoch;
+  %s_collision_mesh_hash_visited, // visitedEpochs;
+  %s_LENGTH, // visitedEpochsSize;
 };
-"""
+""" % (
+    filename,
+    filename.upper(),
+    filename,
+    filename,
+    filename.upper(),
+)
 
 out_c += """
 SpatialHash %s_collision_mesh_hash = {
@@ -185,7 +218,10 @@ SpatialHash %s_collision_mesh_hash = {
   %f, // float gridCellSize;
   %d, // int cellsInDimension;
   %d, // int cellOffsetInDimension;
-  %s_collision_mesh_hash_data, // int* data;
+  %d, // int wideIndices;
+  %s_collision_mesh_hash_offsets, // void* bucketOffsets;
+  %s_collision_mesh_hash_triangles, // void* triangleIndices;
+  &%s_collision_mesh_hash_query, // queryContext;
 };
 """ % (
     filename,
@@ -193,6 +229,9 @@ SpatialHash %s_collision_mesh_hash = {
     spatial_hash_data.cell_width,
     spatial_hash_data.cells_in_dimension,
     spatial_hash_data.cell_offset_in_dimension,
+    1 if hash_wide_indices else 0,
+    filename,
+    filename,
     filename,
 )
 
@@ -200,6 +239,9 @@ out_c_file = open(filename + ".c", "w")
 out_c_file.write(out_c)
 out_c_file.close()
 
+# same hash, for the desktop build to load at runtime
+spatial_hash.write_binary(spatial_hash_data, filename + "_hash.bin")
+
 print("successfully exported", filename)
 
 
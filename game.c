@@ -12,6 +12,7 @@
 #endif
 
 #include <stdlib.h>
+#include <string.h>
 #ifdef __N64__
 #include <malloc.h>
 #endif
@@ -21,7 +22,9 @@
 #include "constants.h"
 #include "game.h"
 #include "gameobject.h"
+#include "gameobjectgrid.h"
 #include "gameutils.h"
+#include "inputrecording.h"
 #include "item.h"
 #include "modeltype.h"
 #include "player.h"
@@ -31,185 +34,425 @@
 #include "constants.h"
 
 #define GENERATE_DEBUG_BODIES 0
+// world triangles tested by Game_isSegmentUnobstructed()
+#define GAME_SEGMENT_MAX_TRIANGLES 100
+// how many nodes path searches can expand each tick, between all the
+// characters. it's a node count rather than a time limit so the simulation
+// does the same thing every time it's run
+#define GAME_PATHFINDING_BUDGET 64
 
-static Game game;
 
-void Game_initGameObjectPhysBody(PhysBody* body, GameObject* obj) {
+void Game_initGameObjectPhysBody(PhysBody* body,
+                                 PhysWorld* world,
+                                 GameObject* obj) {
   Vec3d objCenter;
   Game_getObjCenter(obj, &objCenter);
-  PhysBody_init(body, modelTypesProperties[obj->modelType].mass,
+  PhysBody_init(body, world, modelTypesProperties[obj->modelType].mass,
                 modelTypesProperties[obj->modelType].radius, &objCenter,
                 obj->id);
   obj->physBody = body;
 }
 
-void Game_init(GameObject* worldObjects,
+static int Game_getObjectGroup(GameObject* obj, int byCategory) {
+  return byCategory ? modelTypesProperties[obj->modelType].category
+                    : obj->modelType;
+}
+
+// counting sort of the world objects by model type or category, which keeps
+// them in id order within each group
+static GameObject** Game_groupObjects(Game* game,
+                                      int byCategory,
+                                      int* offsets,
+                                      int groupsCount) {
+  int i, group;
+  GameObject** grouped;
+  GameObject* obj;
+
+  grouped =
+      (GameObject**)malloc(game->worldObjectsCount * sizeof(GameObject*));
+  invariant(grouped);
+  for (i = 0; i <= groupsCount; i++) {
+    offsets[i] = 0;
+  }
+  for (i = 0, obj = game->worldObjects; i < game->worldObjectsCount;
+       i++, obj++) {
+    offsets[Game_getObjectGroup(obj, byCategory) + 1]++;
+  }
+  for (i = 0; i < groupsCount; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+  for (i = 0, obj = game->worldObjects; i < game->worldObjectsCount;
+       i++, obj++) {
+    group = Game_getObjectGroup(obj, byCategory);
+    // offsets[group] is used as the insertion point, then restored below
+    grouped[offsets[group]++] = obj;
+  }
+  for (i = groupsCount; i > 0; i--) {
+    offsets[i] = offsets[i - 1];
+  }
+  offsets[0] = 0;
+  return grouped;
+}
+
+void Game_init(Game* game,
+               GameObject* worldObjects,
                int worldObjectsCount,
                PhysWorldData* physWorldData) {
   int i, initIndex, itemsCount, physicsBodiesCount, charactersCount;
   GameObject* goose;
   GameObject* obj;
+  GameObject** categoryObjects;
 
   Character* characters;
   Item* items;
   PhysBody* physicsBodies;
 
-  game.paused = FALSE;
-  game.worldObjects = worldObjects;
-  game.worldObjectsCount = worldObjectsCount;
+  game->tick = 0;
+  game->paused = FALSE;
+  // queries collect objects into arrays of MAX_WORLD_OBJECTS
+  invariant(worldObjectsCount <= MAX_WORLD_OBJECTS);
+  game->worldObjects = worldObjects;
+  game->worldObjectsCount = worldObjectsCount;
 
   // init world objects loaded from map data
-  for (i = 0, obj = game.worldObjects; i < game.worldObjectsCount; i++, obj++) {
+  for (i = 0, obj = game->worldObjects; i < game->worldObjectsCount;
+       i++, obj++) {
     obj->animState = NULL;
     obj->visible = TRUE;
     obj->solid = TRUE;
   }
+  game->objectsByType = Game_groupObjects(
+      game, FALSE, game->objectsByTypeOffsets, MAX_MODEL_TYPE);
+  game->objectsByCategory = Game_groupObjects(
+      game, TRUE, game->objectsByCategoryOffsets, MAX_MODEL_TYPE_CATEGORY);
+  GameObjectGrid_init(&game->objectGrid, game->worldObjects,
+                      game->worldObjectsCount);
 
   // camera
-  Vec3d_init(&game.viewPos, 0.0F, 0.0F, -400.0F);
-  Vec3d_init(&game.viewRot, 0.0F, 0.0F, 0.0F);
-  game.viewZoom = 2.0f;
-  game.freeView = 0;
+  Vec3d_init(&game->viewPos, 0.0F, 0.0F, -400.0F);
+  Vec3d_init(&game->viewRot, 0.0F, 0.0F, 0.0F);
+  game->viewZoom = 2.0f;
+  game->freeView = 0;
 
-  goose = Game_findObjectByType(GooseModel);
+  goose = Game_findObjectByType(game, GooseModel);
   invariant(goose != NULL);
 
-  Player_init(&game.player, goose);
-  PhysState_init(&game.physicsState, physWorldData);
+  Player_init(&game->player, goose);
+  PhysState_init(&game->physicsState, physWorldData);
 
   // setup camera
-  Vec3d_copyFrom(&game.viewTarget, &game.player.goose->position);
+  Vec3d_copyFrom(&game->viewTarget, &game->player.goose->position);
 
   // TODO: move these to be statically allocated per map?
-  itemsCount = Game_countObjectsInCategory(ItemModelType);
+  itemsCount = Game_countObjectsInCategory(game, ItemModelType);
   items = (Item*)malloc(itemsCount * sizeof(Item));
   invariant(items);
-  initIndex = 0;
-  for (i = 0; i < game.worldObjectsCount; ++i) {
-    obj = game.worldObjects + i;
-    if (modelTypesProperties[obj->modelType].category == ItemModelType) {
-      invariant(initIndex < itemsCount);
-      Item_init(items + initIndex, obj, &game);
-      initIndex++;
-    }
+  categoryObjects = game->objectsByCategory +
+                    game->objectsByCategoryOffsets[ItemModelType];
+  for (i = 0; i < itemsCount; ++i) {
+    Item_init(items + i, categoryObjects[i], game);
   }
 
-  charactersCount = Game_countObjectsInCategory(CharacterModelType);
+  charactersCount = Game_countObjectsInCategory(game, CharacterModelType);
   characters = (Character*)malloc(charactersCount * sizeof(Character));
   invariant(characters);
-  initIndex = 0;
-  for (i = 0; i < game.worldObjectsCount; ++i) {
-    obj = game.worldObjects + i;
-    if (modelTypesProperties[obj->modelType].category == CharacterModelType) {
-      invariant(initIndex < charactersCount);
-      Character_init(characters + initIndex,
-                     Game_findObjectByType(GardenerCharacterModel),
-                     /*book*/ &items[0],  // TODO: make items owned by character
-                     &game);
-      initIndex++;
-    }
+  for (i = 0; i < charactersCount; ++i) {
+    Character_init(characters + i,
+                   Game_findObjectByType(game, GardenerCharacterModel),
+                   /*book*/ &items[0],  // TODO: make items owned by character
+                   game);
   }
 
   physicsBodiesCount = 0;
 #if GENERATE_DEBUG_BODIES
   for (i = 0; i < NUM_PHYS_BODIES; ++i) {
     Vec3d_init(&pos, RAND(200), RAND(10) + 10, RAND(200));
-    PhysBody_init(&physicsBodies[i],
+    PhysBody_init(&physicsBodies[i], &game->physicsWorld,
                   /* mass */ 10.0,
                   /* radius */ 20.0, &pos, i);
     physicsBodiesCount++;
   }
 #else
   physicsBodiesCount = itemsCount + charactersCount +
-                       Game_countObjectsInCategory(PlayerModelType);
+                       Game_countObjectsInCategory(game, PlayerModelType);
   physicsBodies = (PhysBody*)malloc(physicsBodiesCount * sizeof(PhysBody));
   invariant(physicsBodies);
+  PhysWorld_init(&game->physicsWorld, physicsBodiesCount);
   initIndex = 0;
-  for (i = 0; i < game.worldObjectsCount; ++i) {
-    obj = game.worldObjects + i;
+  for (i = 0; i < game->worldObjectsCount; ++i) {
+    obj = game->worldObjects + i;
     {
       ModelTypeCategory category =
           modelTypesProperties[obj->modelType].category;
       if (category == ItemModelType || category == CharacterModelType ||
           category == PlayerModelType) {
         invariant(initIndex < physicsBodiesCount);
-        Game_initGameObjectPhysBody(physicsBodies + initIndex, obj);
+        Game_initGameObjectPhysBody(physicsBodies + initIndex,
+                                    &game->physicsWorld, obj);
         initIndex++;
       }
     }
   }
 #endif
+  PhysBroadphase_init(&game->physicsState.broadphase, physicsBodiesCount);
+  // now the objects have their physics bodies
+  for (i = 0, obj = game->worldObjects; i < game->worldObjectsCount;
+       i++, obj++) {
+    GameObject_bakeFlags(obj);
+  }
 
-  game.items = items;
-  game.itemsCount = itemsCount;
-  game.characters = characters;
-  game.charactersCount = charactersCount;
-  game.physicsBodies = physicsBodies;
-  game.physicsBodiesCount = physicsBodiesCount;
-
-  game.pathfindingGraph = NULL;
-  game.pathfindingState = NULL;
+  game->items = items;
+  game->itemsCount = itemsCount;
+  game->characters = characters;
+  game->charactersCount = charactersCount;
+  game->physicsBodies = physicsBodies;
+  game->physicsBodiesCount = physicsBodiesCount;
+
+  game->pathfindingGraph = NULL;
+  game->pathfindingState = NULL;
+  game->pathSearchCharacter = -1;
+  game->pathSearchRequestedTick = 0;
+  game->pathfindingBudgetPerTick = GAME_PATHFINDING_BUDGET;
+  game->pathfindingBudget = GAME_PATHFINDING_BUDGET;
+  game->pathSearchesSuspended = 0;
+  game->pathSearchesAbandoned = 0;
+  game->pathSearchWaits = 0;
+  game->characterPaths = NULL;
+  game->pathCache.results = NULL;
+  game->pathNodeGrid.cellStarts = NULL;
+  game->pathNodeGrid.candidateDistances = NULL;
+
+  game->profTimeCharacters = 0;
+  game->profTimePhysics = 0;
+  game->profTimeDraw = 0;
+  game->profTimePath = 0;
+}
 
-  game.profTimeCharacters = 0;
-  game.profTimePhysics = 0;
-  game.profTimeDraw = 0;
-  game.profTimePath = 0;
+// frees what Game_init() allocated. the world objects belong to the caller
+void Game_destroy(Game* game) {
+  free(game->items);
+  free(game->characters);
+  free(game->physicsBodies);
+  PhysWorld_destroy(&game->physicsWorld);
+  free(game->objectsByType);
+  free(game->objectsByCategory);
+  GameObjectGrid_destroy(&game->objectGrid);
+  PhysBroadphase_destroy(&game->physicsState.broadphase);
+  free(game->characterPaths);
+  PathCache_destroy(&game->pathCache);
+  PathNodeGrid_destroy(&game->pathNodeGrid);
 }
 
-// TODO: not used yet, but if we have map transitions we might want this
-void Game_destroy() {
-  free(game.items);
-  free(game.characters);
-  free(game.physicsBodies);
+// sets the graph characters find paths on, and the state used for the search
+// in progress. each character gets room for its own copy of the path
+// it's following, so characters don't overwrite each other's paths
+void Game_initPathfinding(Game* game, Graph* graph, PathfindingState* state) {
+  int i;
+  Character* character;
+
+  invariant(!game->characterPaths);
+  game->pathfindingGraph = graph;
+  game->pathfindingState = state;
+  game->characterPaths =
+      (int*)malloc(game->charactersCount * graph->size * sizeof(int));
+  invariant(game->characterPaths || !game->charactersCount);
+  for (i = 0, character = game->characters; i < game->charactersCount;
+       i++, character++) {
+    character->pathfindingResult = NULL;
+    character->path.result = game->characterPaths + i * graph->size;
+    character->path.resultSize = 0;
+  }
+  PathCache_init(&game->pathCache, graph->size);
+  PathNodeGrid_init(&game->pathNodeGrid, graph);
 }
 
-Game* Game_get() {
-  return &game;
+// finds a path between two nodes for a character and copies it into the
+// character's path. recent searches are answered from the path cache. other
+// searches are done one at a time, pathfindingBudgetPerTick nodes per tick
+// between all the characters, so a long search is spread over several ticks.
+// returns PathSearchInProgress until the character's search is done, and the
+// character has to keep asking for the path until then
+PathSearchStatus Game_findPath(Game* game,
+                               Character* character,
+                               int from,
+                               int to) {
+  int i, characterIndex, expanded, continuing;
+  Graph* graph;
+  PathfindingState* search;
+  PathfindingState* path;
+  PathCacheEntry* entry;
+  PathSearchStatus status;
+  float profStartPathfinding;
+
+  graph = game->pathfindingGraph;
+  search = game->pathfindingState;
+  path = &character->path;
+  characterIndex = character - game->characters;
+  // the character's own search carries on, rather than starting again
+  // whenever the character walks closer to another node
+  continuing =
+      game->pathSearchCharacter == characterIndex && search->end->id == to;
+  entry = continuing ? NULL : PathCache_find(&game->pathCache, from, to);
+  if (!entry) {
+    if (continuing) {
+      from = search->start->id;
+    } else if (game->pathSearchCharacter != -1 &&
+               game->pathSearchCharacter != characterIndex &&
+               game->pathSearchRequestedTick + 1 >= game->tick) {
+      // wait for another character's search to finish
+      game->pathSearchWaits++;
+      return PathSearchInProgress;
+    } else {
+      // start a new search, abandoning any search nobody's waiting for
+      if (game->pathSearchCharacter != -1) {
+        game->pathSearchesAbandoned++;
+      }
+      Path_initState(graph,                          // graph
+                     search,                         // state
+                     Path_getNodeByID(graph, from),  // start
+                     Path_getNodeByID(graph, to),    // end
+                     search->nodeStates,             // nodeStates array
+                     search->nodeStateSize,          // nodeStateSize
+                     search->openList,               // open list array
+                     search->result                  // results array
+      );
+      Path_startAStar(graph, search);
+      game->pathSearchCharacter = characterIndex;
+    }
+
+    profStartPathfinding = CUR_TIME_MS();
+    expanded = search->expanded;
+    status = Path_continueAStar(graph, search, game->pathfindingBudget);
+    game->pathfindingBudget -= search->expanded - expanded;
+    Trace_addEvent(PathfindingTraceEvent, profStartPathfinding, CUR_TIME_MS());
+
+    if (status == PathSearchInProgress) {
+      game->pathSearchRequestedTick = game->tick;
+      game->pathSearchesSuspended++;
+      game->pathSearchWaits++;
+      return PathSearchInProgress;
+    }
+    game->pathSearchCharacter = -1;
+    entry = PathCache_add(&game->pathCache, from, to, status == PathSearchFound,
+                          search->result, search->resultSize);
+  }
+
+  path->start = Path_getNodeByID(graph, from);
+  path->end = Path_getNodeByID(graph, to);
+  path->resultSize = entry->resultSize;
+  for (i = 0; i < entry->resultSize; i++) {
+    path->result[i] = entry->result[i];
+  }
+  return entry->found ? PathSearchFound : PathSearchFailed;
 }
 
-GameObject* Game_getObjectByID(int id) {
-  invariant(id < game.worldObjectsCount);
-  return game.worldObjects + id;
+// call after changing the pathfinding graph, so paths are searched for again.
+// characters keep following the paths they already have
+void Game_invalidatePaths(Game* game) {
+  PathCache_invalidate(&game->pathCache);
 }
 
-int Game_countObjectsInCategory(ModelTypeCategory category) {
-  int i;
-  int count = 0;
+// whether a sphere of the radius could go in a straight line from start to end
+// without hitting the world mesh. tests the segment against the bounds of the
+// triangles along it, grown by the radius on x and z
+int Game_isSegmentUnobstructed(Game* game,
+                               Vec3d* start,
+                               Vec3d* end,
+                               float radius) {
+  int triangles[GAME_SEGMENT_MAX_TRIANGLES];
+  int trianglesCount, i;
+  AABB triangleAABB;
+  PhysWorldData* worldData;
+
+  worldData = game->physicsState.worldData;
+  if (worldData->worldMeshBVH) {
+    trianglesCount = CollisionBVH_getTrianglesForRaycast(
+        start, end, radius, worldData->worldMeshBVH, triangles,
+        GAME_SEGMENT_MAX_TRIANGLES);
+  } else {
+    trianglesCount = SpatialHash_getTrianglesForRaycast(
+        start, end, worldData->worldMeshSpatialHash, triangles,
+        GAME_SEGMENT_MAX_TRIANGLES);
+  }
+
+  for (i = 0; i < trianglesCount; i++) {
+    triangleAABB = worldData->worldMesh->triangleData[triangles[i]].aabb;
 
-  for (i = 0; i < game.worldObjectsCount; i++) {
-    if (modelTypesProperties[(game.worldObjects + i)->modelType].category ==
-        category) {
-      count++;
+    triangleAABB.min.x -= radius;
+    triangleAABB.min.z -= radius;
+
+    triangleAABB.max.x += radius;
+    triangleAABB.max.z += radius;
+    if (Collision_testSegmentAABBCollision(start, end, &triangleAABB)) {
+      return FALSE;
     }
   }
-  return count;
+  return TRUE;
 }
 
-// finds the first object with a particular modeltype
-GameObject* Game_findObjectByType(ModelType modelType) {
-  int i;
-  GameObject* obj;
+static int Game_isNodeUnobstructed(Node* node, Vec3d* position, void* game) {
+  return Game_isSegmentUnobstructed((Game*)game, position, &node->position,
+                                    0.0f);
+}
 
-  for (i = 0, obj = game.worldObjects; i < game.worldObjectsCount; i++, obj++) {
-    if (obj->modelType == modelType) {
-      return obj;
-    }
+// the pathfinding node closest to a position. if unobstructed is set, nodes
+// which can't be reached in a straight line from the position are skipped
+// (unless none can be)
+int Game_quantizePosition(Game* game, Vec3d* position, int unobstructed) {
+  int nodeID;
+
+  if (unobstructed &&
+      PathNodeGrid_getNearest(&game->pathNodeGrid, position, 1,
+                              Game_isNodeUnobstructed, game, &nodeID)) {
+    return nodeID;
   }
-  return NULL;
+  return PathNodeGrid_quantizePosition(&game->pathNodeGrid, position);
 }
-GameObject* Game_findObjectNByType(ModelType modelType, int n) {
-  int i, found;
-  GameObject* obj;
 
-  found = 0;
+GameObject* Game_getObjectByID(Game* game, int id) {
+  invariant(id < game->worldObjectsCount);
+  return game->worldObjects + id;
+}
 
-  for (i = 0, obj = game.worldObjects; i < game.worldObjectsCount; i++, obj++) {
-    if (obj->modelType == modelType) {
-      if (found < n) {
-        found++;
-      } else {
-        return obj;
-      }
+int Game_countObjectsInCategory(Game* game, ModelTypeCategory category) {
+  return game->objectsByCategoryOffsets[category + 1] -
+         game->objectsByCategoryOffsets[category];
+}
+
+// finds the first object with a particular modeltype
+GameObject* Game_findObjectByType(Game* game, ModelType modelType) {
+  return Game_findObjectNByType(game, modelType, 0);
+}
+
+GameObject* Game_findObjectNByType(Game* game, ModelType modelType, int n) {
+  int index;
+
+  index = game->objectsByTypeOffsets[modelType] + n;
+  if (index >= game->objectsByTypeOffsets[modelType + 1]) {
+    return NULL;
+  }
+  return game->objectsByType[index];
+}
+
+// the item for an object, or NULL if it isn't one. items are created in the
+// same order as the item objects are indexed, so this is a binary search
+Item* Game_getItemForObject(Game* game, GameObject* obj) {
+  int low, high, mid;
+  GameObject** itemObjects;
+
+  itemObjects =
+      game->objectsByCategory + game->objectsByCategoryOffsets[ItemModelType];
+  low = 0;
+  high = game->itemsCount - 1;
+  while (low <= high) {
+    mid = (low + high) / 2;
+    if (itemObjects[mid] == obj) {
+      return game->items + mid;
+    }
+    if (itemObjects[mid] < obj) {
+      low = mid + 1;
+    } else {
+      high = mid - 1;
     }
   }
   return NULL;
@@ -217,7 +460,7 @@ GameObject* Game_findObjectNByType(ModelType modelType, int n) {
 
 void Game_updateCamera(Game* game, Input* input) {
   float cameraDist;
-  Vec3d cameraOffset;
+  Vec3d cameraOffset, goosePosition;
   float desiredZoom, desiredZoomDist;
 
   // spring to desired zoom level
@@ -237,82 +480,591 @@ void Game_updateCamera(Game* game, Input* input) {
   cameraDist = 2500.0f / game->viewZoom;  // 15deg fov
   Vec3d_mulScalar(&cameraOffset, cameraDist);
 
-  Vec3d_copyFrom(&game->viewPos, &game->player.goose->position);
+  // follow the goose where it's drawn, rather than where it was simulated
+  Game_getObjInterpolatedPosition(game, game->player.goose, &goosePosition);
+  Vec3d_copyFrom(&game->viewPos, &goosePosition);
   Vec3d_add(&game->viewPos, &cameraOffset);
 
   // look at goose
-  Vec3d_copyFrom(&game->viewTarget, &game->player.goose->position);
+  Vec3d_copyFrom(&game->viewTarget, &goosePosition);
+}
+
+// where to draw an object, between its positions after the last two fixed
+// steps. objects without physics bodies don't move between steps
+void Game_getObjInterpolatedPosition(Game* game,
+                                     GameObject* obj,
+                                     Vec3d* result) {
+  PhysBody* body;
+  Vec3d position;
+
+  body = obj->physBody;
+  if (!body) {
+    *result = obj->position;
+    return;
+  }
+  PhysBody_getPrevStepPosition(body, result);
+  PhysBody_getPosition(body, &position);
+  Vec3d_lerp(result, &position,
+             PhysState_getInterpolationAlpha(&game->physicsState));
+  Vec3d_sub(result, &modelTypesProperties[obj->modelType].centroidOffset);
 }
 
 void Game_updatePhysics(Game* game) {
   int i;
-  Vec3d positionDelta, physUpdatedPosition;
   PhysBody* body;
   GameObject* obj;
-  // for now we need to copy the object's pos to the
-  // physbody...
-  for (i = 0, body = game->physicsBodies; i < game->physicsBodiesCount;
-       ++i, body++) {
-    obj = Game_getObjectByID(body->id);
 
-    Game_getObjCenter(obj, &positionDelta);
-    Vec3d_sub(&positionDelta, &body->position);
-    PhysBody_translateWithoutForce(body, &positionDelta);
-  }
+  // objects move their bodies along with them (see GameObject_translate()),
+  // so the bodies are already where the game put the objects
+  PhysState_fixedStep(&game->physicsState, game->physicsBodies,
+                      game->physicsBodiesCount);
 
-  // simulate physics
-  PhysState_step(&game->physicsState, game->physicsBodies,
-                 game->physicsBodiesCount, (float)game->tick / 60.0f * 1000.0f);
-
-  // ...and copy its position back again
+  // copy back the positions of the bodies which physics moved, and refile
+  // every object with a body in the grid, as the game may have moved them too
   for (i = 0, body = game->physicsBodies; i < game->physicsBodiesCount;
        ++i, body++) {
-    obj = Game_getObjectByID(body->id);
-    obj->position = body->position;
+    obj = Game_getObjectByID(game, body->id);
+    if (body->moved) {
+      PhysBody_getPosition(body, &obj->position);
+      Vec3d_sub(&obj->position,
+                &modelTypesProperties[obj->modelType].centroidOffset);
+    }
+    GameObjectGrid_update(&game->objectGrid, obj);
+  }
+}
 
-    Vec3d_copyFrom(&physUpdatedPosition, &body->position);
-    Vec3d_sub(&physUpdatedPosition,
-              &modelTypesProperties[obj->modelType].centroidOffset);
-    Vec3d_copyFrom(&obj->position, &physUpdatedPosition);
+// fnv-1a hash of the object positions and character states, which is enough to
+// notice when a replay diverges from its recording. hashes the float bits
+// rather than the bytes so it doesn't depend on the platform's endianness
+unsigned int Game_hashState(Game* game) {
+  unsigned int hash, value;
+  int i, k, w;
+  union {
+    float f;
+    unsigned int u;
+  } bits[3];
+
+  hash = 2166136261u;
+  for (i = 0; i < game->worldObjectsCount; i++) {
+    bits[0].f = game->worldObjects[i].position.x;
+    bits[1].f = game->worldObjects[i].position.y;
+    bits[2].f = game->worldObjects[i].position.z;
+    for (w = 0; w < 3; w++) {
+      for (k = 0; k < 4; k++) {
+        hash = (hash ^ ((bits[w].u >> (k * 8)) & 0xff)) * 16777619u;
+      }
+    }
+  }
+  for (i = 0; i < game->charactersCount; i++) {
+    value = game->characters[i].state;
+    for (k = 0; k < 4; k++) {
+      hash = (hash ^ ((value >> (k * 8)) & 0xff)) * 16777619u;
+    }
   }
+  return hash;
 }
 
-void Game_update(Input* input) {
-  Game* game;
+// one fixed timestep of game logic and physics
+void Game_tick(Game* game, Input* input) {
   int i;
   float profStartPhysics, profStartCharacters, profEndPhysics,
       profEndCharacters;
 
-  game = Game_get();
+  game->tick++;
+  game->pathfindingBudget = game->pathfindingBudgetPerTick;
+  PhysState_saveStepPositions(game->physicsBodies, game->physicsBodiesCount);
 
-  if (!game->paused) {
-    game->tick++;
+  profStartCharacters = CUR_TIME_MS();
+  for (i = 0; i < game->charactersCount; ++i) {
+    Character_update(&game->characters[i], game);
+  }
+  profEndCharacters = CUR_TIME_MS();
+  Trace_addEvent(CharactersUpdateTraceEvent, profStartCharacters,
+                 profEndCharacters);
+  Player_update(&game->player, input, game);
+
+  profStartPhysics = CUR_TIME_MS();
+  Game_updatePhysics(game);
+  profEndPhysics = CUR_TIME_MS();
+  Trace_addEvent(PhysUpdateTraceEvent, profStartPhysics, profEndPhysics);
+
+  // update windowed (eg. 60 frame) aggregations
+  game->profTimePhysics += profEndPhysics - profStartPhysics;
+  game->profTimeCharacters += profEndCharacters - profStartCharacters;
+
+  if (InputRecording_isRecording()) {
+    InputRecording_recordTick(input, Game_hashState(game));
+  }
+}
 
-    profStartCharacters = CUR_TIME_MS();
-    for (i = 0; i < game->charactersCount; ++i) {
-      Character_update(&game->characters[i], game);
-    }
-    profEndCharacters = CUR_TIME_MS();
-    Trace_addEvent(CharactersUpdateTraceEvent, profStartCharacters,
-                   profEndCharacters);
-    Player_update(&game->player, input, game);
+// runs as many fixed timesteps as have elapsed by now (in milliseconds), so the
+// game runs at the same speed whatever the frame rate
+void Game_update(Game* game, Input* input, float now) {
+  int i, steps;
 
-    profStartPhysics = CUR_TIME_MS();
-    Game_updatePhysics(game);
-    profEndPhysics = CUR_TIME_MS();
-    Trace_addEvent(PhysUpdateTraceEvent, profStartPhysics, profEndPhysics);
+  if (!game->paused) {
+    steps = PhysState_advanceClock(&game->physicsState, now);
+    for (i = 0; i < steps; i++) {
+      Game_tick(game, input);
+    }
 
     Game_updateCamera(game, input);
-
-    // update windowed (eg. 60 frame) aggregations
-    game->profTimePhysics += profEndPhysics - profStartPhysics;
-    game->profTimeCharacters += profEndCharacters - profStartCharacters;
+  } else {
+    // don't simulate the time spent paused when unpausing
+    game->physicsState.clock = now;
   }
 
   // reset inputs
   Input_init(input);
 }
 
+// snapshots hold the mutable game state: the tick and camera, the player, the
+// physics clock and stats, and copies of the world objects, items, characters,
+// physics bodies and their motion state, the paths characters are following,
+// the path search in progress and the path cache, which decides how soon
+// searches finish. pointers are stored as indices into those arrays, so a
+// snapshot doesn't depend on where they are. the map data, physics world data,
+// object grid, path node grid and worker threads aren't part of the snapshot
+typedef struct GameSnapshotHeader {
+  int size;  // bytes, to check a snapshot matches the game it's restored into
+  int worldObjectsCount;
+  int itemsCount;
+  int charactersCount;
+  int physicsBodiesCount;
+  int pathCapacity;  // of each character's path
+  Game game;  // pointers in game.player are stored as indices
+  PathfindingState search;  // node pointers are stored as indices
+} GameSnapshotHeader;
+
+// sections start on 8 byte boundaries, for the structs containing Mtx
+#define GAME_SNAPSHOT_ALIGN(size) (((size) + 7) & ~7)
+// stored in place of a pointer to something owned by the player, where a
+// character index would otherwise be
+#define GAME_SNAPSHOT_PLAYER_INDEX -2
+
+typedef struct GameSnapshotLayout {
+  int worldObjectsOffset;
+  int itemsOffset;
+  int charactersOffset;
+  int physicsBodiesOffset;
+  int physicsWorldOffset;
+  int pathResultOffset;
+  int searchNodeStatesOffset;
+  int searchOpenListOffset;
+  int pathCacheResultsOffset;
+  int size;
+} GameSnapshotLayout;
+
+static void* Game_indexToSnapshotPointer(int index) {
+  return (void*)(long)index;
+}
+
+static int Game_snapshotPointerToIndex(void* pointer) {
+  return (int)(long)pointer;
+}
+
+static int Game_getPathCapacity(Game* game) {
+  return game->characterPaths ? game->pathfindingGraph->size : 0;
+}
+
+static void Game_getSnapshotLayout(Game* game, GameSnapshotLayout* layout) {
+  int offset;
+
+  offset = GAME_SNAPSHOT_ALIGN(sizeof(GameSnapshotHeader));
+  layout->worldObjectsOffset = offset;
+  offset += GAME_SNAPSHOT_ALIGN(game->worldObjectsCount * sizeof(GameObject));
+  layout->itemsOffset = offset;
+  offset += GAME_SNAPSHOT_ALIGN(game->itemsCount * sizeof(Item));
+  layout->charactersOffset = offset;
+  offset += GAME_SNAPSHOT_ALIGN(game->charactersCount * sizeof(Character));
+  layout->physicsBodiesOffset = offset;
+  offset += GAME_SNAPSHOT_ALIGN(game->physicsBodiesCount * sizeof(PhysBody));
+  layout->physicsWorldOffset = offset;
+  offset += GAME_SNAPSHOT_ALIGN(game->physicsWorld.bufferSize);
+  layout->pathResultOffset = offset;
+  offset += GAME_SNAPSHOT_ALIGN(game->charactersCount *
+                                Game_getPathCapacity(game) * sizeof(int));
+  layout->searchNodeStatesOffset = offset;
+  offset +=
+      GAME_SNAPSHOT_ALIGN(Game_getPathCapacity(game) * sizeof(NodeState));
+  layout->searchOpenListOffset = offset;
+  offset += GAME_SNAPSHOT_ALIGN(Game_getPathCapacity(game) * sizeof(int));
+  layout->pathCacheResultsOffset = offset;
+  offset += GAME_SNAPSHOT_ALIGN(PATH_CACHE_SIZE * Game_getPathCapacity(game) *
+                                sizeof(int));
+  layout->size = offset;
+}
+
+static int Game_getObjectIndex(Game* game, GameObject* obj) {
+  return obj ? obj - game->worldObjects : -1;
+}
+
+static int Game_getItemIndex(Game* game, Item* item) {
+  return item ? item - game->items : -1;
+}
+
+static int Game_getPhysBodyIndex(Game* game, PhysBody* body) {
+  return body ? body - game->physicsBodies : -1;
+}
+
+static int Game_getNodeIndex(Game* game, Node* node) {
+  return node ? node - game->pathfindingGraph->nodes : -1;
+}
+
+static Node* Game_getNodeByIndex(Game* game, int index) {
+  return index == -1 ? NULL : &game->pathfindingGraph->nodes[index];
+}
+
+static int Game_getItemHolderIndex(Game* game, ItemHolder* holder) {
+  if (!holder) {
+    return -1;
+  }
+  if (holder == &game->player.itemHolder) {
+    return GAME_SNAPSHOT_PLAYER_INDEX;
+  }
+  return (Character*)holder->owner - game->characters;
+}
+
+static int Game_getAnimStateIndex(Game* game, AnimationState* animState) {
+  int i;
+
+  if (!animState) {
+    return -1;
+  }
+  if (animState == &game->player.animState) {
+    return GAME_SNAPSHOT_PLAYER_INDEX;
+  }
+  for (i = 0; i < game->charactersCount; i++) {
+    if (animState == &game->characters[i].animState) {
+      return i;
+    }
+  }
+  invariant(FALSE);
+  return -1;
+}
+
+static ItemHolder* Game_getItemHolderByIndex(Game* game, int index) {
+  if (index == -1) {
+    return NULL;
+  }
+  if (index == GAME_SNAPSHOT_PLAYER_INDEX) {
+    return &game->player.itemHolder;
+  }
+  return &game->characters[index].itemHolder;
+}
+
+static AnimationState* Game_getAnimStateByIndex(Game* game, int index) {
+  if (index == -1) {
+    return NULL;
+  }
+  if (index == GAME_SNAPSHOT_PLAYER_INDEX) {
+    return &game->player.animState;
+  }
+  return &game->characters[index].animState;
+}
+
+static void Game_snapshotItemHolder(Game* game, ItemHolder* holder) {
+  // the owner is always the player or character the holder is part of
+  holder->owner = NULL;
+  holder->heldItem = (Item*)Game_indexToSnapshotPointer(
+      Game_getItemIndex(game, holder->heldItem));
+}
+
+static void Game_restoreItemHolder(Game* game,
+                                   ItemHolder* holder,
+                                   void* owner) {
+  holder->owner = owner;
+  holder->heldItem = Game_snapshotPointerToIndex(holder->heldItem) == -1
+                         ? NULL
+                         : &game->items[Game_snapshotPointerToIndex(
+                               holder->heldItem)];
+}
+
+int Game_getSnapshotSize(Game* game) {
+  GameSnapshotLayout layout;
+
+  Game_getSnapshotLayout(game, &layout);
+  return layout.size;
+}
+
+// copies the game state into the buffer, which must be at least
+// Game_getSnapshotSize() bytes and 8 byte aligned. returns the number of bytes
+// written, or 0 if the buffer is too small
+int Game_snapshot(Game* game, void* buffer, int bufferSize) {
+  int i, j;
+  GameSnapshotLayout layout;
+  GameSnapshotHeader* header;
+  GameObject* objects;
+  Item* items;
+  Character* characters;
+  PhysBody* bodies;
+  int* pathResult;
+  NodeState* searchNodeStates;
+  int* searchOpenList;
+  int* pathCacheResults;
+  PathfindingState* search;
+
+  Game_getSnapshotLayout(game, &layout);
+  if (bufferSize < layout.size) {
+    return 0;
+  }
+
+  header = (GameSnapshotHeader*)buffer;
+  objects = (GameObject*)((char*)buffer + layout.worldObjectsOffset);
+  items = (Item*)((char*)buffer + layout.itemsOffset);
+  characters = (Character*)((char*)buffer + layout.charactersOffset);
+  bodies = (PhysBody*)((char*)buffer + layout.physicsBodiesOffset);
+  pathResult = (int*)((char*)buffer + layout.pathResultOffset);
+  searchNodeStates =
+      (NodeState*)((char*)buffer + layout.searchNodeStatesOffset);
+  searchOpenList = (int*)((char*)buffer + layout.searchOpenListOffset);
+  pathCacheResults = (int*)((char*)buffer + layout.pathCacheResultsOffset);
+
+  header->size = layout.size;
+  header->worldObjectsCount = game->worldObjectsCount;
+  header->itemsCount = game->itemsCount;
+  header->charactersCount = game->charactersCount;
+  header->physicsBodiesCount = game->physicsBodiesCount;
+  header->pathCapacity = Game_getPathCapacity(game);
+
+  header->game = *game;
+  Game_snapshotItemHolder(game, &header->game.player.itemHolder);
+  header->game.player.goose = (GameObject*)Game_indexToSnapshotPointer(
+      Game_getObjectIndex(game, game->player.goose));
+
+  for (i = 0; i < game->worldObjectsCount; i++) {
+    objects[i] = game->worldObjects[i];
+    objects[i].animState = (AnimationState*)Game_indexToSnapshotPointer(
+        Game_getAnimStateIndex(game, game->worldObjects[i].animState));
+    objects[i].physBody = (PhysBody*)Game_indexToSnapshotPointer(
+        Game_getPhysBodyIndex(game, game->worldObjects[i].physBody));
+  }
+
+  for (i = 0; i < game->itemsCount; i++) {
+    items[i] = game->items[i];
+    items[i].obj = (GameObject*)Game_indexToSnapshotPointer(
+        Game_getObjectIndex(game, game->items[i].obj));
+    items[i].holder = (ItemHolder*)Game_indexToSnapshotPointer(
+        Game_getItemHolderIndex(game, game->items[i].holder));
+  }
+
+  for (i = 0; i < game->charactersCount; i++) {
+    characters[i] = game->characters[i];
+    Game_snapshotItemHolder(game, &characters[i].itemHolder);
+    characters[i].obj = (GameObject*)Game_indexToSnapshotPointer(
+        Game_getObjectIndex(game, game->characters[i].obj));
+    characters[i].targetItem = (Item*)Game_indexToSnapshotPointer(
+        Game_getItemIndex(game, game->characters[i].targetItem));
+    characters[i].defaultActivityItem = (Item*)Game_indexToSnapshotPointer(
+        Game_getItemIndex(game, game->characters[i].defaultActivityItem));
+    // characters only ever follow their own path
+    characters[i].pathfindingResult =
+        (PathfindingState*)Game_indexToSnapshotPointer(
+            game->characters[i].pathfindingResult ? 0 : -1);
+    characters[i].path.start = (Node*)Game_indexToSnapshotPointer(
+        Game_getNodeIndex(game, game->characters[i].path.start));
+    characters[i].path.end = (Node*)Game_indexToSnapshotPointer(
+        Game_getNodeIndex(game, game->characters[i].path.end));
+    characters[i].path.result = NULL;
+    for (j = 0; j < characters[i].path.resultSize; j++) {
+      pathResult[i * header->pathCapacity + j] =
+          game->characters[i].path.result[j];
+    }
+  }
+
+  for (i = 0; i < game->physicsBodiesCount; i++) {
+    bodies[i] = game->physicsBodies[i];
+    // all the bodies are in the game's world
+    bodies[i].world = NULL;
+  }
+  memcpy((char*)buffer + layout.physicsWorldOffset, game->physicsWorld.buffer,
+         game->physicsWorld.bufferSize);
+
+  // the search state only matters while there's a search in progress
+  if (game->pathSearchCharacter != -1) {
+    search = game->pathfindingState;
+    header->search = *search;
+    header->search.start = (Node*)Game_indexToSnapshotPointer(
+        Game_getNodeIndex(game, search->start));
+    header->search.end = (Node*)Game_indexToSnapshotPointer(
+        Game_getNodeIndex(game, search->end));
+    header->search.nodeStates = NULL;
+    header->search.openList = NULL;
+    header->search.result = NULL;
+    for (i = 0; i < header->pathCapacity; i++) {
+      searchNodeStates[i] = search->nodeStates[i];
+      searchNodeStates[i].node = (Node*)Game_indexToSnapshotPointer(
+          Game_getNodeIndex(game, search->nodeStates[i].node));
+      searchNodeStates[i].reachedViaNode = (Node*)Game_indexToSnapshotPointer(
+          Game_getNodeIndex(game, search->nodeStates[i].reachedViaNode));
+    }
+    for (i = 0; search->openList && i < search->open; i++) {
+      searchOpenList[i] = search->openList[i];
+    }
+  }
+
+  // each cache entry's result has its own place in the results array
+  header->game.pathCache.results = NULL;
+  for (i = 0; i < PATH_CACHE_SIZE; i++) {
+    header->game.pathCache.entries[i].result = NULL;
+  }
+  for (i = 0; i < PATH_CACHE_SIZE * header->pathCapacity; i++) {
+    pathCacheResults[i] = game->pathCache.results[i];
+  }
+
+  return layout.size;
+}
+
+// restores the game state from a snapshot taken with Game_snapshot(). returns
+// FALSE, leaving the game unchanged, if the snapshot is from a different map
+int Game_restore(Game* game, void* buffer) {
+  int i, j, index;
+  GameSnapshotLayout layout;
+  GameSnapshotHeader* header;
+  GameObject* objects;
+  Item* items;
+  Character* characters;
+  PhysBody* bodies;
+  int* pathResult;
+  int* liveResult;
+  NodeState* searchNodeStates;
+  int* searchOpenList;
+  int* pathCacheResults;
+  PathfindingState* search;
+  Game restored;
+  PhysState* physics;
+
+  Game_getSnapshotLayout(game, &layout);
+  header = (GameSnapshotHeader*)buffer;
+  if (header->size != layout.size ||
+      header->worldObjectsCount != game->worldObjectsCount ||
+      header->itemsCount != game->itemsCount ||
+      header->charactersCount != game->charactersCount ||
+      header->physicsBodiesCount != game->physicsBodiesCount ||
+      header->pathCapacity != Game_getPathCapacity(game)) {
+    return FALSE;
+  }
+
+  objects = (GameObject*)((char*)buffer + layout.worldObjectsOffset);
+  items = (Item*)((char*)buffer + layout.itemsOffset);
+  characters = (Character*)((char*)buffer + layout.charactersOffset);
+  bodies = (PhysBody*)((char*)buffer + layout.physicsBodiesOffset);
+  pathResult = (int*)((char*)buffer + layout.pathResultOffset);
+  searchNodeStates =
+      (NodeState*)((char*)buffer + layout.searchNodeStatesOffset);
+  searchOpenList = (int*)((char*)buffer + layout.searchOpenListOffset);
+  pathCacheResults = (int*)((char*)buffer + layout.pathCacheResultsOffset);
+
+  // the arrays, map, physics world data and workers stay as they are
+  restored = header->game;
+  restored.worldObjects = game->worldObjects;
+  restored.items = game->items;
+  restored.characters = game->characters;
+  restored.physicsBodies = game->physicsBodies;
+  restored.physicsWorld = game->physicsWorld;
+  restored.objectsByType = game->objectsByType;
+  restored.objectsByCategory = game->objectsByCategory;
+  restored.objectGrid = game->objectGrid;
+  restored.pathfindingGraph = game->pathfindingGraph;
+  restored.pathfindingState = game->pathfindingState;
+  restored.characterPaths = game->characterPaths;
+  restored.pathCache.results = game->pathCache.results;
+  for (i = 0; i < PATH_CACHE_SIZE; i++) {
+    restored.pathCache.entries[i].result =
+        game->pathCache.entries[i].result;
+  }
+  restored.pathNodeGrid = game->pathNodeGrid;
+  physics = &restored.physicsState;
+  physics->worldData = game->physicsState.worldData;
+  physics->broadphase = game->physicsState.broadphase;
+  physics->workers = game->physicsState.workers;
+  *game = restored;
+
+  Game_restoreItemHolder(game, &game->player.itemHolder, &game->player);
+  game->player.goose = Game_getObjectByID(
+      game, Game_snapshotPointerToIndex(header->game.player.goose));
+
+  for (i = 0; i < game->worldObjectsCount; i++) {
+    game->worldObjects[i] = objects[i];
+    game->worldObjects[i].animState = Game_getAnimStateByIndex(
+        game, Game_snapshotPointerToIndex(objects[i].animState));
+    index = Game_snapshotPointerToIndex(objects[i].physBody);
+    game->worldObjects[i].physBody =
+        index == -1 ? NULL : &game->physicsBodies[index];
+  }
+
+  for (i = 0; i < game->itemsCount; i++) {
+    game->items[i] = items[i];
+    game->items[i].obj = Game_getObjectByID(
+        game, Game_snapshotPointerToIndex(items[i].obj));
+    game->items[i].holder = Game_getItemHolderByIndex(
+        game, Game_snapshotPointerToIndex(items[i].holder));
+  }
+
+  for (i = 0; i < game->charactersCount; i++) {
+    liveResult = game->characters[i].path.result;
+    game->characters[i] = characters[i];
+    Game_restoreItemHolder(game, &game->characters[i].itemHolder,
+                           &game->characters[i]);
+    game->characters[i].obj = Game_getObjectByID(
+        game, Game_snapshotPointerToIndex(characters[i].obj));
+    index = Game_snapshotPointerToIndex(characters[i].targetItem);
+    game->characters[i].targetItem = index == -1 ? NULL : &game->items[index];
+    index = Game_snapshotPointerToIndex(characters[i].defaultActivityItem);
+    game->characters[i].defaultActivityItem =
+        index == -1 ? NULL : &game->items[index];
+    game->characters[i].pathfindingResult =
+        Game_snapshotPointerToIndex(characters[i].pathfindingResult) == -1
+            ? NULL
+            : &game->characters[i].path;
+    game->characters[i].path.start = Game_getNodeByIndex(
+        game, Game_snapshotPointerToIndex(characters[i].path.start));
+    game->characters[i].path.end = Game_getNodeByIndex(
+        game, Game_snapshotPointerToIndex(characters[i].path.end));
+    game->characters[i].path.result = liveResult;
+    for (j = 0; j < characters[i].path.resultSize; j++) {
+      liveResult[j] = pathResult[i * header->pathCapacity + j];
+    }
+  }
+
+  if (game->pathSearchCharacter != -1) {
+    search = game->pathfindingState;
+    search->start = Game_getNodeByIndex(
+        game, Game_snapshotPointerToIndex(header->search.start));
+    search->end = Game_getNodeByIndex(
+        game, Game_snapshotPointerToIndex(header->search.end));
+    search->open = header->search.open;
+    search->resultSize = header->search.resultSize;
+    search->expanded = header->search.expanded;
+    for (i = 0; i < header->pathCapacity; i++) {
+      search->nodeStates[i] = searchNodeStates[i];
+      search->nodeStates[i].node = Game_getNodeByIndex(
+          game, Game_snapshotPointerToIndex(searchNodeStates[i].node));
+      index = Game_snapshotPointerToIndex(searchNodeStates[i].reachedViaNode);
+      search->nodeStates[i].reachedViaNode = Game_getNodeByIndex(game, index);
+    }
+    for (i = 0; search->openList && i < search->open; i++) {
+      search->openList[i] = searchOpenList[i];
+    }
+  }
+
+  for (i = 0; i < PATH_CACHE_SIZE * header->pathCapacity; i++) {
+    game->pathCache.results[i] = pathCacheResults[i];
+  }
+
+  memcpy(game->physicsWorld.buffer, (char*)buffer + layout.physicsWorldOffset,
+         game->physicsWorld.bufferSize);
+  // the object grid isn't in the snapshot, so refile the objects which move
+  for (i = 0; i < game->physicsBodiesCount; i++) {
+    game->physicsBodies[i] = bodies[i];
+    game->physicsBodies[i].world = &game->physicsWorld;
+    GameObjectGrid_update(&game->objectGrid,
+                          Game_getObjectByID(game, bodies[i].id));
+  }
+
+  return TRUE;
+}
+
 #ifndef __N64__
 #ifdef __cplusplus
 
@@ -407,17 +1159,24 @@ check if intersection distance is less than previously found intersection (if
 any).
 Crappy code for debug use only
  */
-GameObject* Game_getIntersectingObject(Vec3d* raySource, Vec3d* rayDirection) {
-  int i, hit;
+GameObject* Game_getIntersectingObject(Game* game,
+                                       Vec3d* raySource,
+                                       Vec3d* rayDirection) {
+  int i, hit, candidatesCount;
   float closestObjHitDist, intersectDist;
   GameObject* obj;
   GameObject* closestObjHit;
+  GameObject* candidates[MAX_WORLD_OBJECTS];
   Vec3d objCenter;
 
   closestObjHitDist = FLT_MAX;
   closestObjHit = NULL;
 
-  for (i = 0, obj = game.worldObjects; i < game.worldObjectsCount; i++, obj++) {
+  candidatesCount = GameObjectGrid_getRayCandidates(
+      &game->objectGrid, raySource, rayDirection, FLT_MAX, candidates,
+      MAX_WORLD_OBJECTS);
+  for (i = 0; i < candidatesCount; i++) {
+    obj = candidates[i];
     Game_getObjCenter(obj, &objCenter);
 
     intersectDist = Game_rayIntersectsSphereDist(
@@ -449,24 +1208,36 @@ method: check if ray from viewer to target intersects any other object's
 bounding sphere at a distance less than the distance to the target's
 bounding sphere
 */
-int Game_canSeeOtherObject(GameObject* viewer,
+// only objects with one of occluderFlags set can block the view, or any object
+// if it's 0
+int Game_canSeeOtherObject(Game* game,
+                           GameObject* viewer,
                            GameObject* target,
                            float viewerEyeOffset,
-                           GameObject* occuludingObjects,
-                           int occuludingObjectsCount) {
+                           int occluderFlags) {
   Vec3d eye, rayDirection, objCenter;
-  int i, canSee;
+  int i, canSee, candidatesCount;
   float targetDistance, objDistance;
   GameObject* obj;
+  GameObject* candidates[MAX_WORLD_OBJECTS];
 
   canSee = TRUE;
+  obj = NULL;
   eye = viewer->position;
   eye.y += viewerEyeOffset;  // eye offset
   Vec3d_directionTo(&eye, &target->position, &rayDirection);
 
   targetDistance = Game_distanceToGameObject(&eye, target);
 
-  for (obj = occuludingObjects, i = 0; i < occuludingObjectsCount; obj++, i++) {
+  // only objects the ray passes near before reaching the target can block it
+  candidatesCount = GameObjectGrid_getRayCandidates(
+      &game->objectGrid, &eye, &rayDirection, MAX(targetDistance, 0),
+      candidates, MAX_WORLD_OBJECTS);
+  for (i = 0; i < candidatesCount; i++) {
+    obj = candidates[i];
+    if (occluderFlags && !(obj->flags & occluderFlags)) {
+      continue;
+    }
     if (obj->id == target->id || obj->id == viewer->id) {
       // the ray will definitely intersect these, but we care about
       // intersections with other things
@@ -7,16 +7,37 @@
 #include "input.h"
 #include "physics.h"
 
-void Game_init(GameObject* worldObjects,
+// there can be several games at once (eg. batchrunner.c runs many in
+// parallel). each needs its own copy of the world objects, which it modifies,
+// and its own pathfinding state. the trace buffer (trace.c) and the input
+// recording (inputrecording.c) are still global and aren't thread-safe, so
+// don't start either while games are updating on more than one thread
+void Game_init(Game* game,
+               GameObject* worldObjects,
                int worldObjectsCount,
                PhysWorldData* physWorldData);
-Game* Game_get();
+void Game_destroy(Game* game);
+void Game_initPathfinding(Game* game, Graph* graph, PathfindingState* state);
+PathSearchStatus Game_findPath(Game* game,
+                               Character* character,
+                               int from,
+                               int to);
+void Game_invalidatePaths(Game* game);
+int Game_quantizePosition(Game* game, Vec3d* position, int unobstructed);
+int Game_isSegmentUnobstructed(Game* game,
+                               Vec3d* start,
+                               Vec3d* end,
+                               float radius);
 
-GameObject* Game_findObjectByType(ModelType modelType);
-GameObject* Game_findObjectNByType(ModelType modelType, int n);
+GameObject* Game_getObjectByID(Game* game, int id);
+GameObject* Game_findObjectByType(Game* game, ModelType modelType);
+GameObject* Game_findObjectNByType(Game* game, ModelType modelType, int n);
+Item* Game_getItemForObject(Game* game, GameObject* obj);
 
-int Game_countObjectsInCategory(ModelTypeCategory category);
-GameObject* Game_getIntersectingObject(Vec3d* raySource, Vec3d* rayDirection);
+int Game_countObjectsInCategory(Game* game, ModelTypeCategory category);
+GameObject* Game_getIntersectingObject(Game* game,
+                                       Vec3d* raySource,
+                                       Vec3d* rayDirection);
 
 float Game_getObjRadius(GameObject* obj);
 
@@ -25,16 +46,27 @@ int Game_rayIntersectsSphere(Vec3d* origin,
                              Vec3d* objCenter,
                              float objRadius);
 
-int Game_canSeeOtherObject(GameObject* viewer,
+int Game_canSeeOtherObject(Game* game,
+                           GameObject* viewer,
                            GameObject* target,
                            float viewerEyeOffset,
-                           GameObject* occuludingObjects,
-                           int occuludingObjectsCount);
+                           int occluderFlags);
 
 void Game_getObjCenter(GameObject* obj, Vec3d* result);
 float Game_getObjRadius(GameObject* obj);
 
-void Game_update(Input* input);
+void Game_getObjInterpolatedPosition(Game* game,
+                                     GameObject* obj,
+                                     Vec3d* result);
+
+void Game_update(Game* game, Input* input, float now);
+void Game_tick(Game* game, Input* input);
+
+unsigned int Game_hashState(Game* game);
+
+int Game_getSnapshotSize(Game* game);
+int Game_snapshot(Game* game, void* buffer, int bufferSize);
+int Game_restore(Game* game, void* buffer);
 
 #ifndef __N64__
 #ifdef __cplusplus
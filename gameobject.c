@@ -22,8 +22,10 @@ GameObject* GameObject_init(GameObject* self, int id, Vec3d* initPos) {
   EulerDegrees_origin(&self->rotation);
   self->modelType = NoneModel;
   self->animState = NULL;
+  self->physBody = NULL;
   self->visible = TRUE;
   self->solid = TRUE;
+  self->flags = 0;
 
   if (initPos) {
     Vec3d_copyFrom(&self->position, initPos);
@@ -31,6 +33,97 @@ GameObject* GameObject_init(GameObject* self, int id, Vec3d* initPos) {
   return self;
 }
 
+// objects with physics bodies must be moved with these, rather than by
+// changing position directly, so the body moves with the object
+void GameObject_translate(GameObject* self, Vec3d* translation) {
+  Vec3d_add(&self->position, translation);
+  if (self->physBody) {
+    PhysBody_translateWithoutForce(self->physBody, translation);
+  }
+}
+
+void GameObject_setPosition(GameObject* self, Vec3d* position) {
+  Vec3d translation;
+
+  translation = *position;
+  Vec3d_sub(&translation, &self->position);
+  self->position = *position;
+  if (self->physBody) {
+    PhysBody_translateWithoutForce(self->physBody, &translation);
+  }
+}
+
+// must be called again if the object's model type changes, or it gains or
+// loses a physics body
+void GameObject_bakeFlags(GameObject* self) {
+  int flags;
+
+  flags = 0;
+  switch (self->modelType) {
+    // these object types don't occlude
+    case UniFloorModel:
+    case UniBldgModel:
+    case FlagpoleModel:
+    case GooseModel:
+      break;
+    default:
+      flags |= GameObjectOccluderFlag;
+  }
+
+  switch (self->modelType) {
+    case GooseModel:
+    case GardenerCharacterModel:
+      flags |= GameObjectAnimatedFlag;
+      break;
+    default:
+      break;
+  }
+
+  if (self->physBody || flags & GameObjectAnimatedFlag) {
+    flags |= GameObjectZBufferedFlag;
+  }
+  switch (self->modelType) {
+    case BushModel:
+      // case WatergrassModel:
+      // case ReedModel:
+      flags |= GameObjectZBufferedFlag;
+      break;
+    default:
+      break;
+  }
+
+  switch (self->modelType) {
+    // case GroundModel:
+    case WaterModel:
+      flags |= GameObjectZWriteFlag;
+      break;
+    default:
+      break;
+  }
+
+  switch (self->modelType) {
+    case GroundModel:
+    case WaterModel:
+      flags |= GameObjectBackgroundFlag;
+      break;
+    default:
+      break;
+  }
+
+  switch (self->modelType) {
+    case GroundModel:
+    case WaterModel:
+    case WallModel:
+    case PlanterModel:
+      flags |= GameObjectLitFlag;
+      break;
+    default:
+      break;
+  }
+
+  self->flags = flags;
+}
+
 #ifndef __N64__
 #include <stdio.h>
 void GameObject_print(GameObject* self) {
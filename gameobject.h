@@ -9,6 +9,18 @@
 #include "rotation.h"
 #include "vec3d.h"
 
+// properties which follow from an object's model type (and whether it has a
+// physics body), baked by GameObject_bakeFlags() so they don't have to be
+// worked out each time they're checked
+typedef enum GameObjectFlag {
+  GameObjectOccluderFlag = 1 << 0,  // blocks characters' line of sight
+  GameObjectZBufferedFlag = 1 << 1,
+  GameObjectZWriteFlag = 1 << 2,
+  GameObjectBackgroundFlag = 1 << 3,  // drawn behind everything else
+  GameObjectLitFlag = 1 << 4,
+  GameObjectAnimatedFlag = 1 << 5,
+} GameObjectFlag;
+
 typedef struct GameObject {
   int id;
   Vec3d position;
@@ -19,9 +31,13 @@ typedef struct GameObject {
   PhysBody* physBody;
   int visible;
   int solid;
+  int flags;  // GameObjectFlag bits
 } GameObject;
 
 GameObject* GameObject_alloc();
 GameObject* GameObject_init(GameObject* self, int id, Vec3d* initPos);
+void GameObject_translate(GameObject* self, Vec3d* translation);
+void GameObject_setPosition(GameObject* self, Vec3d* position);
+void GameObject_bakeFlags(GameObject* self);
 
 #endif /* !GAMEOBJECT_H */
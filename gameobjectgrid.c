@@ -0,0 +1,384 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+#ifdef __N64__
+#include <malloc.h>
+#endif
+
+#include "constants.h"
+#include "game.h"
+#include "gameobjectgrid.h"
+#include "modeltype.h"
+
+typedef struct GameObjectGridRayState {
+  GameObjectGrid* grid;
+  unsigned int epoch;
+  int candidatesCount;
+} GameObjectGridRayState;
+
+int GameObjectGrid_getCell(GameObjectGrid* self, float unitsPos) {
+  return floorf(unitsPos / self->cellSize);
+}
+
+int GameObjectGrid_getBucket(GameObjectGrid* self, int cellX, int cellZ) {
+  return (((unsigned int)cellX * 73856093u) ^
+          ((unsigned int)cellZ * 19349663u)) &
+         (self->bucketsCount - 1);
+}
+
+void GameObjectGrid_insert(GameObjectGrid* self, int objectIndex) {
+  int bucket, cellX, cellZ;
+  GameObject* obj;
+
+  obj = self->objects + objectIndex;
+  cellX = GameObjectGrid_getCell(self, obj->position.x);
+  cellZ = GameObjectGrid_getCell(self, obj->position.z);
+  self->minCellX = MIN(self->minCellX, cellX);
+  self->minCellZ = MIN(self->minCellZ, cellZ);
+  self->maxCellX = MAX(self->maxCellX, cellX);
+  self->maxCellZ = MAX(self->maxCellZ, cellZ);
+
+  bucket = GameObjectGrid_getBucket(self, cellX, cellZ);
+  self->objectBuckets[objectIndex] = bucket;
+  self->prev[objectIndex] = -1;
+  self->next[objectIndex] = self->buckets[bucket];
+  if (self->buckets[bucket] != -1) {
+    self->prev[self->buckets[bucket]] = objectIndex;
+  }
+  self->buckets[bucket] = objectIndex;
+}
+
+void GameObjectGrid_remove(GameObjectGrid* self, int objectIndex) {
+  int bucket;
+
+  bucket = self->objectBuckets[objectIndex];
+  if (self->prev[objectIndex] == -1) {
+    self->buckets[bucket] = self->next[objectIndex];
+  } else {
+    self->next[self->prev[objectIndex]] = self->next[objectIndex];
+  }
+  if (self->next[objectIndex] != -1) {
+    self->prev[self->next[objectIndex]] = self->prev[objectIndex];
+  }
+}
+
+void GameObjectGrid_init(GameObjectGrid* self,
+                         GameObject* objects,
+                         int objectsCount) {
+  int i;
+  int* buffer;
+  unsigned int* visitedEpochs;
+  ModelProperties* properties;
+
+  self->objects = objects;
+  self->objectsCount = objectsCount;
+  // about half the buckets will be empty, which keeps hash collisions rare
+  self->bucketsCount = 1;
+  while (self->bucketsCount < objectsCount * 2) {
+    self->bucketsCount *= 2;
+  }
+
+  self->reach = 0;
+  for (i = 0; i < MAX_MODEL_TYPE; i++) {
+    properties = &modelTypesProperties[i];
+    self->reach = MAX(self->reach, properties->radius +
+                                       fabsf(properties->centroidOffset.x) +
+                                       fabsf(properties->centroidOffset.z));
+  }
+  self->cellSize = MAX(self->reach + GAME_OBJECT_GRID_MOVE_MARGIN, 1.0);
+
+  buffer = (int*)malloc((self->bucketsCount + objectsCount * 4) * sizeof(int));
+  invariant(buffer);
+  self->buckets = buffer;
+  self->next = self->buckets + self->bucketsCount;
+  self->prev = self->next + objectsCount;
+  self->objectBuckets = self->prev + objectsCount;
+  self->candidates = self->objectBuckets + objectsCount;
+
+  visitedEpochs =
+      (unsigned int*)malloc(MAX(objectsCount, 1) * sizeof(unsigned int));
+  invariant(visitedEpochs);
+  SpatialHashQueryContext_init(&self->queryContext, visitedEpochs,
+                               objectsCount);
+
+  for (i = 0; i < self->bucketsCount; i++) {
+    self->buckets[i] = -1;
+  }
+  if (objectsCount) {
+    self->minCellX = GameObjectGrid_getCell(self, objects[0].position.x);
+    self->minCellZ = GameObjectGrid_getCell(self, objects[0].position.z);
+  } else {
+    self->minCellX = 0;
+    self->minCellZ = 0;
+  }
+  self->maxCellX = self->minCellX;
+  self->maxCellZ = self->minCellZ;
+  for (i = 0; i < objectsCount; i++) {
+    GameObjectGrid_insert(self, i);
+  }
+}
+
+void GameObjectGrid_destroy(GameObjectGrid* self) {
+  free(self->buckets);
+  free(self->queryContext.visitedEpochs);
+}
+
+// moves an object to the bucket for its current position
+void GameObjectGrid_update(GameObjectGrid* self, GameObject* obj) {
+  int objectIndex;
+
+  objectIndex = obj - self->objects;
+  invariant(objectIndex >= 0 && objectIndex < self->objectsCount);
+  if (self->objectBuckets[objectIndex] !=
+      GameObjectGrid_getBucket(
+          self, GameObjectGrid_getCell(self, obj->position.x),
+          GameObjectGrid_getCell(self, obj->position.z))) {
+    GameObjectGrid_remove(self, objectIndex);
+    GameObjectGrid_insert(self, objectIndex);
+  }
+}
+
+// appends the objects in the cell's bucket which haven't been collected yet in
+// this query
+int GameObjectGrid_collectCell(GameObjectGrid* self,
+                               int cellX,
+                               int cellZ,
+                               unsigned int epoch,
+                               int candidatesCount) {
+  int objectIndex;
+
+  for (objectIndex = self->buckets[GameObjectGrid_getBucket(self, cellX,
+                                                            cellZ)];
+       objectIndex != -1; objectIndex = self->next[objectIndex]) {
+    if (self->queryContext.visitedEpochs[objectIndex] != epoch) {
+      self->queryContext.visitedEpochs[objectIndex] = epoch;
+      self->candidates[candidatesCount] = objectIndex;
+      candidatesCount++;
+    }
+  }
+  return candidatesCount;
+}
+
+void GameObjectGrid_sortCandidates(GameObjectGrid* self, int candidatesCount) {
+  int i, j, objectIndex;
+
+  for (i = 1; i < candidatesCount; i++) {
+    objectIndex = self->candidates[i];
+    for (j = i; j > 0 && self->candidates[j - 1] > objectIndex; j--) {
+      self->candidates[j] = self->candidates[j - 1];
+    }
+    self->candidates[j] = objectIndex;
+  }
+}
+
+// collects the objects filed in the cells overlapping the rect on x,z,
+// sorted by index
+int GameObjectGrid_collectRect(GameObjectGrid* self,
+                               float minX,
+                               float minZ,
+                               float maxX,
+                               float maxZ) {
+  int cellX, cellZ, minCellX, minCellZ, maxCellX, maxCellZ, candidatesCount;
+  unsigned int epoch;
+
+  // no need to look outside the cells which have objects
+  minCellX = MAX(GameObjectGrid_getCell(self, minX), self->minCellX);
+  minCellZ = MAX(GameObjectGrid_getCell(self, minZ), self->minCellZ);
+  maxCellX = MIN(GameObjectGrid_getCell(self, maxX), self->maxCellX);
+  maxCellZ = MIN(GameObjectGrid_getCell(self, maxZ), self->maxCellZ);
+
+  epoch = SpatialHashQueryContext_nextEpoch(&self->queryContext);
+  candidatesCount = 0;
+  for (cellX = minCellX; cellX <= maxCellX; cellX++) {
+    for (cellZ = minCellZ; cellZ <= maxCellZ; cellZ++) {
+      candidatesCount = GameObjectGrid_collectCell(self, cellX, cellZ, epoch,
+                                                   candidatesCount);
+    }
+  }
+
+  GameObjectGrid_sortCandidates(self, candidatesCount);
+  return candidatesCount;
+}
+
+int GameObjectGrid_getOverlapping(GameObjectGrid* self,
+                                  Vec3d* center,
+                                  float radius,
+                                  GameObject** results,
+                                  int maxResults) {
+  int i, candidatesCount, resultsCount;
+  float pad;
+  GameObject* obj;
+  Vec3d objCenter;
+
+  pad = radius + self->reach + GAME_OBJECT_GRID_MOVE_MARGIN;
+  candidatesCount = GameObjectGrid_collectRect(
+      self, center->x - pad, center->z - pad, center->x + pad, center->z + pad);
+
+  resultsCount = 0;
+  for (i = 0; i < candidatesCount && resultsCount < maxResults; i++) {
+    obj = self->objects + self->candidates[i];
+    Game_getObjCenter(obj, &objCenter);
+    if (Vec3d_distanceTo(center, &objCenter) <
+        radius + Game_getObjRadius(obj)) {
+      results[resultsCount] = obj;
+      resultsCount++;
+    }
+  }
+  return resultsCount;
+}
+
+int GameObjectGrid_getNear(GameObjectGrid* self,
+                           Vec3d* position,
+                           float distance,
+                           GameObject** results,
+                           int maxResults) {
+  int i, candidatesCount, resultsCount;
+  float pad;
+  GameObject* obj;
+
+  pad = distance + GAME_OBJECT_GRID_MOVE_MARGIN;
+  candidatesCount =
+      GameObjectGrid_collectRect(self, position->x - pad, position->z - pad,
+                                 position->x + pad, position->z + pad);
+
+  resultsCount = 0;
+  for (i = 0; i < candidatesCount && resultsCount < maxResults; i++) {
+    obj = self->objects + self->candidates[i];
+    if (Vec3d_distanceTo(position, &obj->position) < distance) {
+      results[resultsCount] = obj;
+      resultsCount++;
+    }
+  }
+  return resultsCount;
+}
+
+// visits the cells around each cell the ray passes through, as objects in
+// them can reach into it
+void GameObjectGrid_visitRayCell(int cellX, int cellZ, void* data) {
+  GameObjectGridRayState* state;
+  int x, z;
+
+  state = (GameObjectGridRayState*)data;
+  for (x = cellX - 1; x <= cellX + 1; x++) {
+    for (z = cellZ - 1; z <= cellZ + 1; z++) {
+      state->candidatesCount = GameObjectGrid_collectCell(
+          state->grid, x, z, state->epoch, state->candidatesCount);
+    }
+  }
+}
+
+int GameObjectGrid_getRayCandidates(GameObjectGrid* self,
+                                    Vec3d* origin,
+                                    Vec3d* direction,
+                                    float maxDistance,
+                                    GameObject** results,
+                                    int maxResults) {
+  GameObjectGridRayState state;
+  float exitDistance, boundary;
+  int i, resultsCount;
+
+  // stop where the ray leaves the cells around the ones with objects
+  if (direction->x != 0) {
+    boundary = direction->x > 0 ? (self->maxCellX + 2) * self->cellSize
+                                : (self->minCellX - 1) * self->cellSize;
+    exitDistance = (boundary - origin->x) / direction->x;
+    maxDistance = MIN(maxDistance, exitDistance);
+  }
+  if (direction->z != 0) {
+    boundary = direction->z > 0 ? (self->maxCellZ + 2) * self->cellSize
+                                : (self->minCellZ - 1) * self->cellSize;
+    exitDistance = (boundary - origin->z) / direction->z;
+    maxDistance = MIN(maxDistance, exitDistance);
+  }
+  if (maxDistance < 0) {
+    // heading away from all the objects
+    return 0;
+  }
+
+  state.grid = self;
+  state.epoch = SpatialHashQueryContext_nextEpoch(&self->queryContext);
+  state.candidatesCount = 0;
+  SpatialHash_raycast(
+      origin->x / self->cellSize, origin->z / self->cellSize,
+      (origin->x + direction->x * maxDistance) / self->cellSize,
+      (origin->z + direction->z * maxDistance) / self->cellSize,
+      GameObjectGrid_visitRayCell, &state);
+
+  GameObjectGrid_sortCandidates(self, state.candidatesCount);
+  resultsCount = MIN(state.candidatesCount, maxResults);
+  for (i = 0; i < resultsCount; i++) {
+    results[i] = self->objects + self->candidates[i];
+  }
+  return resultsCount;
+}
+
+// whether a is closer to position than b, using the index to break ties
+int GameObjectGrid_isCloser(GameObjectGrid* self,
+                            Vec3d* position,
+                            GameObject* a,
+                            GameObject* b) {
+  float distA, distB;
+
+  distA = Vec3d_distanceTo(position, &a->position);
+  distB = Vec3d_distanceTo(position, &b->position);
+  return distA < distB || (distA == distB && a < b);
+}
+
+// searches outwards from the position's cell a ring of cells at a time, until
+// no cell further out could hold anything closer than the kth closest found
+int GameObjectGrid_getNearest(GameObjectGrid* self,
+                              Vec3d* position,
+                              int k,
+                              GameObject** results) {
+  int ring, maxRing, cellX, cellZ, x, z, i, j, candidatesCount, resultsCount;
+  unsigned int epoch;
+  GameObject* obj;
+
+  k = MIN(k, self->objectsCount);
+  if (k < 1) {
+    return 0;
+  }
+  cellX = GameObjectGrid_getCell(self, position->x);
+  cellZ = GameObjectGrid_getCell(self, position->z);
+  maxRing = MAX(MAX(cellX - self->minCellX, self->maxCellX - cellX),
+                MAX(cellZ - self->minCellZ, self->maxCellZ - cellZ));
+
+  epoch = SpatialHashQueryContext_nextEpoch(&self->queryContext);
+  resultsCount = 0;
+  for (ring = 0; ring <= maxRing; ring++) {
+    // anything not found yet is filed at least ring - 1 cells away, and can
+    // only have moved GAME_OBJECT_GRID_MOVE_MARGIN closer since
+    if (resultsCount == k &&
+        Vec3d_distanceTo(position, &results[k - 1]->position) <
+            (ring - 1) * self->cellSize - GAME_OBJECT_GRID_MOVE_MARGIN) {
+      break;
+    }
+
+    candidatesCount = 0;
+    for (x = cellX - ring; x <= cellX + ring; x++) {
+      for (z = cellZ - ring; z <= cellZ + ring;
+           z += (x == cellX - ring || x == cellX + ring) ? 1 : 2 * ring) {
+        candidatesCount =
+            GameObjectGrid_collectCell(self, x, z, epoch, candidatesCount);
+      }
+    }
+
+    for (i = 0; i < candidatesCount; i++) {
+      obj = self->objects + self->candidates[i];
+      if (resultsCount == k &&
+          !GameObjectGrid_isCloser(self, position, obj, results[k - 1])) {
+        continue;
+      }
+      j = resultsCount == k ? k - 1 : resultsCount;
+      for (; j > 0 && GameObjectGrid_isCloser(self, position, obj,
+                                              results[j - 1]);
+           j--) {
+        results[j] = results[j - 1];
+      }
+      results[j] = obj;
+      resultsCount = MIN(resultsCount + 1, k);
+    }
+  }
+  return resultsCount;
+}
@@ -0,0 +1,72 @@
+#ifndef GAMEOBJECTGRID_H
+#define GAMEOBJECTGRID_H
+
+#include "collision.h"
+#include "gameobject.h"
+#include "vec3d.h"
+
+// how far an object can move between GameObjectGrid_update() calls. objects
+// with physics bodies are updated after each physics step, and in between they
+// only move by walking, or by an item jumping to whoever picked it up, which
+// can't be further than PLAYER_NEAR_OBJ_DIST away
+#define GAME_OBJECT_GRID_MOVE_MARGIN 120.0f
+
+// uniform grid on the x,z plane for finding world objects near a point or
+// along a ray, so gameplay queries only look at objects in nearby cells.
+// objects are filed by their position, and cells are hashed into buckets like
+// the PhysBroadphase. cells are at least as big as the furthest an object's
+// bounding sphere can reach past its cell (allowing for it moving by up to
+// GAME_OBJECT_GRID_MOVE_MARGIN), so a query only needs to look one cell
+// further out. query results are always exact, and sorted by object index
+typedef struct GameObjectGrid {
+  GameObject* objects;
+  int objectsCount;
+  int bucketsCount;  // a power of 2
+  float cellSize;
+  float reach;  // furthest on x,z a bounding sphere reaches from its position
+  // cells which have had objects in them
+  int minCellX;
+  int minCellZ;
+  int maxCellX;
+  int maxCellZ;
+  int* buckets;        // first object in each bucket, or -1
+  int* next;           // next object in the same bucket, or -1. by index
+  int* prev;           // previous object in the same bucket, or -1
+  int* objectBuckets;  // bucket each object is in
+  int* candidates;     // scratch, objectsCount long
+  SpatialHashQueryContext queryContext;  // skips objects already collected
+} GameObjectGrid;
+
+void GameObjectGrid_init(GameObjectGrid* self,
+                         GameObject* objects,
+                         int objectsCount);
+void GameObjectGrid_destroy(GameObjectGrid* self);
+void GameObjectGrid_update(GameObjectGrid* self, GameObject* obj);
+
+// objects with bounding spheres overlapping the sphere
+int GameObjectGrid_getOverlapping(GameObjectGrid* self,
+                                  Vec3d* center,
+                                  float radius,
+                                  GameObject** results,
+                                  int maxResults);
+// objects positioned within distance of position
+int GameObjectGrid_getNear(GameObjectGrid* self,
+                           Vec3d* position,
+                           float distance,
+                           GameObject** results,
+                           int maxResults);
+// objects with bounding spheres which the ray might hit within maxDistance.
+// these still need testing against the ray
+int GameObjectGrid_getRayCandidates(GameObjectGrid* self,
+                                    Vec3d* origin,
+                                    Vec3d* direction,
+                                    float maxDistance,
+                                    GameObject** results,
+                                    int maxResults);
+// the k objects positioned closest to position, closest first
+int GameObjectGrid_getNearest(GameObjectGrid* self,
+                              Vec3d* position,
+                              int k,
+                              GameObject** results);
+
+#endif /* !GAMEOBJECTGRID_H */
@@ -5,6 +5,7 @@
 #include "animation.h"
 #include "characterstate.h"
 #include "gameobject.h"
+#include "gameobjectgrid.h"
 #include "pathfinding.h"
 #include "physics.h"
 
@@ -46,7 +47,14 @@ typedef struct Character {
   Vec3d targetLocation;  // high level movement goal (eg. last seen/heard loc)
   CharacterTarget targetType;
   CharacterState state;
-  PathfindingState* pathfindingResult;
+  PathfindingState* pathfindingResult;  // &path while following it, or NULL
+  // the character's own copy of the path it's following. only start, end and
+  // result are used
+  PathfindingState path;
+  // the last position the character went to and its closest path node, which
+  // is -1 until it's been found
+  Vec3d quantizedTarget;
+  int quantizedTargetNode;
   // index of target node in path, or pathlength+1 for final target
   int pathProgress;
   float pathSegmentProgress;  // param between segments, used by path smoothing
@@ -78,17 +86,44 @@ typedef struct Game {
   int freeView;
   GameObject* worldObjects;
   int worldObjectsCount;
+  // every world object, grouped by model type and by category, in id order
+  // within each group, built by Game_init(). the objects of type t are
+  // objectsByType[objectsByTypeOffsets[t]] up to (not including)
+  // objectsByType[objectsByTypeOffsets[t + 1]]
+  GameObject** objectsByType;
+  int objectsByTypeOffsets[MAX_MODEL_TYPE + 1];
+  GameObject** objectsByCategory;
+  int objectsByCategoryOffsets[MAX_MODEL_TYPE_CATEGORY + 1];
+  GameObjectGrid objectGrid;
   Item* items;
   int itemsCount;
   Character* characters;
   int charactersCount;
   PhysBody* physicsBodies;
   int physicsBodiesCount;
+  PhysWorld physicsWorld;  // the motion state of physicsBodies
 
   Player player;
   PhysState physicsState;
   Graph* pathfindingGraph;
-  PathfindingState* pathfindingState;
+  PathfindingState* pathfindingState;  // the search in progress
+  // the character the search in pathfindingState is for, or -1 if there's no
+  // search in progress, and the last tick the character asked for the path
+  int pathSearchCharacter;
+  unsigned int pathSearchRequestedTick;
+  // nodes searches can expand each tick, GAME_PATHFINDING_BUDGET by default,
+  // and nodes they can still expand this tick
+  int pathfindingBudgetPerTick;
+  int pathfindingBudget;
+  // how many times searches ran out of budget and carried on in a later tick,
+  // were abandoned unfinished for another search, and had characters waiting
+  // on them (who steer straight at their target meanwhile)
+  int pathSearchesSuspended;
+  int pathSearchesAbandoned;
+  int pathSearchWaits;
+  int* characterPaths;  // path results for each character, graph size long
+  PathCache pathCache;
+  PathNodeGrid pathNodeGrid;
 
   // profiling
   float profTimeCharacters;
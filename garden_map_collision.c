@@ -944,9050 +944,530 @@ Triangle garden_map_collision_collision_mesh[] = {
     },
 
 };
-int garden_map_collision_collision_mesh_hash_bucket_3380_data[] = {87, 88, 89,
-                                                                   91};
-int garden_map_collision_collision_mesh_hash_bucket_3381_data[] = {87, 88, 89,
-                                                                   91};
-int garden_map_collision_collision_mesh_hash_bucket_3382_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3383_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3384_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3385_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3386_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3387_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3388_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3389_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3390_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3391_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3392_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3393_data[] = {86, 88, 90,
-                                                                   93, 94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3394_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3395_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3396_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3397_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3398_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3399_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3400_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3401_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3402_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3464_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3465_data[] = {87, 88, 89,
-                                                                   91};
-int garden_map_collision_collision_mesh_hash_bucket_3466_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3467_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3468_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3469_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3470_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3471_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3472_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3473_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3474_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3475_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3476_data[] = {86, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3477_data[] = {86, 88, 90,
-                                                                   93, 94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3478_data[] = {94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3479_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3480_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3481_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3482_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3483_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3484_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3485_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3486_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3548_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3549_data[] = {87, 89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3550_data[] = {88, 89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3551_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3552_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3553_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3554_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3555_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3556_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3557_data[] = {20, 23, 24,
-                                                                   27, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3558_data[] = {23, 27, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3559_data[] = {22, 23, 26,
-                                                                   27, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3560_data[] = {86, 88, 90};
-int garden_map_collision_collision_mesh_hash_bucket_3561_data[] = {86, 90, 93,
-                                                                   95};
-int garden_map_collision_collision_mesh_hash_bucket_3562_data[] = {93, 94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3563_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3564_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3565_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3566_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3567_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3568_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3569_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3570_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3632_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3633_data[] = {87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_3634_data[] = {87, 89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3635_data[] = {88, 89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3636_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3637_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3638_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3639_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3640_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3641_data[] = {20, 21, 24,
-                                                                   25, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3642_data[] = {21, 25, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3643_data[] = {21, 22, 25,
-                                                                   26, 86, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3644_data[] = {86, 88, 90};
-int garden_map_collision_collision_mesh_hash_bucket_3645_data[] = {90, 93};
-int garden_map_collision_collision_mesh_hash_bucket_3646_data[] = {93, 94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3647_data[] = {94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3648_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3649_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3650_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3651_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3652_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3653_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3654_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3716_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3717_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3718_data[] = {87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_3719_data[] = {89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3720_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3721_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3722_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3723_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3724_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3725_data[] = {28, 31, 32,
-                                                                   35, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3726_data[] = {31, 35, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3727_data[] = {30, 31, 34,
-                                                                   35, 86, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3728_data[] = {86, 90};
-int garden_map_collision_collision_mesh_hash_bucket_3729_data[] = {90, 93};
-int garden_map_collision_collision_mesh_hash_bucket_3730_data[] = {93, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3731_data[] = {94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3732_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3733_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3734_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3735_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3736_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3737_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3738_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3800_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3801_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3802_data[] = {87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_3803_data[] = {89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3804_data[] = {88, 89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3805_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3806_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3807_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3808_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3809_data[] = {28, 29, 32,
-                                                                   33, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3810_data[] = {29, 33, 86,
-                                                                   88};
-int garden_map_collision_collision_mesh_hash_bucket_3811_data[] = {29, 30, 33,
-                                                                   34, 86, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3812_data[] = {86, 90};
-int garden_map_collision_collision_mesh_hash_bucket_3813_data[] = {90, 93};
-int garden_map_collision_collision_mesh_hash_bucket_3814_data[] = {93, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3815_data[] = {94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3816_data[] = {94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3817_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3818_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3819_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3820_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3821_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3822_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3884_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3885_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3886_data[] = {87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_3887_data[] = {87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_3888_data[] = {89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3889_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3890_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3891_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3892_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3893_data[] = {88};
-int garden_map_collision_collision_mesh_hash_bucket_3894_data[] = {86, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3895_data[] = {86, 90};
-int garden_map_collision_collision_mesh_hash_bucket_3896_data[] = {86, 90};
-int garden_map_collision_collision_mesh_hash_bucket_3897_data[] = {90, 93};
-int garden_map_collision_collision_mesh_hash_bucket_3898_data[] = {93, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3899_data[] = {93, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3900_data[] = {94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3901_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3902_data[] = {94};
-int garden_map_collision_collision_mesh_hash_bucket_3903_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3904_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3905_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3906_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3968_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3969_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3970_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_3971_data[] = {87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_3972_data[] = {89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3973_data[] = {89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3974_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3975_data[] = {
-    10, 11, 13, 14, 15, 16, 18, 19, 88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_3976_data[] = {
-    11, 13, 14, 16, 18, 19, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3977_data[] = {
-    11, 13, 14, 16, 18, 19, 86, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3978_data[] = {
-    11, 13, 14, 16, 18, 19, 86, 88};
-int garden_map_collision_collision_mesh_hash_bucket_3979_data[] = {
-    11, 12, 13, 14, 16, 17, 18, 19, 86, 90};
-int garden_map_collision_collision_mesh_hash_bucket_3980_data[] = {
-    0, 1, 3, 4, 5, 6, 8, 9, 90};
-int garden_map_collision_collision_mesh_hash_bucket_3981_data[] = {
-    1, 3, 4, 6, 8, 9, 90, 93};
-int garden_map_collision_collision_mesh_hash_bucket_3982_data[] = {1, 3, 4, 6,
-                                                                   8, 9, 93};
-int garden_map_collision_collision_mesh_hash_bucket_3983_data[] = {
-    1, 3, 4, 6, 8, 9, 93, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3984_data[] = {
-    1, 2, 3, 4, 6, 7, 8, 9, 94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3985_data[] = {94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_3986_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3987_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_3988_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3989_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_3990_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_4052_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_4053_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_4054_data[] = {87};
-int garden_map_collision_collision_mesh_hash_bucket_4055_data[] = {87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_4056_data[] = {87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_4057_data[] = {89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_4058_data[] = {89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_4059_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_4060_data[] = {88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_4061_data[] = {86, 88};
-int garden_map_collision_collision_mesh_hash_bucket_4062_data[] = {86};
-int garden_map_collision_collision_mesh_hash_bucket_4063_data[] = {86, 90};
-int garden_map_collision_collision_mesh_hash_bucket_4064_data[] = {90};
-int garden_map_collision_collision_mesh_hash_bucket_4065_data[] = {90, 93};
-int garden_map_collision_collision_mesh_hash_bucket_4066_data[] = {93};
-int garden_map_collision_collision_mesh_hash_bucket_4067_data[] = {93, 95};
-int garden_map_collision_collision_mesh_hash_bucket_4068_data[] = {95};
-int garden_map_collision_collision_mesh_hash_bucket_4069_data[] = {94, 95};
-int garden_map_collision_collision_mesh_hash_bucket_4070_data[] = {92, 94};
-int garden_map_collision_collision_mesh_hash_bucket_4071_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_4072_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_4073_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_4074_data[] = {92};
-int garden_map_collision_collision_mesh_hash_bucket_4136_data[] = {58, 66, 87};
-int garden_map_collision_collision_mesh_hash_bucket_4137_data[] = {58, 66, 87};
-int garden_map_collision_collision_mesh_hash_bucket_4138_data[] = {66, 87};
-int garden_map_collision_collision_mesh_hash_bucket_4139_data[] = {66, 87};
-int garden_map_collision_collision_mesh_hash_bucket_4140_data[] = {59, 66, 67,
-                                                                   87, 89};
-int garden_map_collision_collision_mesh_hash_bucket_4141_data[] = {67, 89};
-int garden_map_collision_collision_mesh_hash_bucket_4142_data[] = {60, 67, 68,
-                                                                   89, 91};
-int garden_map_collision_collision_mesh_hash_bucket_4143_data[] = {68, 91};
-int garden_map_collision_collision_mesh_hash_bucket_4144_data[] = {61, 68, 69,
-                                                                   86, 88, 91};
-int garden_map_collision_collision_mesh_hash_bucket_4145_data[] = {61, 69, 86,
-                                                                   88};
-int garden_map_collision_collision_mesh_hash_bucket_4146_data[] = {69, 86};
-int garden_map_collision_collision_mesh_hash_bucket_4147_data[] = {69, 74, 80,
-                                                                   86, 90};
-int garden_map_collision_collision_mesh_hash_bucket_4148_data[] = {80, 90};
-int garden_map_collision_collision_mesh_hash_bucket_4149_data[] = {75, 80, 90,
-                                                                   93};
-int garden_map_collision_collision_mesh_hash_bucket_4150_data[] = {75, 93};
-int garden_map_collision_collision_mesh_hash_bucket_4151_data[] = {75, 76, 81,
-                                                                   93, 95};
-int garden_map_collision_collision_mesh_hash_bucket_4152_data[] = {76, 95};
-int garden_map_collision_collision_mesh_hash_bucket_4153_data[] = {76, 82, 94,
-                                                                   95};
-int garden_map_collision_collision_mesh_hash_bucket_4154_data[] = {76, 82, 92,
-                                                                   94, 95, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4155_data[] = {92, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4156_data[] = {92, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4157_data[] = {92, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4158_data[] = {92, 96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4220_data[] = {58};
-int garden_map_collision_collision_mesh_hash_bucket_4221_data[] = {58, 66};
-int garden_map_collision_collision_mesh_hash_bucket_4222_data[] = {58, 66};
-int garden_map_collision_collision_mesh_hash_bucket_4223_data[] = {66};
-int garden_map_collision_collision_mesh_hash_bucket_4224_data[] = {59, 66, 67};
-int garden_map_collision_collision_mesh_hash_bucket_4225_data[] = {59, 67};
-int garden_map_collision_collision_mesh_hash_bucket_4226_data[] = {60, 67, 68};
-int garden_map_collision_collision_mesh_hash_bucket_4227_data[] = {60, 68};
-int garden_map_collision_collision_mesh_hash_bucket_4228_data[] = {61, 68};
-int garden_map_collision_collision_mesh_hash_bucket_4229_data[] = {61, 69};
-int garden_map_collision_collision_mesh_hash_bucket_4230_data[] = {61, 69};
-int garden_map_collision_collision_mesh_hash_bucket_4231_data[] = {69, 74, 80};
-int garden_map_collision_collision_mesh_hash_bucket_4232_data[] = {74, 80};
-int garden_map_collision_collision_mesh_hash_bucket_4233_data[] = {75, 80};
-int garden_map_collision_collision_mesh_hash_bucket_4234_data[] = {75, 81};
-int garden_map_collision_collision_mesh_hash_bucket_4235_data[] = {75, 76, 81};
-int garden_map_collision_collision_mesh_hash_bucket_4236_data[] = {76, 82};
-int garden_map_collision_collision_mesh_hash_bucket_4237_data[] = {76, 82};
-int garden_map_collision_collision_mesh_hash_bucket_4238_data[] = {82, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4239_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4240_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4241_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4242_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4304_data[] = {58, 62};
-int garden_map_collision_collision_mesh_hash_bucket_4305_data[] = {58, 62};
-int garden_map_collision_collision_mesh_hash_bucket_4306_data[] = {58, 62, 66};
-int garden_map_collision_collision_mesh_hash_bucket_4307_data[] = {58, 62, 66};
-int garden_map_collision_collision_mesh_hash_bucket_4308_data[] = {58, 59, 62,
-                                                                   63, 66, 70};
-int garden_map_collision_collision_mesh_hash_bucket_4309_data[] = {59, 63, 67};
-int garden_map_collision_collision_mesh_hash_bucket_4310_data[] = {
-    59, 60, 63, 64, 67, 71, 72};
-int garden_map_collision_collision_mesh_hash_bucket_4311_data[] = {60, 68, 72};
-int garden_map_collision_collision_mesh_hash_bucket_4312_data[] = {60, 61, 65,
-                                                                   68, 72, 73};
-int garden_map_collision_collision_mesh_hash_bucket_4313_data[] = {61, 73};
-int garden_map_collision_collision_mesh_hash_bucket_4314_data[] = {61, 69, 73};
-int garden_map_collision_collision_mesh_hash_bucket_4315_data[] = {61, 69, 73,
-                                                                   74, 77, 83};
-int garden_map_collision_collision_mesh_hash_bucket_4316_data[] = {74, 80, 83};
-int garden_map_collision_collision_mesh_hash_bucket_4317_data[] = {
-    74, 75, 78, 80, 81, 83, 84};
-int garden_map_collision_collision_mesh_hash_bucket_4318_data[] = {75, 81, 84};
-int garden_map_collision_collision_mesh_hash_bucket_4319_data[] = {76, 79, 81,
-                                                                   82, 84};
-int garden_map_collision_collision_mesh_hash_bucket_4320_data[] = {76, 79, 82};
-int garden_map_collision_collision_mesh_hash_bucket_4321_data[] = {79, 82, 85};
-int garden_map_collision_collision_mesh_hash_bucket_4322_data[] = {79, 82, 85,
-                                                                   96};
-int garden_map_collision_collision_mesh_hash_bucket_4323_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4324_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4325_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4326_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4388_data[] = {62};
-int garden_map_collision_collision_mesh_hash_bucket_4389_data[] = {62};
-int garden_map_collision_collision_mesh_hash_bucket_4390_data[] = {62, 70};
-int garden_map_collision_collision_mesh_hash_bucket_4391_data[] = {62, 70};
-int garden_map_collision_collision_mesh_hash_bucket_4392_data[] = {62, 63, 70};
-int garden_map_collision_collision_mesh_hash_bucket_4393_data[] = {63, 71};
-int garden_map_collision_collision_mesh_hash_bucket_4394_data[] = {63, 64, 71,
-                                                                   72};
-int garden_map_collision_collision_mesh_hash_bucket_4395_data[] = {64, 72};
-int garden_map_collision_collision_mesh_hash_bucket_4396_data[] = {65, 72, 73};
-int garden_map_collision_collision_mesh_hash_bucket_4397_data[] = {65, 73};
-int garden_map_collision_collision_mesh_hash_bucket_4398_data[] = {73};
-int garden_map_collision_collision_mesh_hash_bucket_4399_data[] = {73, 77, 83};
-int garden_map_collision_collision_mesh_hash_bucket_4400_data[] = {77, 83};
-int garden_map_collision_collision_mesh_hash_bucket_4401_data[] = {78, 83, 84};
-int garden_map_collision_collision_mesh_hash_bucket_4402_data[] = {78, 84};
-int garden_map_collision_collision_mesh_hash_bucket_4403_data[] = {79, 84};
-int garden_map_collision_collision_mesh_hash_bucket_4404_data[] = {79, 85};
-int garden_map_collision_collision_mesh_hash_bucket_4405_data[] = {79, 85};
-int garden_map_collision_collision_mesh_hash_bucket_4406_data[] = {85, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4407_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4408_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4409_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4410_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4472_data[] = {62};
-int garden_map_collision_collision_mesh_hash_bucket_4473_data[] = {62, 70};
-int garden_map_collision_collision_mesh_hash_bucket_4474_data[] = {62, 70};
-int garden_map_collision_collision_mesh_hash_bucket_4475_data[] = {70};
-int garden_map_collision_collision_mesh_hash_bucket_4476_data[] = {63, 70, 71};
-int garden_map_collision_collision_mesh_hash_bucket_4477_data[] = {63, 71};
-int garden_map_collision_collision_mesh_hash_bucket_4478_data[] = {64, 71};
-int garden_map_collision_collision_mesh_hash_bucket_4479_data[] = {64, 72};
-int garden_map_collision_collision_mesh_hash_bucket_4480_data[] = {64, 65, 72};
-int garden_map_collision_collision_mesh_hash_bucket_4481_data[] = {65, 73};
-int garden_map_collision_collision_mesh_hash_bucket_4482_data[] = {65, 73};
-int garden_map_collision_collision_mesh_hash_bucket_4483_data[] = {73, 77};
-int garden_map_collision_collision_mesh_hash_bucket_4484_data[] = {77, 83};
-int garden_map_collision_collision_mesh_hash_bucket_4485_data[] = {77, 78, 83};
-int garden_map_collision_collision_mesh_hash_bucket_4486_data[] = {78, 84};
-int garden_map_collision_collision_mesh_hash_bucket_4487_data[] = {78, 79, 84};
-int garden_map_collision_collision_mesh_hash_bucket_4488_data[] = {79, 85};
-int garden_map_collision_collision_mesh_hash_bucket_4489_data[] = {85};
-int garden_map_collision_collision_mesh_hash_bucket_4490_data[] = {85, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4491_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4492_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4493_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4494_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4556_data[] = {62, 70, 148};
-int garden_map_collision_collision_mesh_hash_bucket_4557_data[] = {62, 70, 148};
-int garden_map_collision_collision_mesh_hash_bucket_4558_data[] = {70, 148};
-int garden_map_collision_collision_mesh_hash_bucket_4559_data[] = {70, 148,
-                                                                   168};
-int garden_map_collision_collision_mesh_hash_bucket_4560_data[] = {
-    63, 70, 71, 148, 149, 168};
-int garden_map_collision_collision_mesh_hash_bucket_4561_data[] = {71, 149,
-                                                                   169};
-int garden_map_collision_collision_mesh_hash_bucket_4562_data[] = {
-    64, 71, 149, 150, 169, 170};
-int garden_map_collision_collision_mesh_hash_bucket_4563_data[] = {64, 150,
-                                                                   170};
-int garden_map_collision_collision_mesh_hash_bucket_4564_data[] = {
-    64, 65, 72, 151, 170, 171};
-int garden_map_collision_collision_mesh_hash_bucket_4565_data[] = {65, 151,
-                                                                   171};
-int garden_map_collision_collision_mesh_hash_bucket_4566_data[] = {65, 73, 171};
-int garden_map_collision_collision_mesh_hash_bucket_4567_data[] = {36, 46, 65,
-                                                                   73, 77, 171};
-int garden_map_collision_collision_mesh_hash_bucket_4568_data[] = {46, 77};
-int garden_map_collision_collision_mesh_hash_bucket_4569_data[] = {37, 46, 47,
-                                                                   77, 78, 83};
-int garden_map_collision_collision_mesh_hash_bucket_4570_data[] = {37, 47, 78};
-int garden_map_collision_collision_mesh_hash_bucket_4571_data[] = {47, 48, 78,
-                                                                   79, 84, 85};
-int garden_map_collision_collision_mesh_hash_bucket_4572_data[] = {48, 79, 85};
-int garden_map_collision_collision_mesh_hash_bucket_4573_data[] = {38, 48, 49,
-                                                                   85};
-int garden_map_collision_collision_mesh_hash_bucket_4574_data[] = {38, 48, 49,
-                                                                   85, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4575_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4576_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4577_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4578_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4640_data[] = {148};
-int garden_map_collision_collision_mesh_hash_bucket_4641_data[] = {148, 168};
-int garden_map_collision_collision_mesh_hash_bucket_4642_data[] = {148, 168};
-int garden_map_collision_collision_mesh_hash_bucket_4643_data[] = {148, 168};
-int garden_map_collision_collision_mesh_hash_bucket_4644_data[] = {149, 168};
-int garden_map_collision_collision_mesh_hash_bucket_4645_data[] = {149, 169};
-int garden_map_collision_collision_mesh_hash_bucket_4646_data[] = {150, 169};
-int garden_map_collision_collision_mesh_hash_bucket_4647_data[] = {150, 170};
-int garden_map_collision_collision_mesh_hash_bucket_4648_data[] = {150, 151,
-                                                                   170};
-int garden_map_collision_collision_mesh_hash_bucket_4649_data[] = {151, 171};
-int garden_map_collision_collision_mesh_hash_bucket_4650_data[] = {151, 171};
-int garden_map_collision_collision_mesh_hash_bucket_4651_data[] = {36, 46, 171};
-int garden_map_collision_collision_mesh_hash_bucket_4652_data[] = {36, 46};
-int garden_map_collision_collision_mesh_hash_bucket_4653_data[] = {37, 46};
-int garden_map_collision_collision_mesh_hash_bucket_4654_data[] = {37, 47};
-int garden_map_collision_collision_mesh_hash_bucket_4655_data[] = {37, 47, 48};
-int garden_map_collision_collision_mesh_hash_bucket_4656_data[] = {38, 48};
-int garden_map_collision_collision_mesh_hash_bucket_4657_data[] = {38, 48, 49};
-int garden_map_collision_collision_mesh_hash_bucket_4658_data[] = {49, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4659_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4660_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4661_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4662_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4724_data[] = {148, 152,
-                                                                   168, 172};
-int garden_map_collision_collision_mesh_hash_bucket_4725_data[] = {148, 152,
-                                                                   168, 172};
-int garden_map_collision_collision_mesh_hash_bucket_4726_data[] = {168, 172};
-int garden_map_collision_collision_mesh_hash_bucket_4727_data[] = {168, 172};
-int garden_map_collision_collision_mesh_hash_bucket_4728_data[] = {
-    149, 153, 168, 169, 172, 173};
-int garden_map_collision_collision_mesh_hash_bucket_4729_data[] = {149, 169,
-                                                                   173};
-int garden_map_collision_collision_mesh_hash_bucket_4730_data[] = {
-    98, 99, 101, 102, 103, 104, 106, 107, 150, 154, 169, 173, 174};
-int garden_map_collision_collision_mesh_hash_bucket_4731_data[] = {
-    99,  100, 101, 102, 104, 105, 106, 107, 118, 119,
-    120, 121, 122, 123, 124, 125, 126, 127, 150, 174};
-int garden_map_collision_collision_mesh_hash_bucket_4732_data[] = {
-    150, 151, 155, 170, 174};
-int garden_map_collision_collision_mesh_hash_bucket_4733_data[] = {151, 155};
-int garden_map_collision_collision_mesh_hash_bucket_4734_data[] = {
-    128, 131, 133, 136, 137, 138, 139, 140, 141, 142,
-    143, 144, 145, 146, 147, 151, 155, 171, 175};
-int garden_map_collision_collision_mesh_hash_bucket_4735_data[] = {
-    36, 39, 51, 130, 131, 132, 133, 135, 136, 137, 151, 155, 171, 175};
-int garden_map_collision_collision_mesh_hash_bucket_4736_data[] = {36, 46, 51};
-int garden_map_collision_collision_mesh_hash_bucket_4737_data[] = {36, 37, 40,
-                                                                   46, 51, 52};
-int garden_map_collision_collision_mesh_hash_bucket_4738_data[] = {37, 52};
-int garden_map_collision_collision_mesh_hash_bucket_4739_data[] = {37, 38, 47,
-                                                                   48, 52};
-int garden_map_collision_collision_mesh_hash_bucket_4740_data[] = {38, 48, 49};
-int garden_map_collision_collision_mesh_hash_bucket_4741_data[] = {38, 49};
-int garden_map_collision_collision_mesh_hash_bucket_4742_data[] = {49, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4743_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4744_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4745_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4746_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4808_data[] = {152};
-int garden_map_collision_collision_mesh_hash_bucket_4809_data[] = {152, 172};
-int garden_map_collision_collision_mesh_hash_bucket_4810_data[] = {152, 172};
-int garden_map_collision_collision_mesh_hash_bucket_4811_data[] = {152, 172};
-int garden_map_collision_collision_mesh_hash_bucket_4812_data[] = {153, 172,
-                                                                   173};
-int garden_map_collision_collision_mesh_hash_bucket_4813_data[] = {153, 173};
-int garden_map_collision_collision_mesh_hash_bucket_4814_data[] = {154, 173,
-                                                                   174};
-int garden_map_collision_collision_mesh_hash_bucket_4815_data[] = {
-    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 154, 174};
-int garden_map_collision_collision_mesh_hash_bucket_4816_data[] = {155, 174};
-int garden_map_collision_collision_mesh_hash_bucket_4817_data[] = {155, 175};
-int garden_map_collision_collision_mesh_hash_bucket_4818_data[] = {
-    128, 129, 133, 138, 139, 140, 142, 143, 144, 145, 155, 175};
-int garden_map_collision_collision_mesh_hash_bucket_4819_data[] = {
-    39, 51, 129, 130, 132, 133, 134, 135, 137, 175};
-int garden_map_collision_collision_mesh_hash_bucket_4820_data[] = {39, 51};
-int garden_map_collision_collision_mesh_hash_bucket_4821_data[] = {40, 51, 52};
-int garden_map_collision_collision_mesh_hash_bucket_4822_data[] = {40, 52};
-int garden_map_collision_collision_mesh_hash_bucket_4823_data[] = {38, 52};
-int garden_map_collision_collision_mesh_hash_bucket_4824_data[] = {38, 49};
-int garden_map_collision_collision_mesh_hash_bucket_4825_data[] = {49};
-int garden_map_collision_collision_mesh_hash_bucket_4826_data[] = {49, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4827_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4828_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4829_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4830_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4892_data[] = {152, 156,
-                                                                   176};
-int garden_map_collision_collision_mesh_hash_bucket_4893_data[] = {152, 156,
-                                                                   176};
-int garden_map_collision_collision_mesh_hash_bucket_4894_data[] = {152, 176};
-int garden_map_collision_collision_mesh_hash_bucket_4895_data[] = {152, 172,
-                                                                   176};
-int garden_map_collision_collision_mesh_hash_bucket_4896_data[] = {
-    152, 153, 157, 172, 176, 177};
-int garden_map_collision_collision_mesh_hash_bucket_4897_data[] = {153, 173,
-                                                                   177};
-int garden_map_collision_collision_mesh_hash_bucket_4898_data[] = {
-    153, 154, 158, 173, 177};
-int garden_map_collision_collision_mesh_hash_bucket_4899_data[] = {154, 158,
-                                                                   174};
-int garden_map_collision_collision_mesh_hash_bucket_4900_data[] = {
-    154, 155, 158, 159, 174, 175, 178};
-int garden_map_collision_collision_mesh_hash_bucket_4901_data[] = {155, 159,
-                                                                   175};
-int garden_map_collision_collision_mesh_hash_bucket_4902_data[] = {159, 175,
-                                                                   179};
-int garden_map_collision_collision_mesh_hash_bucket_4903_data[] = {39, 41, 159,
-                                                                   175, 179};
-int garden_map_collision_collision_mesh_hash_bucket_4904_data[] = {39, 41, 51};
-int garden_map_collision_collision_mesh_hash_bucket_4905_data[] = {39, 40, 41,
-                                                                   42, 51, 53};
-int garden_map_collision_collision_mesh_hash_bucket_4906_data[] = {40, 42, 52};
-int garden_map_collision_collision_mesh_hash_bucket_4907_data[] = {
-    38, 40, 42, 49, 50, 52, 54};
-int garden_map_collision_collision_mesh_hash_bucket_4908_data[] = {38, 49, 50};
-int garden_map_collision_collision_mesh_hash_bucket_4909_data[] = {49};
-int garden_map_collision_collision_mesh_hash_bucket_4910_data[] = {49, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4911_data[] = {96};
-int garden_map_collision_collision_mesh_hash_bucket_4912_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4913_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4914_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4976_data[] = {156};
-int garden_map_collision_collision_mesh_hash_bucket_4977_data[] = {156, 176};
-int garden_map_collision_collision_mesh_hash_bucket_4978_data[] = {156, 176};
-int garden_map_collision_collision_mesh_hash_bucket_4979_data[] = {176};
-int garden_map_collision_collision_mesh_hash_bucket_4980_data[] = {157, 176,
-                                                                   177};
-int garden_map_collision_collision_mesh_hash_bucket_4981_data[] = {157, 177};
-int garden_map_collision_collision_mesh_hash_bucket_4982_data[] = {158, 177};
-int garden_map_collision_collision_mesh_hash_bucket_4983_data[] = {158, 178};
-int garden_map_collision_collision_mesh_hash_bucket_4984_data[] = {158, 159,
-                                                                   178};
-int garden_map_collision_collision_mesh_hash_bucket_4985_data[] = {159, 179};
-int garden_map_collision_collision_mesh_hash_bucket_4986_data[] = {159, 179};
-int garden_map_collision_collision_mesh_hash_bucket_4987_data[] = {41, 179};
-int garden_map_collision_collision_mesh_hash_bucket_4988_data[] = {41, 53};
-int garden_map_collision_collision_mesh_hash_bucket_4989_data[] = {41, 42, 53};
-int garden_map_collision_collision_mesh_hash_bucket_4990_data[] = {42, 54};
-int garden_map_collision_collision_mesh_hash_bucket_4991_data[] = {42, 50, 54};
-int garden_map_collision_collision_mesh_hash_bucket_4992_data[] = {49, 50};
-int garden_map_collision_collision_mesh_hash_bucket_4993_data[] = {49, 50};
-int garden_map_collision_collision_mesh_hash_bucket_4994_data[] = {49, 96};
-int garden_map_collision_collision_mesh_hash_bucket_4995_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4996_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_4997_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_4998_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5060_data[] = {156};
-int garden_map_collision_collision_mesh_hash_bucket_5061_data[] = {156};
-int garden_map_collision_collision_mesh_hash_bucket_5062_data[] = {156, 176};
-int garden_map_collision_collision_mesh_hash_bucket_5063_data[] = {156, 176};
-int garden_map_collision_collision_mesh_hash_bucket_5064_data[] = {156, 157,
-                                                                   176};
-int garden_map_collision_collision_mesh_hash_bucket_5065_data[] = {157, 177};
-int garden_map_collision_collision_mesh_hash_bucket_5066_data[] = {157, 158,
-                                                                   177, 178};
-int garden_map_collision_collision_mesh_hash_bucket_5067_data[] = {158, 178};
-int garden_map_collision_collision_mesh_hash_bucket_5068_data[] = {159, 178,
-                                                                   179};
-int garden_map_collision_collision_mesh_hash_bucket_5069_data[] = {159, 179};
-int garden_map_collision_collision_mesh_hash_bucket_5070_data[] = {179};
-int garden_map_collision_collision_mesh_hash_bucket_5071_data[] = {41, 53, 179};
-int garden_map_collision_collision_mesh_hash_bucket_5072_data[] = {41, 53};
-int garden_map_collision_collision_mesh_hash_bucket_5073_data[] = {42, 53, 54};
-int garden_map_collision_collision_mesh_hash_bucket_5074_data[] = {42, 54};
-int garden_map_collision_collision_mesh_hash_bucket_5075_data[] = {50, 54};
-int garden_map_collision_collision_mesh_hash_bucket_5076_data[] = {50};
-int garden_map_collision_collision_mesh_hash_bucket_5077_data[] = {49, 50};
-int garden_map_collision_collision_mesh_hash_bucket_5078_data[] = {49, 96};
-int garden_map_collision_collision_mesh_hash_bucket_5079_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_5080_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5081_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5082_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5144_data[] = {156, 164};
-int garden_map_collision_collision_mesh_hash_bucket_5145_data[] = {156, 164,
-                                                                   184};
-int garden_map_collision_collision_mesh_hash_bucket_5146_data[] = {156, 164,
-                                                                   184};
-int garden_map_collision_collision_mesh_hash_bucket_5147_data[] = {156, 164,
-                                                                   184};
-int garden_map_collision_collision_mesh_hash_bucket_5148_data[] = {
-    156, 157, 164, 165, 176, 184, 185};
-int garden_map_collision_collision_mesh_hash_bucket_5149_data[] = {157, 165,
-                                                                   185};
-int garden_map_collision_collision_mesh_hash_bucket_5150_data[] = {
-    157, 158, 165, 166, 177, 178, 185, 186};
-int garden_map_collision_collision_mesh_hash_bucket_5151_data[] = {166, 178,
-                                                                   186};
-int garden_map_collision_collision_mesh_hash_bucket_5152_data[] = {
-    159, 166, 167, 178, 179, 186};
-int garden_map_collision_collision_mesh_hash_bucket_5153_data[] = {167, 179,
-                                                                   187};
-int garden_map_collision_collision_mesh_hash_bucket_5154_data[] = {167, 179,
-                                                                   187};
-int garden_map_collision_collision_mesh_hash_bucket_5155_data[] = {
-    41, 45, 53, 167, 179, 187};
-int garden_map_collision_collision_mesh_hash_bucket_5156_data[] = {45, 53};
-int garden_map_collision_collision_mesh_hash_bucket_5157_data[] = {42, 44, 45,
-                                                                   53, 54, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5158_data[] = {44, 54};
-int garden_map_collision_collision_mesh_hash_bucket_5159_data[] = {43, 44, 50,
-                                                                   54, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5160_data[] = {43, 50};
-int garden_map_collision_collision_mesh_hash_bucket_5161_data[] = {43, 49, 50,
-                                                                   55};
-int garden_map_collision_collision_mesh_hash_bucket_5162_data[] = {43, 49, 50,
-                                                                   55, 96};
-int garden_map_collision_collision_mesh_hash_bucket_5163_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_5164_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5165_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5166_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5228_data[] = {163, 164,
-                                                                   184};
-int garden_map_collision_collision_mesh_hash_bucket_5229_data[] = {163, 164,
-                                                                   184};
-int garden_map_collision_collision_mesh_hash_bucket_5230_data[] = {163, 184};
-int garden_map_collision_collision_mesh_hash_bucket_5231_data[] = {163, 183,
-                                                                   184};
-int garden_map_collision_collision_mesh_hash_bucket_5232_data[] = {
-    162, 163, 165, 183, 184, 185};
-int garden_map_collision_collision_mesh_hash_bucket_5233_data[] = {162, 185};
-int garden_map_collision_collision_mesh_hash_bucket_5234_data[] = {
-    161, 162, 166, 182, 185, 186};
-int garden_map_collision_collision_mesh_hash_bucket_5235_data[] = {161, 186};
-int garden_map_collision_collision_mesh_hash_bucket_5236_data[] = {
-    160, 161, 167, 181, 186, 187};
-int garden_map_collision_collision_mesh_hash_bucket_5237_data[] = {160, 167,
-                                                                   187};
-int garden_map_collision_collision_mesh_hash_bucket_5238_data[] = {160, 180,
-                                                                   187};
-int garden_map_collision_collision_mesh_hash_bucket_5239_data[] = {45, 160, 180,
-                                                                   187};
-int garden_map_collision_collision_mesh_hash_bucket_5240_data[] = {45, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5241_data[] = {44, 45, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5242_data[] = {44};
-int garden_map_collision_collision_mesh_hash_bucket_5243_data[] = {43, 44, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5244_data[] = {43};
-int garden_map_collision_collision_mesh_hash_bucket_5245_data[] = {43, 55};
-int garden_map_collision_collision_mesh_hash_bucket_5246_data[] = {55, 96};
-int garden_map_collision_collision_mesh_hash_bucket_5247_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_5248_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5249_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5250_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5312_data[] = {163};
-int garden_map_collision_collision_mesh_hash_bucket_5313_data[] = {163};
-int garden_map_collision_collision_mesh_hash_bucket_5314_data[] = {163, 183};
-int garden_map_collision_collision_mesh_hash_bucket_5315_data[] = {163, 183};
-int garden_map_collision_collision_mesh_hash_bucket_5316_data[] = {162, 183};
-int garden_map_collision_collision_mesh_hash_bucket_5317_data[] = {162, 182};
-int garden_map_collision_collision_mesh_hash_bucket_5318_data[] = {161, 162,
-                                                                   182};
-int garden_map_collision_collision_mesh_hash_bucket_5319_data[] = {161, 181};
-int garden_map_collision_collision_mesh_hash_bucket_5320_data[] = {160, 161,
-                                                                   181};
-int garden_map_collision_collision_mesh_hash_bucket_5321_data[] = {160};
-int garden_map_collision_collision_mesh_hash_bucket_5322_data[] = {160, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5323_data[] = {45, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5324_data[] = {45, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5325_data[] = {44, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5326_data[] = {44, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5327_data[] = {43, 44, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5328_data[] = {43, 55};
-int garden_map_collision_collision_mesh_hash_bucket_5329_data[] = {43, 55};
-int garden_map_collision_collision_mesh_hash_bucket_5330_data[] = {55, 96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_5331_data[] = {96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_5332_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5333_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5334_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5396_data[] = {163};
-int garden_map_collision_collision_mesh_hash_bucket_5397_data[] = {163};
-int garden_map_collision_collision_mesh_hash_bucket_5398_data[] = {163, 183};
-int garden_map_collision_collision_mesh_hash_bucket_5399_data[] = {183};
-int garden_map_collision_collision_mesh_hash_bucket_5400_data[] = {162, 183};
-int garden_map_collision_collision_mesh_hash_bucket_5401_data[] = {162, 182};
-int garden_map_collision_collision_mesh_hash_bucket_5402_data[] = {161, 182};
-int garden_map_collision_collision_mesh_hash_bucket_5403_data[] = {161, 181};
-int garden_map_collision_collision_mesh_hash_bucket_5404_data[] = {160, 181};
-int garden_map_collision_collision_mesh_hash_bucket_5405_data[] = {160, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5406_data[] = {160, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5407_data[] = {45, 57, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5408_data[] = {45, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5409_data[] = {44, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5410_data[] = {44, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5411_data[] = {43, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5412_data[] = {43, 55};
-int garden_map_collision_collision_mesh_hash_bucket_5413_data[] = {55};
-int garden_map_collision_collision_mesh_hash_bucket_5414_data[] = {55, 96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_5415_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5416_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5417_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5418_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5480_data[] = {163};
-int garden_map_collision_collision_mesh_hash_bucket_5481_data[] = {163, 183};
-int garden_map_collision_collision_mesh_hash_bucket_5482_data[] = {163, 183};
-int garden_map_collision_collision_mesh_hash_bucket_5483_data[] = {183};
-int garden_map_collision_collision_mesh_hash_bucket_5484_data[] = {162, 182,
-                                                                   183};
-int garden_map_collision_collision_mesh_hash_bucket_5485_data[] = {162, 182};
-int garden_map_collision_collision_mesh_hash_bucket_5486_data[] = {161, 181,
-                                                                   182};
-int garden_map_collision_collision_mesh_hash_bucket_5487_data[] = {161, 181};
-int garden_map_collision_collision_mesh_hash_bucket_5488_data[] = {160, 181};
-int garden_map_collision_collision_mesh_hash_bucket_5489_data[] = {160, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5490_data[] = {180};
-int garden_map_collision_collision_mesh_hash_bucket_5491_data[] = {45, 57, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5492_data[] = {57};
-int garden_map_collision_collision_mesh_hash_bucket_5493_data[] = {44, 56, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5494_data[] = {44, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5495_data[] = {43, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5496_data[] = {43, 55};
-int garden_map_collision_collision_mesh_hash_bucket_5497_data[] = {55};
-int garden_map_collision_collision_mesh_hash_bucket_5498_data[] = {55, 96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_5499_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5500_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5501_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5502_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5564_data[] = {163};
-int garden_map_collision_collision_mesh_hash_bucket_5565_data[] = {163, 183};
-int garden_map_collision_collision_mesh_hash_bucket_5566_data[] = {183};
-int garden_map_collision_collision_mesh_hash_bucket_5567_data[] = {183};
-int garden_map_collision_collision_mesh_hash_bucket_5568_data[] = {162, 182,
-                                                                   183};
-int garden_map_collision_collision_mesh_hash_bucket_5569_data[] = {182};
-int garden_map_collision_collision_mesh_hash_bucket_5570_data[] = {161, 181,
-                                                                   182};
-int garden_map_collision_collision_mesh_hash_bucket_5571_data[] = {181};
-int garden_map_collision_collision_mesh_hash_bucket_5572_data[] = {160, 180,
-                                                                   181};
-int garden_map_collision_collision_mesh_hash_bucket_5573_data[] = {160, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5574_data[] = {180};
-int garden_map_collision_collision_mesh_hash_bucket_5575_data[] = {45, 57, 180};
-int garden_map_collision_collision_mesh_hash_bucket_5576_data[] = {57};
-int garden_map_collision_collision_mesh_hash_bucket_5577_data[] = {44, 56, 57};
-int garden_map_collision_collision_mesh_hash_bucket_5578_data[] = {56};
-int garden_map_collision_collision_mesh_hash_bucket_5579_data[] = {43, 55, 56};
-int garden_map_collision_collision_mesh_hash_bucket_5580_data[] = {43, 55};
-int garden_map_collision_collision_mesh_hash_bucket_5581_data[] = {55};
-int garden_map_collision_collision_mesh_hash_bucket_5582_data[] = {55, 96, 97};
-int garden_map_collision_collision_mesh_hash_bucket_5583_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5584_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5585_data[] = {97};
-int garden_map_collision_collision_mesh_hash_bucket_5586_data[] = {97};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3380 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_3380_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3381 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_3381_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3382 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3382_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3383 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3383_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3384 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3384_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3385 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3385_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3386 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3386_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3387 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3387_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3388 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3388_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3389 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3389_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3390 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3390_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3391 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3391_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3392 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3392_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3393 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_3393_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3394 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3394_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3395 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3395_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3396 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3396_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3397 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3397_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3398 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3398_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3399 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3399_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3400 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3400_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3401 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3401_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3402 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3402_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3464 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3464_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3465 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_3465_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3466 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3466_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3467 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3467_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3468 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3468_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3469 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3469_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3470 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3470_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3471 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3471_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3472 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3472_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3473 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3473_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3474 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3474_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3475 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3475_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3476 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3476_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3477 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_3477_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3478 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3478_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3479 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3479_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3480 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3480_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3481 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3481_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3482 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3482_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3483 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3483_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3484 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3484_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3485 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3485_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3486 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3486_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3548 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3548_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3549 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3549_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3550 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3550_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3551 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3551_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3552 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3552_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3553 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3553_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3554 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3554_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3555 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3555_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3556 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3556_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3557 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_3557_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3558 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3558_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3559 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_3559_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3560 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3560_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3561 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_3561_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3562 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3562_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3563 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3563_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3564 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3564_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3565 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3565_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3566 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3566_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3567 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3567_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3568 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3568_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3569 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3569_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3570 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3570_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3632 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3632_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3633 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3633_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3634 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3634_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3635 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3635_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3636 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3636_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3637 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3637_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3638 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3638_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3639 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3639_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3640 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3640_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3641 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_3641_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3642 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3642_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3643 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_3643_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3644 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3644_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3645 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3645_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3646 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3646_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3647 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3647_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3648 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3648_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3649 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3649_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3650 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3650_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3651 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3651_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3652 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3652_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3653 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3653_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3654 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3654_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3716 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3716_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3717 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3717_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3718 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3718_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3719 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3719_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3720 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3720_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3721 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3721_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3722 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3722_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3723 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3723_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3724 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3724_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3725 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_3725_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3726 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3726_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3727 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_3727_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3728 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3728_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3729 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3729_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3730 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3730_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3731 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3731_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3732 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3732_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3733 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3733_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3734 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3734_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3735 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3735_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3736 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3736_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3737 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3737_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3738 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3738_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3800 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3800_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3801 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3801_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3802 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3802_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3803 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3803_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3804 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_3804_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3805 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3805_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3806 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3806_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3807 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3807_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3808 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3808_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3809 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_3809_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3810 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_3810_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3811 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_3811_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3812 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3812_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3813 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3813_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3814 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3814_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3815 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3815_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3816 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3816_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3817 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3817_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3818 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3818_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3819 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3819_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3820 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3820_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3821 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3821_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3822 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3822_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3884 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3884_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3885 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3885_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3886 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3886_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3887 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3887_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3888 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3888_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3889 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3889_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3890 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3890_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3891 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3891_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3892 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3892_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3893 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3893_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3894 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3894_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3895 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3895_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3896 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3896_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3897 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3897_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3898 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3898_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3899 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3899_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3900 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3900_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3901 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3901_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3902 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3902_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3903 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3903_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3904 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3904_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3905 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3905_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3906 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3906_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3968 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3968_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3969 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3969_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3970 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3970_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3971 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3971_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3972 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3972_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3973 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3973_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3974 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3974_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3975 = {
-    10, (int*)garden_map_collision_collision_mesh_hash_bucket_3975_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3976 = {
-    7, (int*)garden_map_collision_collision_mesh_hash_bucket_3976_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3977 = {
-    8, (int*)garden_map_collision_collision_mesh_hash_bucket_3977_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3978 = {
-    8, (int*)garden_map_collision_collision_mesh_hash_bucket_3978_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3979 = {
-    10, (int*)garden_map_collision_collision_mesh_hash_bucket_3979_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3980 = {
-    9, (int*)garden_map_collision_collision_mesh_hash_bucket_3980_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3981 = {
-    8, (int*)garden_map_collision_collision_mesh_hash_bucket_3981_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3982 = {
-    7, (int*)garden_map_collision_collision_mesh_hash_bucket_3982_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3983 = {
-    8, (int*)garden_map_collision_collision_mesh_hash_bucket_3983_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3984 = {
-    10, (int*)garden_map_collision_collision_mesh_hash_bucket_3984_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3985 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3985_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3986 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3986_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3987 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_3987_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3988 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3988_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3989 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3989_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_3990 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_3990_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4052 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4052_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4053 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4053_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4054 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4054_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4055 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4055_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4056 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4056_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4057 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4057_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4058 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4058_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4059 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4059_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4060 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4060_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4061 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4061_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4062 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4062_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4063 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4063_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4064 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4064_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4065 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4065_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4066 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4066_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4067 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4067_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4068 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4068_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4069 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4069_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4070 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4070_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4071 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4071_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4072 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4072_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4073 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4073_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4074 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4074_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4136 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4136_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4137 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4137_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4138 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4138_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4139 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4139_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4140 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4140_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4141 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4141_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4142 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4142_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4143 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4143_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4144 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4144_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4145 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_4145_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4146 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4146_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4147 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4147_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4148 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4148_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4149 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_4149_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4150 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4150_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4151 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4151_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4152 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4152_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4153 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_4153_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4154 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4154_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4155 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4155_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4156 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4156_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4157 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4157_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4158 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4158_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4220 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4220_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4221 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4221_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4222 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4222_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4223 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4223_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4224 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4224_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4225 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4225_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4226 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4226_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4227 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4227_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4228 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4228_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4229 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4229_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4230 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4230_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4231 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4231_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4232 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4232_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4233 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4233_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4234 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4234_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4235 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4235_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4236 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4236_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4237 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4237_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4238 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4238_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4239 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4239_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4240 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4240_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4241 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4241_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4242 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4242_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4304 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4304_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4305 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4305_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4306 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4306_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4307 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4307_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4308 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4308_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4309 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4309_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4310 = {
-    7, (int*)garden_map_collision_collision_mesh_hash_bucket_4310_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4311 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4311_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4312 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4312_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4313 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4313_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4314 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4314_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4315 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4315_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4316 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4316_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4317 = {
-    7, (int*)garden_map_collision_collision_mesh_hash_bucket_4317_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4318 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4318_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4319 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4319_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4320 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4320_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4321 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4321_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4322 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_4322_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4323 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4323_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4324 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4324_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4325 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4325_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4326 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4326_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4388 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4388_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4389 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4389_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4390 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4390_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4391 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4391_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4392 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4392_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4393 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4393_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4394 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_4394_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4395 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4395_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4396 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4396_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4397 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4397_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4398 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4398_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4399 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4399_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4400 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4400_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4401 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4401_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4402 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4402_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4403 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4403_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4404 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4404_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4405 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4405_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4406 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4406_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4407 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4407_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4408 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4408_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4409 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4409_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4410 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4410_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4472 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4472_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4473 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4473_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4474 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4474_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4475 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4475_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4476 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4476_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4477 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4477_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4478 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4478_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4479 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4479_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4480 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4480_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4481 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4481_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4482 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4482_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4483 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4483_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4484 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4484_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4485 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4485_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4486 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4486_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4487 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4487_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4488 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4488_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4489 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4489_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4490 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4490_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4491 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4491_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4492 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4492_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4493 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4493_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4494 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4494_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4556 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4556_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4557 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4557_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4558 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4558_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4559 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4559_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4560 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4560_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4561 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4561_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4562 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4562_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4563 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4563_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4564 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4564_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4565 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4565_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4566 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4566_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4567 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4567_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4568 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4568_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4569 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4569_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4570 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4570_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4571 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4571_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4572 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4572_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4573 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_4573_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4574 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4574_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4575 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4575_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4576 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4576_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4577 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4577_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4578 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4578_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4640 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4640_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4641 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4641_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4642 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4642_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4643 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4643_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4644 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4644_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4645 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4645_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4646 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4646_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4647 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4647_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4648 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4648_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4649 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4649_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4650 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4650_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4651 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4651_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4652 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4652_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4653 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4653_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4654 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4654_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4655 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4655_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4656 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4656_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4657 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4657_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4658 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4658_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4659 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4659_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4660 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4660_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4661 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4661_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4662 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4662_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4724 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_4724_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4725 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_4725_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4726 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4726_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4727 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4727_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4728 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4728_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4729 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4729_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4730 = {
-    13, (int*)garden_map_collision_collision_mesh_hash_bucket_4730_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4731 = {
-    20, (int*)garden_map_collision_collision_mesh_hash_bucket_4731_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4732 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4732_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4733 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4733_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4734 = {
-    19, (int*)garden_map_collision_collision_mesh_hash_bucket_4734_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4735 = {
-    14, (int*)garden_map_collision_collision_mesh_hash_bucket_4735_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4736 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4736_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4737 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4737_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4738 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4738_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4739 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4739_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4740 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4740_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4741 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4741_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4742 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4742_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4743 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4743_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4744 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4744_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4745 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4745_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4746 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4746_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4808 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4808_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4809 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4809_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4810 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4810_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4811 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4811_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4812 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4812_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4813 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4813_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4814 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4814_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4815 = {
-    12, (int*)garden_map_collision_collision_mesh_hash_bucket_4815_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4816 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4816_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4817 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4817_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4818 = {
-    12, (int*)garden_map_collision_collision_mesh_hash_bucket_4818_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4819 = {
-    10, (int*)garden_map_collision_collision_mesh_hash_bucket_4819_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4820 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4820_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4821 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4821_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4822 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4822_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4823 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4823_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4824 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4824_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4825 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4825_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4826 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4826_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4827 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4827_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4828 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4828_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4829 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4829_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4830 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4830_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4892 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4892_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4893 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4893_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4894 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4894_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4895 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4895_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4896 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4896_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4897 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4897_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4898 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4898_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4899 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4899_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4900 = {
-    7, (int*)garden_map_collision_collision_mesh_hash_bucket_4900_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4901 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4901_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4902 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4902_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4903 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_4903_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4904 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4904_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4905 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_4905_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4906 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4906_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4907 = {
-    7, (int*)garden_map_collision_collision_mesh_hash_bucket_4907_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4908 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4908_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4909 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4909_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4910 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4910_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4911 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4911_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4912 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4912_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4913 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4913_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4914 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4914_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4976 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4976_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4977 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4977_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4978 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4978_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4979 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4979_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4980 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4980_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4981 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4981_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4982 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4982_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4983 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4983_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4984 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4984_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4985 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4985_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4986 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4986_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4987 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4987_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4988 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4988_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4989 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4989_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4990 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4990_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4991 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_4991_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4992 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4992_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4993 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4993_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4994 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4994_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4995 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4995_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4996 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_4996_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4997 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4997_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_4998 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_4998_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5060 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5060_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5061 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5061_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5062 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5062_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5063 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5063_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5064 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5064_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5065 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5065_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5066 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_5066_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5067 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5067_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5068 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5068_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5069 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5069_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5070 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5070_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5071 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5071_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5072 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5072_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5073 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5073_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5074 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5074_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5075 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5075_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5076 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5076_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5077 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5077_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5078 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5078_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5079 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5079_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5080 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5080_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5081 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5081_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5082 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5082_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5144 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5144_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5145 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5145_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5146 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5146_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5147 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5147_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5148 = {
-    7, (int*)garden_map_collision_collision_mesh_hash_bucket_5148_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5149 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5149_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5150 = {
-    8, (int*)garden_map_collision_collision_mesh_hash_bucket_5150_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5151 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5151_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5152 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_5152_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5153 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5153_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5154 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5154_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5155 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_5155_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5156 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5156_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5157 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_5157_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5158 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5158_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5159 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_5159_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5160 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5160_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5161 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_5161_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5162 = {
-    5, (int*)garden_map_collision_collision_mesh_hash_bucket_5162_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5163 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5163_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5164 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5164_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5165 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5165_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5166 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5166_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5228 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5228_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5229 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5229_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5230 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5230_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5231 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5231_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5232 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_5232_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5233 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5233_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5234 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_5234_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5235 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5235_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5236 = {
-    6, (int*)garden_map_collision_collision_mesh_hash_bucket_5236_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5237 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5237_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5238 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5238_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5239 = {
-    4, (int*)garden_map_collision_collision_mesh_hash_bucket_5239_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5240 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5240_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5241 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5241_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5242 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5242_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5243 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5243_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5244 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5244_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5245 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5245_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5246 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5246_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5247 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5247_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5248 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5248_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5249 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5249_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5250 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5250_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5312 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5312_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5313 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5313_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5314 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5314_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5315 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5315_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5316 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5316_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5317 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5317_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5318 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5318_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5319 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5319_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5320 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5320_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5321 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5321_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5322 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5322_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5323 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5323_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5324 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5324_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5325 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5325_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5326 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5326_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5327 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5327_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5328 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5328_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5329 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5329_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5330 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5330_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5331 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5331_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5332 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5332_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5333 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5333_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5334 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5334_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5396 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5396_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5397 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5397_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5398 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5398_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5399 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5399_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5400 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5400_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5401 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5401_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5402 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5402_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5403 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5403_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5404 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5404_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5405 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5405_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5406 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5406_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5407 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5407_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5408 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5408_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5409 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5409_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5410 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5410_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5411 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5411_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5412 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5412_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5413 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5413_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5414 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5414_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5415 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5415_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5416 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5416_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5417 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5417_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5418 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5418_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5480 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5480_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5481 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5481_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5482 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5482_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5483 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5483_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5484 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5484_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5485 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5485_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5486 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5486_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5487 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5487_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5488 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5488_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5489 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5489_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5490 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5490_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5491 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5491_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5492 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5492_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5493 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5493_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5494 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5494_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5495 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5495_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5496 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5496_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5497 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5497_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5498 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5498_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5499 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5499_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5500 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5500_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5501 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5501_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5502 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5502_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5564 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5564_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5565 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5565_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5566 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5566_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5567 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5567_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5568 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5568_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5569 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5569_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5570 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5570_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5571 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5571_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5572 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5572_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5573 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5573_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5574 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5574_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5575 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5575_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5576 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5576_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5577 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5577_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5578 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5578_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5579 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5579_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5580 = {
-    2, (int*)garden_map_collision_collision_mesh_hash_bucket_5580_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5581 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5581_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5582 = {
-    3, (int*)garden_map_collision_collision_mesh_hash_bucket_5582_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5583 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5583_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5584 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5584_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5585 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5585_data};
-SpatialHashBucket garden_map_collision_collision_mesh_hash_bucket_5586 = {
-    1, (int*)garden_map_collision_collision_mesh_hash_bucket_5586_data};
+CollisionMeshTriangle garden_map_collision_collision_mesh_triangle_data
+    [GARDEN_MAP_COLLISION_LENGTH];
 
-SpatialHashBucket* garden_map_collision_collision_mesh_hash_data[] = {
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_3380,
-    &garden_map_collision_collision_mesh_hash_bucket_3381,
-    &garden_map_collision_collision_mesh_hash_bucket_3382,
-    &garden_map_collision_collision_mesh_hash_bucket_3383,
-    &garden_map_collision_collision_mesh_hash_bucket_3384,
-    &garden_map_collision_collision_mesh_hash_bucket_3385,
-    &garden_map_collision_collision_mesh_hash_bucket_3386,
-    &garden_map_collision_collision_mesh_hash_bucket_3387,
-    &garden_map_collision_collision_mesh_hash_bucket_3388,
-    &garden_map_collision_collision_mesh_hash_bucket_3389,
-    &garden_map_collision_collision_mesh_hash_bucket_3390,
-    &garden_map_collision_collision_mesh_hash_bucket_3391,
-    &garden_map_collision_collision_mesh_hash_bucket_3392,
-    &garden_map_collision_collision_mesh_hash_bucket_3393,
-    &garden_map_collision_collision_mesh_hash_bucket_3394,
-    &garden_map_collision_collision_mesh_hash_bucket_3395,
-    &garden_map_collision_collision_mesh_hash_bucket_3396,
-    &garden_map_collision_collision_mesh_hash_bucket_3397,
-    &garden_map_collision_collision_mesh_hash_bucket_3398,
-    &garden_map_collision_collision_mesh_hash_bucket_3399,
-    &garden_map_collision_collision_mesh_hash_bucket_3400,
-    &garden_map_collision_collision_mesh_hash_bucket_3401,
-    &garden_map_collision_collision_mesh_hash_bucket_3402,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_3464,
-    &garden_map_collision_collision_mesh_hash_bucket_3465,
-    &garden_map_collision_collision_mesh_hash_bucket_3466,
-    &garden_map_collision_collision_mesh_hash_bucket_3467,
-    &garden_map_collision_collision_mesh_hash_bucket_3468,
-    &garden_map_collision_collision_mesh_hash_bucket_3469,
-    &garden_map_collision_collision_mesh_hash_bucket_3470,
-    &garden_map_collision_collision_mesh_hash_bucket_3471,
-    &garden_map_collision_collision_mesh_hash_bucket_3472,
-    &garden_map_collision_collision_mesh_hash_bucket_3473,
-    &garden_map_collision_collision_mesh_hash_bucket_3474,
-    &garden_map_collision_collision_mesh_hash_bucket_3475,
-    &garden_map_collision_collision_mesh_hash_bucket_3476,
-    &garden_map_collision_collision_mesh_hash_bucket_3477,
-    &garden_map_collision_collision_mesh_hash_bucket_3478,
-    &garden_map_collision_collision_mesh_hash_bucket_3479,
-    &garden_map_collision_collision_mesh_hash_bucket_3480,
-    &garden_map_collision_collision_mesh_hash_bucket_3481,
-    &garden_map_collision_collision_mesh_hash_bucket_3482,
-    &garden_map_collision_collision_mesh_hash_bucket_3483,
-    &garden_map_collision_collision_mesh_hash_bucket_3484,
-    &garden_map_collision_collision_mesh_hash_bucket_3485,
-    &garden_map_collision_collision_mesh_hash_bucket_3486,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_3548,
-    &garden_map_collision_collision_mesh_hash_bucket_3549,
-    &garden_map_collision_collision_mesh_hash_bucket_3550,
-    &garden_map_collision_collision_mesh_hash_bucket_3551,
-    &garden_map_collision_collision_mesh_hash_bucket_3552,
-    &garden_map_collision_collision_mesh_hash_bucket_3553,
-    &garden_map_collision_collision_mesh_hash_bucket_3554,
-    &garden_map_collision_collision_mesh_hash_bucket_3555,
-    &garden_map_collision_collision_mesh_hash_bucket_3556,
-    &garden_map_collision_collision_mesh_hash_bucket_3557,
-    &garden_map_collision_collision_mesh_hash_bucket_3558,
-    &garden_map_collision_collision_mesh_hash_bucket_3559,
-    &garden_map_collision_collision_mesh_hash_bucket_3560,
-    &garden_map_collision_collision_mesh_hash_bucket_3561,
-    &garden_map_collision_collision_mesh_hash_bucket_3562,
-    &garden_map_collision_collision_mesh_hash_bucket_3563,
-    &garden_map_collision_collision_mesh_hash_bucket_3564,
-    &garden_map_collision_collision_mesh_hash_bucket_3565,
-    &garden_map_collision_collision_mesh_hash_bucket_3566,
-    &garden_map_collision_collision_mesh_hash_bucket_3567,
-    &garden_map_collision_collision_mesh_hash_bucket_3568,
-    &garden_map_collision_collision_mesh_hash_bucket_3569,
-    &garden_map_collision_collision_mesh_hash_bucket_3570,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_3632,
-    &garden_map_collision_collision_mesh_hash_bucket_3633,
-    &garden_map_collision_collision_mesh_hash_bucket_3634,
-    &garden_map_collision_collision_mesh_hash_bucket_3635,
-    &garden_map_collision_collision_mesh_hash_bucket_3636,
-    &garden_map_collision_collision_mesh_hash_bucket_3637,
-    &garden_map_collision_collision_mesh_hash_bucket_3638,
-    &garden_map_collision_collision_mesh_hash_bucket_3639,
-    &garden_map_collision_collision_mesh_hash_bucket_3640,
-    &garden_map_collision_collision_mesh_hash_bucket_3641,
-    &garden_map_collision_collision_mesh_hash_bucket_3642,
-    &garden_map_collision_collision_mesh_hash_bucket_3643,
-    &garden_map_collision_collision_mesh_hash_bucket_3644,
-    &garden_map_collision_collision_mesh_hash_bucket_3645,
-    &garden_map_collision_collision_mesh_hash_bucket_3646,
-    &garden_map_collision_collision_mesh_hash_bucket_3647,
-    &garden_map_collision_collision_mesh_hash_bucket_3648,
-    &garden_map_collision_collision_mesh_hash_bucket_3649,
-    &garden_map_collision_collision_mesh_hash_bucket_3650,
-    &garden_map_collision_collision_mesh_hash_bucket_3651,
-    &garden_map_collision_collision_mesh_hash_bucket_3652,
-    &garden_map_collision_collision_mesh_hash_bucket_3653,
-    &garden_map_collision_collision_mesh_hash_bucket_3654,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_3716,
-    &garden_map_collision_collision_mesh_hash_bucket_3717,
-    &garden_map_collision_collision_mesh_hash_bucket_3718,
-    &garden_map_collision_collision_mesh_hash_bucket_3719,
-    &garden_map_collision_collision_mesh_hash_bucket_3720,
-    &garden_map_collision_collision_mesh_hash_bucket_3721,
-    &garden_map_collision_collision_mesh_hash_bucket_3722,
-    &garden_map_collision_collision_mesh_hash_bucket_3723,
-    &garden_map_collision_collision_mesh_hash_bucket_3724,
-    &garden_map_collision_collision_mesh_hash_bucket_3725,
-    &garden_map_collision_collision_mesh_hash_bucket_3726,
-    &garden_map_collision_collision_mesh_hash_bucket_3727,
-    &garden_map_collision_collision_mesh_hash_bucket_3728,
-    &garden_map_collision_collision_mesh_hash_bucket_3729,
-    &garden_map_collision_collision_mesh_hash_bucket_3730,
-    &garden_map_collision_collision_mesh_hash_bucket_3731,
-    &garden_map_collision_collision_mesh_hash_bucket_3732,
-    &garden_map_collision_collision_mesh_hash_bucket_3733,
-    &garden_map_collision_collision_mesh_hash_bucket_3734,
-    &garden_map_collision_collision_mesh_hash_bucket_3735,
-    &garden_map_collision_collision_mesh_hash_bucket_3736,
-    &garden_map_collision_collision_mesh_hash_bucket_3737,
-    &garden_map_collision_collision_mesh_hash_bucket_3738,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_3800,
-    &garden_map_collision_collision_mesh_hash_bucket_3801,
-    &garden_map_collision_collision_mesh_hash_bucket_3802,
-    &garden_map_collision_collision_mesh_hash_bucket_3803,
-    &garden_map_collision_collision_mesh_hash_bucket_3804,
-    &garden_map_collision_collision_mesh_hash_bucket_3805,
-    &garden_map_collision_collision_mesh_hash_bucket_3806,
-    &garden_map_collision_collision_mesh_hash_bucket_3807,
-    &garden_map_collision_collision_mesh_hash_bucket_3808,
-    &garden_map_collision_collision_mesh_hash_bucket_3809,
-    &garden_map_collision_collision_mesh_hash_bucket_3810,
-    &garden_map_collision_collision_mesh_hash_bucket_3811,
-    &garden_map_collision_collision_mesh_hash_bucket_3812,
-    &garden_map_collision_collision_mesh_hash_bucket_3813,
-    &garden_map_collision_collision_mesh_hash_bucket_3814,
-    &garden_map_collision_collision_mesh_hash_bucket_3815,
-    &garden_map_collision_collision_mesh_hash_bucket_3816,
-    &garden_map_collision_collision_mesh_hash_bucket_3817,
-    &garden_map_collision_collision_mesh_hash_bucket_3818,
-    &garden_map_collision_collision_mesh_hash_bucket_3819,
-    &garden_map_collision_collision_mesh_hash_bucket_3820,
-    &garden_map_collision_collision_mesh_hash_bucket_3821,
-    &garden_map_collision_collision_mesh_hash_bucket_3822,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_3884,
-    &garden_map_collision_collision_mesh_hash_bucket_3885,
-    &garden_map_collision_collision_mesh_hash_bucket_3886,
-    &garden_map_collision_collision_mesh_hash_bucket_3887,
-    &garden_map_collision_collision_mesh_hash_bucket_3888,
-    &garden_map_collision_collision_mesh_hash_bucket_3889,
-    &garden_map_collision_collision_mesh_hash_bucket_3890,
-    &garden_map_collision_collision_mesh_hash_bucket_3891,
-    &garden_map_collision_collision_mesh_hash_bucket_3892,
-    &garden_map_collision_collision_mesh_hash_bucket_3893,
-    &garden_map_collision_collision_mesh_hash_bucket_3894,
-    &garden_map_collision_collision_mesh_hash_bucket_3895,
-    &garden_map_collision_collision_mesh_hash_bucket_3896,
-    &garden_map_collision_collision_mesh_hash_bucket_3897,
-    &garden_map_collision_collision_mesh_hash_bucket_3898,
-    &garden_map_collision_collision_mesh_hash_bucket_3899,
-    &garden_map_collision_collision_mesh_hash_bucket_3900,
-    &garden_map_collision_collision_mesh_hash_bucket_3901,
-    &garden_map_collision_collision_mesh_hash_bucket_3902,
-    &garden_map_collision_collision_mesh_hash_bucket_3903,
-    &garden_map_collision_collision_mesh_hash_bucket_3904,
-    &garden_map_collision_collision_mesh_hash_bucket_3905,
-    &garden_map_collision_collision_mesh_hash_bucket_3906,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_3968,
-    &garden_map_collision_collision_mesh_hash_bucket_3969,
-    &garden_map_collision_collision_mesh_hash_bucket_3970,
-    &garden_map_collision_collision_mesh_hash_bucket_3971,
-    &garden_map_collision_collision_mesh_hash_bucket_3972,
-    &garden_map_collision_collision_mesh_hash_bucket_3973,
-    &garden_map_collision_collision_mesh_hash_bucket_3974,
-    &garden_map_collision_collision_mesh_hash_bucket_3975,
-    &garden_map_collision_collision_mesh_hash_bucket_3976,
-    &garden_map_collision_collision_mesh_hash_bucket_3977,
-    &garden_map_collision_collision_mesh_hash_bucket_3978,
-    &garden_map_collision_collision_mesh_hash_bucket_3979,
-    &garden_map_collision_collision_mesh_hash_bucket_3980,
-    &garden_map_collision_collision_mesh_hash_bucket_3981,
-    &garden_map_collision_collision_mesh_hash_bucket_3982,
-    &garden_map_collision_collision_mesh_hash_bucket_3983,
-    &garden_map_collision_collision_mesh_hash_bucket_3984,
-    &garden_map_collision_collision_mesh_hash_bucket_3985,
-    &garden_map_collision_collision_mesh_hash_bucket_3986,
-    &garden_map_collision_collision_mesh_hash_bucket_3987,
-    &garden_map_collision_collision_mesh_hash_bucket_3988,
-    &garden_map_collision_collision_mesh_hash_bucket_3989,
-    &garden_map_collision_collision_mesh_hash_bucket_3990,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4052,
-    &garden_map_collision_collision_mesh_hash_bucket_4053,
-    &garden_map_collision_collision_mesh_hash_bucket_4054,
-    &garden_map_collision_collision_mesh_hash_bucket_4055,
-    &garden_map_collision_collision_mesh_hash_bucket_4056,
-    &garden_map_collision_collision_mesh_hash_bucket_4057,
-    &garden_map_collision_collision_mesh_hash_bucket_4058,
-    &garden_map_collision_collision_mesh_hash_bucket_4059,
-    &garden_map_collision_collision_mesh_hash_bucket_4060,
-    &garden_map_collision_collision_mesh_hash_bucket_4061,
-    &garden_map_collision_collision_mesh_hash_bucket_4062,
-    &garden_map_collision_collision_mesh_hash_bucket_4063,
-    &garden_map_collision_collision_mesh_hash_bucket_4064,
-    &garden_map_collision_collision_mesh_hash_bucket_4065,
-    &garden_map_collision_collision_mesh_hash_bucket_4066,
-    &garden_map_collision_collision_mesh_hash_bucket_4067,
-    &garden_map_collision_collision_mesh_hash_bucket_4068,
-    &garden_map_collision_collision_mesh_hash_bucket_4069,
-    &garden_map_collision_collision_mesh_hash_bucket_4070,
-    &garden_map_collision_collision_mesh_hash_bucket_4071,
-    &garden_map_collision_collision_mesh_hash_bucket_4072,
-    &garden_map_collision_collision_mesh_hash_bucket_4073,
-    &garden_map_collision_collision_mesh_hash_bucket_4074,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4136,
-    &garden_map_collision_collision_mesh_hash_bucket_4137,
-    &garden_map_collision_collision_mesh_hash_bucket_4138,
-    &garden_map_collision_collision_mesh_hash_bucket_4139,
-    &garden_map_collision_collision_mesh_hash_bucket_4140,
-    &garden_map_collision_collision_mesh_hash_bucket_4141,
-    &garden_map_collision_collision_mesh_hash_bucket_4142,
-    &garden_map_collision_collision_mesh_hash_bucket_4143,
-    &garden_map_collision_collision_mesh_hash_bucket_4144,
-    &garden_map_collision_collision_mesh_hash_bucket_4145,
-    &garden_map_collision_collision_mesh_hash_bucket_4146,
-    &garden_map_collision_collision_mesh_hash_bucket_4147,
-    &garden_map_collision_collision_mesh_hash_bucket_4148,
-    &garden_map_collision_collision_mesh_hash_bucket_4149,
-    &garden_map_collision_collision_mesh_hash_bucket_4150,
-    &garden_map_collision_collision_mesh_hash_bucket_4151,
-    &garden_map_collision_collision_mesh_hash_bucket_4152,
-    &garden_map_collision_collision_mesh_hash_bucket_4153,
-    &garden_map_collision_collision_mesh_hash_bucket_4154,
-    &garden_map_collision_collision_mesh_hash_bucket_4155,
-    &garden_map_collision_collision_mesh_hash_bucket_4156,
-    &garden_map_collision_collision_mesh_hash_bucket_4157,
-    &garden_map_collision_collision_mesh_hash_bucket_4158,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4220,
-    &garden_map_collision_collision_mesh_hash_bucket_4221,
-    &garden_map_collision_collision_mesh_hash_bucket_4222,
-    &garden_map_collision_collision_mesh_hash_bucket_4223,
-    &garden_map_collision_collision_mesh_hash_bucket_4224,
-    &garden_map_collision_collision_mesh_hash_bucket_4225,
-    &garden_map_collision_collision_mesh_hash_bucket_4226,
-    &garden_map_collision_collision_mesh_hash_bucket_4227,
-    &garden_map_collision_collision_mesh_hash_bucket_4228,
-    &garden_map_collision_collision_mesh_hash_bucket_4229,
-    &garden_map_collision_collision_mesh_hash_bucket_4230,
-    &garden_map_collision_collision_mesh_hash_bucket_4231,
-    &garden_map_collision_collision_mesh_hash_bucket_4232,
-    &garden_map_collision_collision_mesh_hash_bucket_4233,
-    &garden_map_collision_collision_mesh_hash_bucket_4234,
-    &garden_map_collision_collision_mesh_hash_bucket_4235,
-    &garden_map_collision_collision_mesh_hash_bucket_4236,
-    &garden_map_collision_collision_mesh_hash_bucket_4237,
-    &garden_map_collision_collision_mesh_hash_bucket_4238,
-    &garden_map_collision_collision_mesh_hash_bucket_4239,
-    &garden_map_collision_collision_mesh_hash_bucket_4240,
-    &garden_map_collision_collision_mesh_hash_bucket_4241,
-    &garden_map_collision_collision_mesh_hash_bucket_4242,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4304,
-    &garden_map_collision_collision_mesh_hash_bucket_4305,
-    &garden_map_collision_collision_mesh_hash_bucket_4306,
-    &garden_map_collision_collision_mesh_hash_bucket_4307,
-    &garden_map_collision_collision_mesh_hash_bucket_4308,
-    &garden_map_collision_collision_mesh_hash_bucket_4309,
-    &garden_map_collision_collision_mesh_hash_bucket_4310,
-    &garden_map_collision_collision_mesh_hash_bucket_4311,
-    &garden_map_collision_collision_mesh_hash_bucket_4312,
-    &garden_map_collision_collision_mesh_hash_bucket_4313,
-    &garden_map_collision_collision_mesh_hash_bucket_4314,
-    &garden_map_collision_collision_mesh_hash_bucket_4315,
-    &garden_map_collision_collision_mesh_hash_bucket_4316,
-    &garden_map_collision_collision_mesh_hash_bucket_4317,
-    &garden_map_collision_collision_mesh_hash_bucket_4318,
-    &garden_map_collision_collision_mesh_hash_bucket_4319,
-    &garden_map_collision_collision_mesh_hash_bucket_4320,
-    &garden_map_collision_collision_mesh_hash_bucket_4321,
-    &garden_map_collision_collision_mesh_hash_bucket_4322,
-    &garden_map_collision_collision_mesh_hash_bucket_4323,
-    &garden_map_collision_collision_mesh_hash_bucket_4324,
-    &garden_map_collision_collision_mesh_hash_bucket_4325,
-    &garden_map_collision_collision_mesh_hash_bucket_4326,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4388,
-    &garden_map_collision_collision_mesh_hash_bucket_4389,
-    &garden_map_collision_collision_mesh_hash_bucket_4390,
-    &garden_map_collision_collision_mesh_hash_bucket_4391,
-    &garden_map_collision_collision_mesh_hash_bucket_4392,
-    &garden_map_collision_collision_mesh_hash_bucket_4393,
-    &garden_map_collision_collision_mesh_hash_bucket_4394,
-    &garden_map_collision_collision_mesh_hash_bucket_4395,
-    &garden_map_collision_collision_mesh_hash_bucket_4396,
-    &garden_map_collision_collision_mesh_hash_bucket_4397,
-    &garden_map_collision_collision_mesh_hash_bucket_4398,
-    &garden_map_collision_collision_mesh_hash_bucket_4399,
-    &garden_map_collision_collision_mesh_hash_bucket_4400,
-    &garden_map_collision_collision_mesh_hash_bucket_4401,
-    &garden_map_collision_collision_mesh_hash_bucket_4402,
-    &garden_map_collision_collision_mesh_hash_bucket_4403,
-    &garden_map_collision_collision_mesh_hash_bucket_4404,
-    &garden_map_collision_collision_mesh_hash_bucket_4405,
-    &garden_map_collision_collision_mesh_hash_bucket_4406,
-    &garden_map_collision_collision_mesh_hash_bucket_4407,
-    &garden_map_collision_collision_mesh_hash_bucket_4408,
-    &garden_map_collision_collision_mesh_hash_bucket_4409,
-    &garden_map_collision_collision_mesh_hash_bucket_4410,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4472,
-    &garden_map_collision_collision_mesh_hash_bucket_4473,
-    &garden_map_collision_collision_mesh_hash_bucket_4474,
-    &garden_map_collision_collision_mesh_hash_bucket_4475,
-    &garden_map_collision_collision_mesh_hash_bucket_4476,
-    &garden_map_collision_collision_mesh_hash_bucket_4477,
-    &garden_map_collision_collision_mesh_hash_bucket_4478,
-    &garden_map_collision_collision_mesh_hash_bucket_4479,
-    &garden_map_collision_collision_mesh_hash_bucket_4480,
-    &garden_map_collision_collision_mesh_hash_bucket_4481,
-    &garden_map_collision_collision_mesh_hash_bucket_4482,
-    &garden_map_collision_collision_mesh_hash_bucket_4483,
-    &garden_map_collision_collision_mesh_hash_bucket_4484,
-    &garden_map_collision_collision_mesh_hash_bucket_4485,
-    &garden_map_collision_collision_mesh_hash_bucket_4486,
-    &garden_map_collision_collision_mesh_hash_bucket_4487,
-    &garden_map_collision_collision_mesh_hash_bucket_4488,
-    &garden_map_collision_collision_mesh_hash_bucket_4489,
-    &garden_map_collision_collision_mesh_hash_bucket_4490,
-    &garden_map_collision_collision_mesh_hash_bucket_4491,
-    &garden_map_collision_collision_mesh_hash_bucket_4492,
-    &garden_map_collision_collision_mesh_hash_bucket_4493,
-    &garden_map_collision_collision_mesh_hash_bucket_4494,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4556,
-    &garden_map_collision_collision_mesh_hash_bucket_4557,
-    &garden_map_collision_collision_mesh_hash_bucket_4558,
-    &garden_map_collision_collision_mesh_hash_bucket_4559,
-    &garden_map_collision_collision_mesh_hash_bucket_4560,
-    &garden_map_collision_collision_mesh_hash_bucket_4561,
-    &garden_map_collision_collision_mesh_hash_bucket_4562,
-    &garden_map_collision_collision_mesh_hash_bucket_4563,
-    &garden_map_collision_collision_mesh_hash_bucket_4564,
-    &garden_map_collision_collision_mesh_hash_bucket_4565,
-    &garden_map_collision_collision_mesh_hash_bucket_4566,
-    &garden_map_collision_collision_mesh_hash_bucket_4567,
-    &garden_map_collision_collision_mesh_hash_bucket_4568,
-    &garden_map_collision_collision_mesh_hash_bucket_4569,
-    &garden_map_collision_collision_mesh_hash_bucket_4570,
-    &garden_map_collision_collision_mesh_hash_bucket_4571,
-    &garden_map_collision_collision_mesh_hash_bucket_4572,
-    &garden_map_collision_collision_mesh_hash_bucket_4573,
-    &garden_map_collision_collision_mesh_hash_bucket_4574,
-    &garden_map_collision_collision_mesh_hash_bucket_4575,
-    &garden_map_collision_collision_mesh_hash_bucket_4576,
-    &garden_map_collision_collision_mesh_hash_bucket_4577,
-    &garden_map_collision_collision_mesh_hash_bucket_4578,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4640,
-    &garden_map_collision_collision_mesh_hash_bucket_4641,
-    &garden_map_collision_collision_mesh_hash_bucket_4642,
-    &garden_map_collision_collision_mesh_hash_bucket_4643,
-    &garden_map_collision_collision_mesh_hash_bucket_4644,
-    &garden_map_collision_collision_mesh_hash_bucket_4645,
-    &garden_map_collision_collision_mesh_hash_bucket_4646,
-    &garden_map_collision_collision_mesh_hash_bucket_4647,
-    &garden_map_collision_collision_mesh_hash_bucket_4648,
-    &garden_map_collision_collision_mesh_hash_bucket_4649,
-    &garden_map_collision_collision_mesh_hash_bucket_4650,
-    &garden_map_collision_collision_mesh_hash_bucket_4651,
-    &garden_map_collision_collision_mesh_hash_bucket_4652,
-    &garden_map_collision_collision_mesh_hash_bucket_4653,
-    &garden_map_collision_collision_mesh_hash_bucket_4654,
-    &garden_map_collision_collision_mesh_hash_bucket_4655,
-    &garden_map_collision_collision_mesh_hash_bucket_4656,
-    &garden_map_collision_collision_mesh_hash_bucket_4657,
-    &garden_map_collision_collision_mesh_hash_bucket_4658,
-    &garden_map_collision_collision_mesh_hash_bucket_4659,
-    &garden_map_collision_collision_mesh_hash_bucket_4660,
-    &garden_map_collision_collision_mesh_hash_bucket_4661,
-    &garden_map_collision_collision_mesh_hash_bucket_4662,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4724,
-    &garden_map_collision_collision_mesh_hash_bucket_4725,
-    &garden_map_collision_collision_mesh_hash_bucket_4726,
-    &garden_map_collision_collision_mesh_hash_bucket_4727,
-    &garden_map_collision_collision_mesh_hash_bucket_4728,
-    &garden_map_collision_collision_mesh_hash_bucket_4729,
-    &garden_map_collision_collision_mesh_hash_bucket_4730,
-    &garden_map_collision_collision_mesh_hash_bucket_4731,
-    &garden_map_collision_collision_mesh_hash_bucket_4732,
-    &garden_map_collision_collision_mesh_hash_bucket_4733,
-    &garden_map_collision_collision_mesh_hash_bucket_4734,
-    &garden_map_collision_collision_mesh_hash_bucket_4735,
-    &garden_map_collision_collision_mesh_hash_bucket_4736,
-    &garden_map_collision_collision_mesh_hash_bucket_4737,
-    &garden_map_collision_collision_mesh_hash_bucket_4738,
-    &garden_map_collision_collision_mesh_hash_bucket_4739,
-    &garden_map_collision_collision_mesh_hash_bucket_4740,
-    &garden_map_collision_collision_mesh_hash_bucket_4741,
-    &garden_map_collision_collision_mesh_hash_bucket_4742,
-    &garden_map_collision_collision_mesh_hash_bucket_4743,
-    &garden_map_collision_collision_mesh_hash_bucket_4744,
-    &garden_map_collision_collision_mesh_hash_bucket_4745,
-    &garden_map_collision_collision_mesh_hash_bucket_4746,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4808,
-    &garden_map_collision_collision_mesh_hash_bucket_4809,
-    &garden_map_collision_collision_mesh_hash_bucket_4810,
-    &garden_map_collision_collision_mesh_hash_bucket_4811,
-    &garden_map_collision_collision_mesh_hash_bucket_4812,
-    &garden_map_collision_collision_mesh_hash_bucket_4813,
-    &garden_map_collision_collision_mesh_hash_bucket_4814,
-    &garden_map_collision_collision_mesh_hash_bucket_4815,
-    &garden_map_collision_collision_mesh_hash_bucket_4816,
-    &garden_map_collision_collision_mesh_hash_bucket_4817,
-    &garden_map_collision_collision_mesh_hash_bucket_4818,
-    &garden_map_collision_collision_mesh_hash_bucket_4819,
-    &garden_map_collision_collision_mesh_hash_bucket_4820,
-    &garden_map_collision_collision_mesh_hash_bucket_4821,
-    &garden_map_collision_collision_mesh_hash_bucket_4822,
-    &garden_map_collision_collision_mesh_hash_bucket_4823,
-    &garden_map_collision_collision_mesh_hash_bucket_4824,
-    &garden_map_collision_collision_mesh_hash_bucket_4825,
-    &garden_map_collision_collision_mesh_hash_bucket_4826,
-    &garden_map_collision_collision_mesh_hash_bucket_4827,
-    &garden_map_collision_collision_mesh_hash_bucket_4828,
-    &garden_map_collision_collision_mesh_hash_bucket_4829,
-    &garden_map_collision_collision_mesh_hash_bucket_4830,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4892,
-    &garden_map_collision_collision_mesh_hash_bucket_4893,
-    &garden_map_collision_collision_mesh_hash_bucket_4894,
-    &garden_map_collision_collision_mesh_hash_bucket_4895,
-    &garden_map_collision_collision_mesh_hash_bucket_4896,
-    &garden_map_collision_collision_mesh_hash_bucket_4897,
-    &garden_map_collision_collision_mesh_hash_bucket_4898,
-    &garden_map_collision_collision_mesh_hash_bucket_4899,
-    &garden_map_collision_collision_mesh_hash_bucket_4900,
-    &garden_map_collision_collision_mesh_hash_bucket_4901,
-    &garden_map_collision_collision_mesh_hash_bucket_4902,
-    &garden_map_collision_collision_mesh_hash_bucket_4903,
-    &garden_map_collision_collision_mesh_hash_bucket_4904,
-    &garden_map_collision_collision_mesh_hash_bucket_4905,
-    &garden_map_collision_collision_mesh_hash_bucket_4906,
-    &garden_map_collision_collision_mesh_hash_bucket_4907,
-    &garden_map_collision_collision_mesh_hash_bucket_4908,
-    &garden_map_collision_collision_mesh_hash_bucket_4909,
-    &garden_map_collision_collision_mesh_hash_bucket_4910,
-    &garden_map_collision_collision_mesh_hash_bucket_4911,
-    &garden_map_collision_collision_mesh_hash_bucket_4912,
-    &garden_map_collision_collision_mesh_hash_bucket_4913,
-    &garden_map_collision_collision_mesh_hash_bucket_4914,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_4976,
-    &garden_map_collision_collision_mesh_hash_bucket_4977,
-    &garden_map_collision_collision_mesh_hash_bucket_4978,
-    &garden_map_collision_collision_mesh_hash_bucket_4979,
-    &garden_map_collision_collision_mesh_hash_bucket_4980,
-    &garden_map_collision_collision_mesh_hash_bucket_4981,
-    &garden_map_collision_collision_mesh_hash_bucket_4982,
-    &garden_map_collision_collision_mesh_hash_bucket_4983,
-    &garden_map_collision_collision_mesh_hash_bucket_4984,
-    &garden_map_collision_collision_mesh_hash_bucket_4985,
-    &garden_map_collision_collision_mesh_hash_bucket_4986,
-    &garden_map_collision_collision_mesh_hash_bucket_4987,
-    &garden_map_collision_collision_mesh_hash_bucket_4988,
-    &garden_map_collision_collision_mesh_hash_bucket_4989,
-    &garden_map_collision_collision_mesh_hash_bucket_4990,
-    &garden_map_collision_collision_mesh_hash_bucket_4991,
-    &garden_map_collision_collision_mesh_hash_bucket_4992,
-    &garden_map_collision_collision_mesh_hash_bucket_4993,
-    &garden_map_collision_collision_mesh_hash_bucket_4994,
-    &garden_map_collision_collision_mesh_hash_bucket_4995,
-    &garden_map_collision_collision_mesh_hash_bucket_4996,
-    &garden_map_collision_collision_mesh_hash_bucket_4997,
-    &garden_map_collision_collision_mesh_hash_bucket_4998,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_5060,
-    &garden_map_collision_collision_mesh_hash_bucket_5061,
-    &garden_map_collision_collision_mesh_hash_bucket_5062,
-    &garden_map_collision_collision_mesh_hash_bucket_5063,
-    &garden_map_collision_collision_mesh_hash_bucket_5064,
-    &garden_map_collision_collision_mesh_hash_bucket_5065,
-    &garden_map_collision_collision_mesh_hash_bucket_5066,
-    &garden_map_collision_collision_mesh_hash_bucket_5067,
-    &garden_map_collision_collision_mesh_hash_bucket_5068,
-    &garden_map_collision_collision_mesh_hash_bucket_5069,
-    &garden_map_collision_collision_mesh_hash_bucket_5070,
-    &garden_map_collision_collision_mesh_hash_bucket_5071,
-    &garden_map_collision_collision_mesh_hash_bucket_5072,
-    &garden_map_collision_collision_mesh_hash_bucket_5073,
-    &garden_map_collision_collision_mesh_hash_bucket_5074,
-    &garden_map_collision_collision_mesh_hash_bucket_5075,
-    &garden_map_collision_collision_mesh_hash_bucket_5076,
-    &garden_map_collision_collision_mesh_hash_bucket_5077,
-    &garden_map_collision_collision_mesh_hash_bucket_5078,
-    &garden_map_collision_collision_mesh_hash_bucket_5079,
-    &garden_map_collision_collision_mesh_hash_bucket_5080,
-    &garden_map_collision_collision_mesh_hash_bucket_5081,
-    &garden_map_collision_collision_mesh_hash_bucket_5082,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_5144,
-    &garden_map_collision_collision_mesh_hash_bucket_5145,
-    &garden_map_collision_collision_mesh_hash_bucket_5146,
-    &garden_map_collision_collision_mesh_hash_bucket_5147,
-    &garden_map_collision_collision_mesh_hash_bucket_5148,
-    &garden_map_collision_collision_mesh_hash_bucket_5149,
-    &garden_map_collision_collision_mesh_hash_bucket_5150,
-    &garden_map_collision_collision_mesh_hash_bucket_5151,
-    &garden_map_collision_collision_mesh_hash_bucket_5152,
-    &garden_map_collision_collision_mesh_hash_bucket_5153,
-    &garden_map_collision_collision_mesh_hash_bucket_5154,
-    &garden_map_collision_collision_mesh_hash_bucket_5155,
-    &garden_map_collision_collision_mesh_hash_bucket_5156,
-    &garden_map_collision_collision_mesh_hash_bucket_5157,
-    &garden_map_collision_collision_mesh_hash_bucket_5158,
-    &garden_map_collision_collision_mesh_hash_bucket_5159,
-    &garden_map_collision_collision_mesh_hash_bucket_5160,
-    &garden_map_collision_collision_mesh_hash_bucket_5161,
-    &garden_map_collision_collision_mesh_hash_bucket_5162,
-    &garden_map_collision_collision_mesh_hash_bucket_5163,
-    &garden_map_collision_collision_mesh_hash_bucket_5164,
-    &garden_map_collision_collision_mesh_hash_bucket_5165,
-    &garden_map_collision_collision_mesh_hash_bucket_5166,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_5228,
-    &garden_map_collision_collision_mesh_hash_bucket_5229,
-    &garden_map_collision_collision_mesh_hash_bucket_5230,
-    &garden_map_collision_collision_mesh_hash_bucket_5231,
-    &garden_map_collision_collision_mesh_hash_bucket_5232,
-    &garden_map_collision_collision_mesh_hash_bucket_5233,
-    &garden_map_collision_collision_mesh_hash_bucket_5234,
-    &garden_map_collision_collision_mesh_hash_bucket_5235,
-    &garden_map_collision_collision_mesh_hash_bucket_5236,
-    &garden_map_collision_collision_mesh_hash_bucket_5237,
-    &garden_map_collision_collision_mesh_hash_bucket_5238,
-    &garden_map_collision_collision_mesh_hash_bucket_5239,
-    &garden_map_collision_collision_mesh_hash_bucket_5240,
-    &garden_map_collision_collision_mesh_hash_bucket_5241,
-    &garden_map_collision_collision_mesh_hash_bucket_5242,
-    &garden_map_collision_collision_mesh_hash_bucket_5243,
-    &garden_map_collision_collision_mesh_hash_bucket_5244,
-    &garden_map_collision_collision_mesh_hash_bucket_5245,
-    &garden_map_collision_collision_mesh_hash_bucket_5246,
-    &garden_map_collision_collision_mesh_hash_bucket_5247,
-    &garden_map_collision_collision_mesh_hash_bucket_5248,
-    &garden_map_collision_collision_mesh_hash_bucket_5249,
-    &garden_map_collision_collision_mesh_hash_bucket_5250,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_5312,
-    &garden_map_collision_collision_mesh_hash_bucket_5313,
-    &garden_map_collision_collision_mesh_hash_bucket_5314,
-    &garden_map_collision_collision_mesh_hash_bucket_5315,
-    &garden_map_collision_collision_mesh_hash_bucket_5316,
-    &garden_map_collision_collision_mesh_hash_bucket_5317,
-    &garden_map_collision_collision_mesh_hash_bucket_5318,
-    &garden_map_collision_collision_mesh_hash_bucket_5319,
-    &garden_map_collision_collision_mesh_hash_bucket_5320,
-    &garden_map_collision_collision_mesh_hash_bucket_5321,
-    &garden_map_collision_collision_mesh_hash_bucket_5322,
-    &garden_map_collision_collision_mesh_hash_bucket_5323,
-    &garden_map_collision_collision_mesh_hash_bucket_5324,
-    &garden_map_collision_collision_mesh_hash_bucket_5325,
-    &garden_map_collision_collision_mesh_hash_bucket_5326,
-    &garden_map_collision_collision_mesh_hash_bucket_5327,
-    &garden_map_collision_collision_mesh_hash_bucket_5328,
-    &garden_map_collision_collision_mesh_hash_bucket_5329,
-    &garden_map_collision_collision_mesh_hash_bucket_5330,
-    &garden_map_collision_collision_mesh_hash_bucket_5331,
-    &garden_map_collision_collision_mesh_hash_bucket_5332,
-    &garden_map_collision_collision_mesh_hash_bucket_5333,
-    &garden_map_collision_collision_mesh_hash_bucket_5334,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_5396,
-    &garden_map_collision_collision_mesh_hash_bucket_5397,
-    &garden_map_collision_collision_mesh_hash_bucket_5398,
-    &garden_map_collision_collision_mesh_hash_bucket_5399,
-    &garden_map_collision_collision_mesh_hash_bucket_5400,
-    &garden_map_collision_collision_mesh_hash_bucket_5401,
-    &garden_map_collision_collision_mesh_hash_bucket_5402,
-    &garden_map_collision_collision_mesh_hash_bucket_5403,
-    &garden_map_collision_collision_mesh_hash_bucket_5404,
-    &garden_map_collision_collision_mesh_hash_bucket_5405,
-    &garden_map_collision_collision_mesh_hash_bucket_5406,
-    &garden_map_collision_collision_mesh_hash_bucket_5407,
-    &garden_map_collision_collision_mesh_hash_bucket_5408,
-    &garden_map_collision_collision_mesh_hash_bucket_5409,
-    &garden_map_collision_collision_mesh_hash_bucket_5410,
-    &garden_map_collision_collision_mesh_hash_bucket_5411,
-    &garden_map_collision_collision_mesh_hash_bucket_5412,
-    &garden_map_collision_collision_mesh_hash_bucket_5413,
-    &garden_map_collision_collision_mesh_hash_bucket_5414,
-    &garden_map_collision_collision_mesh_hash_bucket_5415,
-    &garden_map_collision_collision_mesh_hash_bucket_5416,
-    &garden_map_collision_collision_mesh_hash_bucket_5417,
-    &garden_map_collision_collision_mesh_hash_bucket_5418,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_5480,
-    &garden_map_collision_collision_mesh_hash_bucket_5481,
-    &garden_map_collision_collision_mesh_hash_bucket_5482,
-    &garden_map_collision_collision_mesh_hash_bucket_5483,
-    &garden_map_collision_collision_mesh_hash_bucket_5484,
-    &garden_map_collision_collision_mesh_hash_bucket_5485,
-    &garden_map_collision_collision_mesh_hash_bucket_5486,
-    &garden_map_collision_collision_mesh_hash_bucket_5487,
-    &garden_map_collision_collision_mesh_hash_bucket_5488,
-    &garden_map_collision_collision_mesh_hash_bucket_5489,
-    &garden_map_collision_collision_mesh_hash_bucket_5490,
-    &garden_map_collision_collision_mesh_hash_bucket_5491,
-    &garden_map_collision_collision_mesh_hash_bucket_5492,
-    &garden_map_collision_collision_mesh_hash_bucket_5493,
-    &garden_map_collision_collision_mesh_hash_bucket_5494,
-    &garden_map_collision_collision_mesh_hash_bucket_5495,
-    &garden_map_collision_collision_mesh_hash_bucket_5496,
-    &garden_map_collision_collision_mesh_hash_bucket_5497,
-    &garden_map_collision_collision_mesh_hash_bucket_5498,
-    &garden_map_collision_collision_mesh_hash_bucket_5499,
-    &garden_map_collision_collision_mesh_hash_bucket_5500,
-    &garden_map_collision_collision_mesh_hash_bucket_5501,
-    &garden_map_collision_collision_mesh_hash_bucket_5502,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    &garden_map_collision_collision_mesh_hash_bucket_5564,
-    &garden_map_collision_collision_mesh_hash_bucket_5565,
-    &garden_map_collision_collision_mesh_hash_bucket_5566,
-    &garden_map_collision_collision_mesh_hash_bucket_5567,
-    &garden_map_collision_collision_mesh_hash_bucket_5568,
-    &garden_map_collision_collision_mesh_hash_bucket_5569,
-    &garden_map_collision_collision_mesh_hash_bucket_5570,
-    &garden_map_collision_collision_mesh_hash_bucket_5571,
-    &garden_map_collision_collision_mesh_hash_bucket_5572,
-    &garden_map_collision_collision_mesh_hash_bucket_5573,
-    &garden_map_collision_collision_mesh_hash_bucket_5574,
-    &garden_map_collision_collision_mesh_hash_bucket_5575,
-    &garden_map_collision_collision_mesh_hash_bucket_5576,
-    &garden_map_collision_collision_mesh_hash_bucket_5577,
-    &garden_map_collision_collision_mesh_hash_bucket_5578,
-    &garden_map_collision_collision_mesh_hash_bucket_5579,
-    &garden_map_collision_collision_mesh_hash_bucket_5580,
-    &garden_map_collision_collision_mesh_hash_bucket_5581,
-    &garden_map_collision_collision_mesh_hash_bucket_5582,
-    &garden_map_collision_collision_mesh_hash_bucket_5583,
-    &garden_map_collision_collision_mesh_hash_bucket_5584,
-    &garden_map_collision_collision_mesh_hash_bucket_5585,
-    &garden_map_collision_collision_mesh_hash_bucket_5586,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
-    NULL,
+CollisionMesh garden_map_collision_collision_mesh_baked = {
+    garden_map_collision_collision_mesh,  // Triangle* triangles;
+    GARDEN_MAP_COLLISION_LENGTH,          // int trianglesLength;
+    // filled by CollisionMesh_build() at load
+    garden_map_collision_collision_mesh_triangle_data,  // triangleData;
+};
+
+unsigned short garden_map_collision_collision_mesh_hash_offsets[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 40, 42, 43, 44, 45, 46,
+    47, 48, 49, 50, 51, 53, 59, 61, 62, 63, 64, 65, 66, 67, 69, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 72, 75, 78, 80, 81, 82, 83, 84, 85, 90, 93, 98, 101, 105, 108, 109, 110,
+    111, 112, 113, 114, 116, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 118, 120, 123, 126, 128, 129, 130, 131,
+    132, 137, 140, 146, 149, 151, 154, 156, 157, 158, 159, 160, 162, 164, 165,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    165, 166, 167, 169, 171, 173, 174, 175, 176, 177, 182, 185, 191, 193, 195,
+    197, 199, 200, 201, 202, 203, 205, 206, 207, 207, 207, 207, 207, 207, 207,
+    207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207,
+    207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207,
+    207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207,
+    207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 208, 209, 211, 213, 216,
+    218, 219, 220, 221, 226, 230, 236, 238, 240, 242, 244, 246, 247, 248, 250,
+    252, 253, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 255, 256, 258, 260, 262, 264, 266, 267, 268, 269, 271,
+    273, 275, 277, 279, 281, 283, 284, 285, 287, 288, 289, 290, 290, 290, 290,
+    290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290,
+    290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290,
+    290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290,
+    290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 291, 292,
+    293, 295, 297, 299, 301, 311, 318, 326, 334, 344, 353, 361, 368, 376, 386,
+    388, 390, 392, 393, 394, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 395, 396, 397, 398, 400, 402, 404, 406, 408,
+    410, 412, 413, 415, 416, 418, 419, 421, 422, 424, 426, 427, 428, 429, 430,
+    430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+    430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+    430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+    430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+    430, 433, 436, 438, 440, 445, 447, 452, 454, 460, 464, 466, 471, 473, 477,
+    479, 484, 486, 490, 496, 498, 500, 502, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 506, 508, 510, 511, 514,
+    516, 519, 521, 523, 525, 527, 530, 532, 534, 536, 539, 541, 543, 545, 546,
+    547, 548, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550,
+    550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550,
+    550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550,
+    550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550,
+    550, 550, 550, 550, 552, 554, 557, 560, 566, 569, 576, 579, 585, 587, 590,
+    596, 599, 606, 609, 614, 617, 620, 624, 625, 626, 627, 629, 629, 629, 629,
+    629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+    629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+    629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+    629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 630, 631,
+    633, 635, 638, 640, 644, 646, 649, 651, 652, 655, 657, 660, 662, 664, 666,
+    668, 670, 671, 672, 674, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 677, 679, 681, 682, 685, 687, 689, 691,
+    694, 696, 698, 700, 702, 705, 707, 710, 712, 713, 715, 716, 717, 719, 720,
+    720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+    720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+    720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+    720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+    720, 723, 726, 728, 731, 737, 740, 746, 749, 755, 758, 761, 767, 769, 775,
+    778, 784, 787, 791, 796, 797, 798, 800, 801, 801, 801, 801, 801, 801, 801,
+    801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+    801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+    801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+    801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 802, 804, 806, 808, 810,
+    812, 814, 816, 819, 821, 823, 826, 828, 830, 832, 835, 837, 840, 842, 843,
+    845, 847, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848,
+    848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848,
+    848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848,
+    848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848,
+    848, 848, 848, 848, 852, 856, 858, 860, 866, 869, 882, 902, 907, 909, 928,
+    942, 945, 951, 953, 958, 961, 963, 965, 966, 968, 969, 970, 970, 970, 970,
+    970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970,
+    970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970,
+    970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970,
+    970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 970, 971, 973,
+    975, 977, 980, 982, 985, 997, 999, 1001, 1013, 1023, 1025, 1028, 1030, 1032,
+    1034, 1035, 1037, 1038, 1040, 1041, 1042, 1042, 1042, 1042, 1042, 1042,
+    1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+    1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+    1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+    1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+    1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1045, 1048, 1050, 1053,
+    1059, 1062, 1067, 1070, 1077, 1080, 1083, 1088, 1091, 1097, 1100, 1107,
+    1110, 1111, 1113, 1114, 1116, 1117, 1118, 1118, 1118, 1118, 1118, 1118,
+    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1119, 1121, 1123, 1124,
+    1127, 1129, 1131, 1133, 1136, 1138, 1140, 1142, 1144, 1147, 1149, 1152,
+    1154, 1156, 1158, 1160, 1162, 1163, 1164, 1164, 1164, 1164, 1164, 1164,
+    1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+    1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+    1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+    1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+    1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1166, 1168, 1170,
+    1173, 1175, 1179, 1181, 1184, 1186, 1187, 1190, 1192, 1195, 1197, 1199,
+    1200, 1202, 1204, 1206, 1207, 1208, 1209, 1209, 1209, 1209, 1209, 1209,
+    1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209,
+    1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209,
+    1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209,
+    1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209,
+    1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1211, 1214, 1217, 1220,
+    1227, 1230, 1238, 1241, 1247, 1250, 1253, 1259, 1261, 1267, 1269, 1274,
+    1276, 1280, 1285, 1287, 1288, 1289, 1290, 1290, 1290, 1290, 1290, 1290,
+    1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+    1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+    1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+    1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+    1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1293, 1296, 1298, 1301,
+    1307, 1309, 1315, 1317, 1323, 1326, 1329, 1333, 1335, 1338, 1339, 1342,
+    1343, 1345, 1347, 1349, 1350, 1351, 1352, 1352, 1352, 1352, 1352, 1352,
+    1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352,
+    1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352,
+    1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352,
+    1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352,
+    1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1353, 1354, 1356, 1358,
+    1360, 1362, 1365, 1367, 1370, 1371, 1373, 1375, 1377, 1379, 1381, 1384,
+    1386, 1388, 1391, 1393, 1394, 1395, 1396, 1396, 1396, 1396, 1396, 1396,
+    1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+    1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+    1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+    1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+    1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1400, 1401,
+    1403, 1405, 1407, 1409, 1411, 1413, 1415, 1418, 1420, 1422, 1424, 1426,
+    1428, 1429, 1432, 1433, 1434, 1435, 1436, 1436, 1436, 1436, 1436, 1436,
+    1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
+    1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
+    1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
+    1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
+    1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1439, 1441, 1442,
+    1445, 1447, 1450, 1452, 1454, 1456, 1457, 1460, 1461, 1464, 1466, 1468,
+    1470, 1471, 1474, 1475, 1476, 1477, 1478, 1478, 1478, 1478, 1478, 1478,
+    1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+    1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+    1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+    1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+    1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1481, 1482, 1483,
+    1486, 1487, 1490, 1491, 1494, 1496, 1497, 1500, 1501, 1504, 1505, 1508,
+    1510, 1511, 1514, 1515, 1516, 1517, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+    1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+};
+
+unsigned short garden_map_collision_collision_mesh_hash_triangles[] = {
+    87, 88, 89, 91, 87, 88, 89, 91, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    86, 88, 90, 93, 94, 95, 94, 94, 94, 94, 94, 94, 94, 94, 92, 94, 87, 87, 88,
+    89, 91, 88, 91, 88, 88, 88, 88, 88, 88, 88, 88, 88, 86, 88, 86, 88, 90, 93,
+    94, 95, 94, 95, 94, 94, 94, 94, 94, 94, 92, 94, 92, 94, 87, 87, 89, 91, 88,
+    89, 91, 88, 91, 88, 88, 88, 88, 88, 20, 23, 24, 27, 88, 23, 27, 88, 22, 23,
+    26, 27, 88, 86, 88, 90, 86, 90, 93, 95, 93, 94, 95, 94, 94, 94, 94, 94, 94,
+    92, 94, 92, 87, 87, 89, 87, 89, 91, 88, 89, 91, 88, 91, 88, 88, 88, 88, 20,
+    21, 24, 25, 88, 21, 25, 88, 21, 22, 25, 26, 86, 88, 86, 88, 90, 90, 93, 93,
+    94, 95, 94, 95, 94, 94, 94, 94, 92, 94, 92, 94, 92, 87, 87, 87, 89, 89, 91,
+    88, 91, 88, 88, 88, 88, 28, 31, 32, 35, 88, 31, 35, 88, 30, 31, 34, 35, 86,
+    88, 86, 90, 90, 93, 93, 95, 94, 95, 94, 94, 94, 94, 92, 94, 92, 92, 87, 87,
+    87, 89, 89, 91, 88, 89, 91, 88, 91, 88, 88, 88, 28, 29, 32, 33, 88, 29, 33,
+    86, 88, 29, 30, 33, 34, 86, 88, 86, 90, 90, 93, 93, 95, 94, 95, 94, 95, 94,
+    94, 92, 94, 92, 94, 92, 92, 87, 87, 87, 89, 87, 89, 89, 91, 88, 91, 88, 91,
+    88, 88, 88, 86, 88, 86, 90, 86, 90, 90, 93, 93, 95, 93, 95, 94, 95, 94, 94,
+    92, 94, 92, 92, 92, 87, 87, 87, 87, 89, 89, 91, 89, 91, 88, 91, 10, 11, 13,
+    14, 15, 16, 18, 19, 88, 91, 11, 13, 14, 16, 18, 19, 88, 11, 13, 14, 16, 18,
+    19, 86, 88, 11, 13, 14, 16, 18, 19, 86, 88, 11, 12, 13, 14, 16, 17, 18, 19,
+    86, 90, 0, 1, 3, 4, 5, 6, 8, 9, 90, 1, 3, 4, 6, 8, 9, 90, 93, 1, 3, 4, 6, 8,
+    9, 93, 1, 3, 4, 6, 8, 9, 93, 95, 1, 2, 3, 4, 6, 7, 8, 9, 94, 95, 94, 95, 92,
+    94, 92, 94, 92, 92, 92, 87, 87, 87, 87, 89, 87, 89, 89, 91, 89, 91, 88, 91,
+    88, 91, 86, 88, 86, 86, 90, 90, 90, 93, 93, 93, 95, 95, 94, 95, 92, 94, 92,
+    92, 92, 92, 58, 66, 87, 58, 66, 87, 66, 87, 66, 87, 59, 66, 67, 87, 89, 67,
+    89, 60, 67, 68, 89, 91, 68, 91, 61, 68, 69, 86, 88, 91, 61, 69, 86, 88, 69,
+    86, 69, 74, 80, 86, 90, 80, 90, 75, 80, 90, 93, 75, 93, 75, 76, 81, 93, 95,
+    76, 95, 76, 82, 94, 95, 76, 82, 92, 94, 95, 96, 92, 96, 92, 96, 92, 96, 92,
+    96, 97, 58, 58, 66, 58, 66, 66, 59, 66, 67, 59, 67, 60, 67, 68, 60, 68, 61,
+    68, 61, 69, 61, 69, 69, 74, 80, 74, 80, 75, 80, 75, 81, 75, 76, 81, 76, 82,
+    76, 82, 82, 96, 96, 96, 96, 96, 97, 58, 62, 58, 62, 58, 62, 66, 58, 62, 66,
+    58, 59, 62, 63, 66, 70, 59, 63, 67, 59, 60, 63, 64, 67, 71, 72, 60, 68, 72,
+    60, 61, 65, 68, 72, 73, 61, 73, 61, 69, 73, 61, 69, 73, 74, 77, 83, 74, 80,
+    83, 74, 75, 78, 80, 81, 83, 84, 75, 81, 84, 76, 79, 81, 82, 84, 76, 79, 82,
+    79, 82, 85, 79, 82, 85, 96, 96, 96, 96, 96, 97, 62, 62, 62, 70, 62, 70, 62,
+    63, 70, 63, 71, 63, 64, 71, 72, 64, 72, 65, 72, 73, 65, 73, 73, 73, 77, 83,
+    77, 83, 78, 83, 84, 78, 84, 79, 84, 79, 85, 79, 85, 85, 96, 96, 96, 96, 97,
+    96, 97, 62, 62, 70, 62, 70, 70, 63, 70, 71, 63, 71, 64, 71, 64, 72, 64, 65,
+    72, 65, 73, 65, 73, 73, 77, 77, 83, 77, 78, 83, 78, 84, 78, 79, 84, 79, 85,
+    85, 85, 96, 96, 96, 96, 97, 97, 62, 70, 148, 62, 70, 148, 70, 148, 70, 148,
+    168, 63, 70, 71, 148, 149, 168, 71, 149, 169, 64, 71, 149, 150, 169, 170,
+    64, 150, 170, 64, 65, 72, 151, 170, 171, 65, 151, 171, 65, 73, 171, 36, 46,
+    65, 73, 77, 171, 46, 77, 37, 46, 47, 77, 78, 83, 37, 47, 78, 47, 48, 78, 79,
+    84, 85, 48, 79, 85, 38, 48, 49, 85, 38, 48, 49, 85, 96, 96, 96, 96, 97, 97,
+    148, 148, 168, 148, 168, 148, 168, 149, 168, 149, 169, 150, 169, 150, 170,
+    150, 151, 170, 151, 171, 151, 171, 36, 46, 171, 36, 46, 37, 46, 37, 47, 37,
+    47, 48, 38, 48, 38, 48, 49, 49, 96, 96, 96, 97, 96, 97, 97, 148, 152, 168,
+    172, 148, 152, 168, 172, 168, 172, 168, 172, 149, 153, 168, 169, 172, 173,
+    149, 169, 173, 98, 99, 101, 102, 103, 104, 106, 107, 150, 154, 169, 173,
+    174, 99, 100, 101, 102, 104, 105, 106, 107, 118, 119, 120, 121, 122, 123,
+    124, 125, 126, 127, 150, 174, 150, 151, 155, 170, 174, 151, 155, 128, 131,
+    133, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 151, 155,
+    171, 175, 36, 39, 51, 130, 131, 132, 133, 135, 136, 137, 151, 155, 171, 175,
+    36, 46, 51, 36, 37, 40, 46, 51, 52, 37, 52, 37, 38, 47, 48, 52, 38, 48, 49,
+    38, 49, 49, 96, 96, 96, 97, 97, 97, 152, 152, 172, 152, 172, 152, 172, 153,
+    172, 173, 153, 173, 154, 173, 174, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 154, 174, 155, 174, 155, 175, 128, 129, 133, 138, 139, 140, 142,
+    143, 144, 145, 155, 175, 39, 51, 129, 130, 132, 133, 134, 135, 137, 175, 39,
+    51, 40, 51, 52, 40, 52, 38, 52, 38, 49, 49, 49, 96, 96, 96, 97, 97, 97, 152,
+    156, 176, 152, 156, 176, 152, 176, 152, 172, 176, 152, 153, 157, 172, 176,
+    177, 153, 173, 177, 153, 154, 158, 173, 177, 154, 158, 174, 154, 155, 158,
+    159, 174, 175, 178, 155, 159, 175, 159, 175, 179, 39, 41, 159, 175, 179, 39,
+    41, 51, 39, 40, 41, 42, 51, 53, 40, 42, 52, 38, 40, 42, 49, 50, 52, 54, 38,
+    49, 50, 49, 49, 96, 96, 96, 97, 97, 97, 156, 156, 176, 156, 176, 176, 157,
+    176, 177, 157, 177, 158, 177, 158, 178, 158, 159, 178, 159, 179, 159, 179,
+    41, 179, 41, 53, 41, 42, 53, 42, 54, 42, 50, 54, 49, 50, 49, 50, 49, 96, 96,
+    97, 96, 97, 97, 97, 156, 156, 156, 176, 156, 176, 156, 157, 176, 157, 177,
+    157, 158, 177, 178, 158, 178, 159, 178, 179, 159, 179, 179, 41, 53, 179, 41,
+    53, 42, 53, 54, 42, 54, 50, 54, 50, 49, 50, 49, 96, 96, 97, 97, 97, 97, 156,
+    164, 156, 164, 184, 156, 164, 184, 156, 164, 184, 156, 157, 164, 165, 176,
+    184, 185, 157, 165, 185, 157, 158, 165, 166, 177, 178, 185, 186, 166, 178,
+    186, 159, 166, 167, 178, 179, 186, 167, 179, 187, 167, 179, 187, 41, 45, 53,
+    167, 179, 187, 45, 53, 42, 44, 45, 53, 54, 57, 44, 54, 43, 44, 50, 54, 56,
+    43, 50, 43, 49, 50, 55, 43, 49, 50, 55, 96, 96, 97, 97, 97, 97, 163, 164,
+    184, 163, 164, 184, 163, 184, 163, 183, 184, 162, 163, 165, 183, 184, 185,
+    162, 185, 161, 162, 166, 182, 185, 186, 161, 186, 160, 161, 167, 181, 186,
+    187, 160, 167, 187, 160, 180, 187, 45, 160, 180, 187, 45, 57, 44, 45, 57,
+    44, 43, 44, 56, 43, 43, 55, 55, 96, 96, 97, 97, 97, 97, 163, 163, 163, 183,
+    163, 183, 162, 183, 162, 182, 161, 162, 182, 161, 181, 160, 161, 181, 160,
+    160, 180, 45, 180, 45, 57, 44, 57, 44, 56, 43, 44, 56, 43, 55, 43, 55, 55,
+    96, 97, 96, 97, 97, 97, 97, 163, 163, 163, 183, 183, 162, 183, 162, 182,
+    161, 182, 161, 181, 160, 181, 160, 180, 160, 180, 45, 57, 180, 45, 57, 44,
+    57, 44, 56, 43, 56, 43, 55, 55, 55, 96, 97, 97, 97, 97, 97, 163, 163, 183,
+    163, 183, 183, 162, 182, 183, 162, 182, 161, 181, 182, 161, 181, 160, 181,
+    160, 180, 180, 45, 57, 180, 57, 44, 56, 57, 44, 56, 43, 56, 43, 55, 55, 55,
+    96, 97, 97, 97, 97, 97, 163, 163, 183, 183, 183, 162, 182, 183, 182, 161,
+    181, 182, 181, 160, 180, 181, 160, 180, 180, 45, 57, 180, 57, 44, 56, 57,
+    56, 43, 55, 56, 43, 55, 55, 55, 96, 97, 97, 97, 97, 97,
+};
+
+unsigned int garden_map_collision_collision_mesh_hash_visited
+    [GARDEN_MAP_COLLISION_LENGTH];
 
+SpatialHashQueryContext garden_map_collision_collision_mesh_hash_query = {
+    0,                                                 // unsigned int epoch;
+    garden_map_collision_collision_mesh_hash_visited,  // visitedEpochs;
+    GARDEN_MAP_COLLISION_LENGTH,                       // visitedEpochsSize;
 };
 
 SpatialHash garden_map_collision_collision_mesh_hash = {
@@ -9995,5 +1475,8 @@ SpatialHash garden_map_collision_collision_mesh_hash = {
     120.000000,  // float gridCellSize;
     84,          // int cellsInDimension;
     42,          // int cellOffsetInDimension;
-    garden_map_collision_collision_mesh_hash_data,  // int* data;
+    0,           // int wideIndices;
+    garden_map_collision_collision_mesh_hash_offsets,    // void* bucketOffsets;
+    garden_map_collision_collision_mesh_hash_triangles,  // void* triangleIndices;
+    &garden_map_collision_collision_mesh_hash_query,  // queryContext;
 };
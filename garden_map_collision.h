@@ -8,6 +8,8 @@ extern Triangle garden_map_collision_collision_mesh[];
 
 #define GARDEN_MAP_COLLISION_LENGTH 188
 
+extern CollisionMesh garden_map_collision_collision_mesh_baked;
+
 extern SpatialHash garden_map_collision_collision_mesh_hash;
 
 #endif /* GARDEN_MAP_COLLISION_H */
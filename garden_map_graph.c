@@ -94,13 +94,105 @@ EdgeList garden_map_graphEdges[] = {
     {/*size*/ 2, garden_map_graph_edges_node28},
 };
 
+unsigned char garden_map_graph_next_hops[] = {
+    // from node 0
+    0, 1, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    21, 21, 21, 21, 21, 21, 4, 4, 21, 21, 21, 21, 21,
+    // from node 1
+    0, 1, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // from node 2
+    0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // from node 3
+    2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    // from node 4
+    0, 0, 0, 0, 4, 5, 5, 22, 22, 22, 5, 5, 22, 22, 22, 22,
+    22, 22, 22, 21, 21, 21, 22, 22, 22, 22, 21, 22, 22,
+    // from node 5
+    4, 4, 4, 4, 4, 5, 6, 6, 6, 11, 11, 11, 11, 6, 6, 6,
+    22, 22, 22, 22, 22, 22, 22, 6, 6, 22, 22, 22, 6,
+    // from node 6
+    5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 7, 5, 7, 7, 7, 7,
+    16, 16, 16, 16, 22, 22, 22, 7, 7, 16, 22, 16, 7,
+    // from node 7
+    22, 22, 22, 22, 22, 6, 6, 7, 8, 8, 8, 6, 8, 23, 23, 23,
+    28, 28, 23, 23, 28, 22, 22, 23, 23, 23, 28, 28, 28,
+    // from node 8
+    7, 7, 7, 7, 7, 7, 7, 7, 8, 9, 9, 9, 9, 9, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    // from node 9
+    8, 8, 8, 8, 8, 10, 8, 8, 8, 9, 10, 10, 12, 12, 12, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    // from node 10
+    11, 11, 11, 11, 11, 11, 9, 9, 9, 9, 10, 11, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 11, 11, 9, 9, 9, 9, 9, 9,
+    // from node 11
+    5, 5, 5, 5, 5, 5, 5, 5, 10, 10, 10, 11, 10, 10, 10, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    // from node 12
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 12, 13, 13, 13,
+    9, 9, 13, 13, 9, 9, 9, 9, 13, 13, 9, 9, 9,
+    // from node 13
+    14, 14, 14, 14, 14, 14, 14, 14, 12, 12, 12, 12, 12, 13, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    // from node 14
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 13, 13, 13, 13, 13, 14, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    // from node 15
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 14, 14, 14, 15,
+    24, 24, 24, 24, 24, 24, 23, 23, 24, 24, 24, 24, 23,
+    // from node 16
+    21, 21, 21, 21, 22, 22, 6, 28, 28, 28, 28, 22, 28, 17, 17, 17,
+    16, 17, 17, 17, 27, 21, 22, 28, 17, 17, 27, 27, 28,
+    // from node 17
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18,
+    16, 17, 18, 18, 16, 16, 16, 18, 18, 18, 18, 16, 16,
+    // from node 18
+    17, 17, 17, 17, 17, 17, 17, 24, 24, 24, 24, 17, 24, 24, 24, 24,
+    17, 17, 18, 25, 17, 17, 17, 24, 24, 25, 25, 17, 17,
+    // from node 19
+    26, 26, 26, 26, 26, 26, 25, 25, 25, 25, 25, 26, 25, 25, 25, 25,
+    25, 25, 25, 19, 26, 26, 26, 25, 25, 25, 26, 26, 25,
+    // from node 20
+    21, 21, 21, 21, 21, 22, 22, 27, 27, 27, 27, 22, 27, 27, 27, 27,
+    27, 27, 27, 26, 20, 21, 22, 27, 27, 26, 26, 27, 27,
+    // from node 21
+    0, 0, 0, 0, 4, 22, 22, 22, 22, 22, 22, 22, 22, 16, 16, 16,
+    16, 16, 16, 20, 20, 21, 22, 22, 16, 20, 20, 20, 16,
+    // from node 22
+    4, 4, 4, 4, 4, 5, 6, 7, 7, 7, 5, 5, 7, 7, 7, 7,
+    16, 16, 16, 20, 20, 21, 22, 7, 16, 16, 20, 16, 16,
+    // from node 23
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 15, 15, 15,
+    7, 15, 15, 15, 7, 7, 7, 23, 15, 15, 15, 7, 7,
+    // from node 24
+    18, 18, 18, 18, 18, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    18, 18, 18, 18, 18, 18, 18, 15, 24, 18, 18, 18, 15,
+    // from node 25
+    19, 19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 19, 19, 19, 18, 18, 18, 25, 19, 18, 18,
+    // from node 26
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 19, 19, 19,
+    20, 19, 19, 19, 20, 20, 20, 19, 19, 19, 26, 20, 20,
+    // from node 27
+    20, 20, 20, 20, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 20, 20, 20, 16, 16, 16, 16, 20, 27, 16,
+    // from node 28
+    16, 16, 16, 16, 16, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    16, 16, 16, 16, 16, 16, 16, 7, 7, 16, 16, 16, 28,
+};
+
 Graph garden_map_graph = {
-    GARDEN_MAP_GRAPH_SIZE,  // int size;
-    garden_map_graphNodes,  // Node* nodes;
-    garden_map_graphEdges,  // EdgeList* edges;
+    GARDEN_MAP_GRAPH_SIZE,       // int size;
+    garden_map_graphNodes,       // Node* nodes;
+    garden_map_graphEdges,       // EdgeList* edges;
+    garden_map_graph_next_hops,  // unsigned char* nextHops;
 };
 
 NodeState garden_map_graph_pathfinding_node_states[GARDEN_MAP_GRAPH_SIZE];
+int garden_map_graph_pathfinding_open_list[GARDEN_MAP_GRAPH_SIZE];
 int garden_map_graph_pathfinding_result[GARDEN_MAP_GRAPH_SIZE];
 
 PathfindingState garden_map_graph_pathfinding_state = {
@@ -109,6 +201,8 @@ PathfindingState garden_map_graph_pathfinding_state = {
     garden_map_graph_pathfinding_node_states,
     GARDEN_MAP_GRAPH_SIZE,                // int nodeStateSize;
     0,                                    // int open;
+    garden_map_graph_pathfinding_open_list,  // int* openList;
     garden_map_graph_pathfinding_result,  // int* result;
     0,                                    // int resultSize;
+    0,                                    // int expanded;
 };
@@ -35,6 +35,7 @@
 #include "gl/objloader.hpp"
 #include "gl/texture.hpp"
 #include "input.h"
+#include "inputrecording.h"
 #include "nodegraph/nodegraph.hpp"
 #include "pathfinding.h"
 #include "player.h"
@@ -85,6 +86,8 @@
 #define USE_LIGHTING_STATIC_ONLY 1
 #define USE_FLAT_SHADING 1
 #define USE_ANIM_FRAME_LERP 1
+#define USE_WORLD_MESH_BVH 0
+#define USE_SPATIAL_HASH_FILE 0
 #define ENABLE_NODEGRAPH_EDITOR 0
 
 int glgooseFrame = 0;
@@ -108,11 +111,29 @@ static float farPlane = DEFAULT_FARPLANE;
 
 bool keysDown[127];
 Input input;
+Game glgooseGame;
+// set with the -record command line option. the recording is saved on quit and
+// can be replayed with the headless build (see headless.c). editing objects
+// with the debug ui while recording will make the replay diverge
+char* inputRecordingFilename = NULL;
+
+// Game_snapshot() buffers. doubles so they're 8 byte aligned
+std::vector<double> initialGameSnapshot;
+std::vector<double> savedGameSnapshot;
 GameObject* selectedObject = NULL;
 
-PhysWorldData physWorldData = {garden_map_collision_collision_mesh,
-                               GARDEN_MAP_COLLISION_LENGTH,
+CollisionBVHNode worldMeshBVHNodes[COLLISION_BVH_MAX_NODES(
+    GARDEN_MAP_COLLISION_LENGTH)];
+int worldMeshBVHTriangleIndices[GARDEN_MAP_COLLISION_LENGTH];
+CollisionBVH worldMeshBVH = {worldMeshBVHNodes, 0, worldMeshBVHTriangleIndices};
+
+PhysWorldData physWorldData = {&garden_map_collision_collision_mesh_baked,
                                &garden_map_collision_collision_mesh_hash,
+#if USE_WORLD_MESH_BVH
+                               &worldMeshBVH,
+#else
+                               NULL,
+#endif
                                /*gravity*/ -9.8 * N64_SCALE_FACTOR,
                                /*viscosity*/ 0.05,
                                /*waterHeight*/ WATER_HEIGHT};
@@ -254,10 +275,10 @@ std::string formatEuler(EulerDegrees* self) {
 }
 
 void drawGUI() {
-  Game* game = Game_get();
+  Game* game = &glgooseGame;
   GameObject* obj = selectedObject;
   Character* selectedCharacter =
-      obj == Game_get()->characters->obj ? Game_get()->characters : NULL;
+      obj == glgooseGame.characters->obj ? glgooseGame.characters : NULL;
   ImGuiInputTextFlags inputFlags =
       ImGuiInputTextFlags_EnterReturnsTrue;  // only update on blur
 
@@ -285,8 +306,11 @@ void drawGUI() {
     Game_getObjCenter(obj, &objCenter);
 
     if (ImGui::CollapsingHeader("Object", ImGuiTreeNodeFlags_DefaultOpen)) {
-      ImGui::InputFloat3("Position", (float*)&obj->position, "%.3f",
-                         inputFlags);
+      Vec3d editedPosition = obj->position;
+      if (ImGui::InputFloat3("Position", (float*)&editedPosition, "%.3f",
+                             inputFlags)) {
+        GameObject_setPosition(obj, &editedPosition);
+      }
       ImGui::InputFloat3("Rotation", (float*)&obj->rotation, "%.3f",
                          inputFlags);
       ImGui::InputFloat3(
@@ -309,24 +333,32 @@ void drawGUI() {
     }
     if (obj->physBody) {
       if (ImGui::CollapsingHeader("Physics", ImGuiTreeNodeFlags_DefaultOpen)) {
+        // the motion state is in the world's arrays, so show copies of it
+        Vec3d physVector;
+        int physFlag;
         ImGui::InputInt("physBody", (int*)&obj->physBody->id, 0, 1,
                         ImGuiInputTextFlags_ReadOnly);
-        ImGui::InputFloat3("phys Velocity",
-                           (float*)&obj->physBody->nonIntegralVelocity, "%.3f",
+        PhysBody_getNonIntegralVelocity(obj->physBody, &physVector);
+        ImGui::InputFloat3("phys Velocity", (float*)&physVector, "%.3f",
+                           ImGuiInputTextFlags_ReadOnly);
+        PhysBody_getNonIntegralAcceleration(obj->physBody, &physVector);
+        ImGui::InputFloat3("phys Acceleration", (float*)&physVector, "%.3f",
+                           ImGuiInputTextFlags_ReadOnly);
+
+        PhysBody_getPosition(obj->physBody, &physVector);
+        ImGui::InputFloat3("phys position", (float*)&physVector, "%.3f",
                            ImGuiInputTextFlags_ReadOnly);
-        ImGui::InputFloat3("phys Acceleration",
-                           (float*)&obj->physBody->nonIntegralAcceleration,
-                           "%.3f", ImGuiInputTextFlags_ReadOnly);
-
-        ImGui::InputFloat3("phys position", (float*)&obj->physBody->position,
-                           "%.3f", ImGuiInputTextFlags_ReadOnly);
-        ImGui::InputFloat3("phys prevPosition",
-                           (float*)&obj->physBody->prevPosition, "%.3f",
+        PhysBody_getPrevPosition(obj->physBody, &physVector);
+        ImGui::InputFloat3("phys prevPosition", (float*)&physVector, "%.3f",
                            ImGuiInputTextFlags_ReadOnly);
-        ImGui::InputInt("phys enabled", (int*)&obj->physBody->enabled, 0, 1,
+        physFlag = PhysBody_isEnabled(obj->physBody);
+        ImGui::InputInt("phys enabled", &physFlag, 0, 1,
                         ImGuiInputTextFlags_ReadOnly);
         ImGui::InputInt("phys controlled", (int*)&obj->physBody->controlled, 0,
                         1, ImGuiInputTextFlags_ReadOnly);
+        physFlag = PhysBody_isSleeping(obj->physBody);
+        ImGui::InputInt("phys sleeping", &physFlag, 0, 1,
+                        ImGuiInputTextFlags_ReadOnly);
       }
     }
     if (obj->animState) {
@@ -560,9 +592,35 @@ void drawGUI() {
                 profAvgPhysics, profAvgCharacters, profAvgDraw, profAvgPath);
     ImGui::InputInt("frustumCulled", (int*)&frustumCulled, 0, 10,
                     ImGuiInputTextFlags_ReadOnly);
+    {
+      PhysCollisionStats* collisionStats =
+          &glgooseGame.physicsState.collisionStats;
+      ImGui::Text(
+          "World collision: passes=%d contacts=%d solverIters=%d "
+          "unresolved=%d (max penetration %.3f)",
+          collisionStats->passes, collisionStats->contacts,
+          collisionStats->solverIterations, collisionStats->unresolvedBodies,
+          collisionStats->maxUnresolvedPenetration);
+    }
   }
 
-  Vec3d* goosePos = &Game_get()->player.goose->position;
+  if (ImGui::CollapsingHeader("Snapshot")) {
+    if (ImGui::Button("save snapshot")) {
+      savedGameSnapshot.resize(Game_getSnapshotSize(&glgooseGame) /
+                                   sizeof(double) +
+                               1);
+      Game_snapshot(&glgooseGame, savedGameSnapshot.data(),
+                    savedGameSnapshot.size() * sizeof(double));
+    }
+    if (!savedGameSnapshot.empty() && ImGui::Button("restore snapshot")) {
+      Game_restore(&glgooseGame, savedGameSnapshot.data());
+    }
+    if (ImGui::Button("restart")) {
+      Game_restore(&glgooseGame, initialGameSnapshot.data());
+    }
+  }
+
+  Vec3d* goosePos = &glgooseGame.player.goose->position;
   if (ImGui::CollapsingHeader("Pathfinding")) {
 #if DEBUG_PATHFINDING
     ImGui::InputInt("debugPathfindingFrom", (int*)&debugPathfindingFrom, 1, 10,
@@ -1164,7 +1222,7 @@ void resizeWindow(int w, int h) {
   glViewport(0, 0, w, h);
   // Set the correct perspective.
   gluPerspective(fovy, aspect, nearPlane,
-                 Game_get()->freeView ? 10000 : farPlane);
+                 glgooseGame.freeView ? 10000 : farPlane);
   Frustum_setCamInternals(&frustum, fovy, aspect, nearPlane, farPlane);
   // Get Back to the Modelview
   glMatrixMode(GL_MODELVIEW);
@@ -1196,7 +1254,7 @@ void enableLighting() {
 
 void drawGameObject(GameObject* obj, bool useZBuffering) {
   Vec3d pos, centroidOffset;
-  pos = obj->position;
+  Game_getObjInterpolatedPosition(&glgooseGame, obj, &pos);
   centroidOffset = modelTypesProperties[obj->modelType].centroidOffset;
 
   glPushMatrix();
@@ -1538,8 +1596,8 @@ void doTestPathfinding(int printResult) {
   float profStartPath = CUR_TIME_MS();
 
 #if DEBUG_PATHFINDING_AUTO
-  Vec3d* goosePos = &Game_get()->player.goose->position;
-  Vec3d* characterPos = &Game_get()->characters->obj->position;
+  Vec3d* goosePos = &glgooseGame.player.goose->position;
+  Vec3d* characterPos = &glgooseGame.characters->obj->position;
   debugPathfindingTo = Path_quantizePosition(pathfindingGraph, goosePos);
   debugPathfindingFrom = Path_quantizePosition(pathfindingGraph, characterPos);
 #else
@@ -1555,13 +1613,16 @@ void doTestPathfinding(int printResult) {
       Path_getNodeByID(pathfindingGraph, debugPathfindingTo),    // end
       pathfindingState->nodeStates,     // nodeStates array
       pathfindingState->nodeStateSize,  // nodeStateSize
+      pathfindingState->openList,       // open list array
       pathfindingState->result          // results array
   );
 
   int result = Path_findAStar(pathfindingGraph, pathfindingState);
+  // that was the game's search state, so any search in progress starts over
+  glgooseGame.pathSearchCharacter = -1;
 
   float profTimePath = (CUR_TIME_MS() - profStartPath);
-  Game_get()->profTimePath += profTimePath;
+  glgooseGame.profTimePath += profTimePath;
 
   if (printResult) {
     printf("finding path from %d to %d\n", pathfindingState->start->id,
@@ -1642,8 +1703,8 @@ void drawPathfindingGraph() {
     drawStringAtPoint(std::to_string(i).c_str(), &node->position, TRUE);
   }
 
-  Character* selectedCharacter = selectedObject == Game_get()->characters->obj
-                                     ? Game_get()->characters
+  Character* selectedCharacter = selectedObject == glgooseGame.characters->obj
+                                     ? glgooseGame.characters
                                      : NULL;
   if (selectedCharacter) {
     glPushMatrix();
@@ -1720,7 +1781,7 @@ void renderScene(void) {
   ImGui_ImplOpenGL2_NewFrame();
   ImGui_ImplGLUT_NewFrame();
 
-  game = Game_get();
+  game = &glgooseGame;
 
 #if RENDERER_FAKE_GROUND
   glClearColor(112 / 255.0, 158 / 255.0, 122 / 255.0, 1);
@@ -1960,13 +2021,16 @@ void renderScene(void) {
 
 #if DEBUG_PHYSICS
   PhysBody* body;
+  Vec3d bodyPosition, bodyPrevPosition;
   for (i = 0, body = game->physicsBodies; i < game->physicsBodiesCount;
        i++, body++) {
+    PhysBody_getPosition(body, &bodyPosition);
+    PhysBody_getPrevPosition(body, &bodyPrevPosition);
     glPushMatrix();
-    glTranslatef(body->position.x, body->position.y, body->position.z);
-    drawPhysBall(body->radius);
+    glTranslatef(bodyPosition.x, bodyPosition.y, bodyPosition.z);
+    drawPhysBall(PhysBody_getRadius(body));
     glPopMatrix();
-    drawMotionVectorLine(&body->prevPosition, &body->position);
+    drawMotionVectorLine(&bodyPrevPosition, &bodyPosition);
   }
 #endif
 
@@ -2046,7 +2110,7 @@ void renderScene(void) {
   Character* character;
   for (i = 0, character = game->characters; i < game->charactersCount;
        i++, character++) {
-    Character_toString(character, characterString);
+    Character_toString(character, characterString, &glgooseGame);
     drawString(characterString, 20, glutGet(GLUT_WINDOW_HEIGHT) - 40 * (i + 1));
   }
   i++;
@@ -2116,7 +2180,7 @@ void moveDown() {
 
 void updateFreeView() {
   Game* game;
-  game = Game_get();
+  game = &glgooseGame;
 
   for (int key = 0; key < 127; ++key) {
     if (keysDown[key]) {
@@ -2163,7 +2227,7 @@ void updateFreeView() {
 
 void updateInputs() {
   Game* game;
-  game = Game_get();
+  game = &glgooseGame;
 
   for (int key = 0; key < 127; ++key) {
     if (keysDown[key]) {
@@ -2204,6 +2268,17 @@ void updateInputs() {
 }
 
 void quit(int exitCode) {
+  if (inputRecordingFilename) {
+    InputRecording_stop();
+    if (InputRecording_save(inputRecordingFilename)) {
+      printf("recorded %d ticks of input to %s\n",
+             InputRecording_getTicksCount(), inputRecordingFilename);
+    } else {
+      printf("failed to save input recording to %s\n",
+             inputRecordingFilename);
+    }
+  }
+
   ImGui_ImplOpenGL2_Shutdown();
   ImGui_ImplGLUT_Shutdown();
   ImGui::DestroyContext();
@@ -2261,7 +2336,8 @@ void selectObjectAtScreenPos(int x, int y) {
     }
   }
 #else
-  selectedObject = Game_getIntersectingObject(&raySource, &rayDirection);
+  selectedObject = Game_getIntersectingObject(&glgooseGame, &raySource,
+                                              &rayDirection);
 #endif
 }
 
@@ -2283,9 +2359,10 @@ void testCollision() {
     float objRadius = Game_getObjRadius(selectedObject);
     SphereTriangleCollision result;
     testCollisionTrace = TRUE;
-    Collision_testMeshSphereCollision(
-        garden_map_collision_collision_mesh, GARDEN_MAP_COLLISION_LENGTH,
-        &objCenter, objRadius, physWorldData.worldMeshSpatialHash, &result);
+    Collision_testMeshSphereCollision(physWorldData.worldMesh, &objCenter,
+                                      objRadius,
+                                      physWorldData.worldMeshSpatialHash,
+                                      physWorldData.worldMeshBVH, &result);
     testCollisionTrace = FALSE;
   } else {
     testCollisionResult = -1;
@@ -2295,14 +2372,14 @@ void testCollision() {
 
 void updateAndRender() {
   Game* game;
-  game = Game_get();
+  game = &glgooseGame;
 
   glgooseFrame++;
   updateFreeView();
   if (glgooseFrame % updateSkipRate == 0) {
     updateInputs();
 
-    if (game->tick % 60 == 0) {
+    if (glgooseFrame % 60 == 0) {
       profAvgCharacters = game->profTimeCharacters / 60.0f;
       game->profTimeCharacters = 0.0f;
       profAvgPhysics = game->profTimePhysics / 60.0f;
@@ -2320,7 +2397,7 @@ void updateAndRender() {
     // doTestPathfinding(FALSE);
 #endif
 
-    Game_update(&input);
+    Game_update(game, &input, CUR_TIME_MS());
   }
 
   renderScene();
@@ -2332,11 +2409,32 @@ int main(int argc, char** argv) {
   Game* game;
   GameObject* obj;
 
-  Game_init(garden_map_data, GARDEN_MAP_COUNT, &physWorldData);
+#if USE_SPATIAL_HASH_FILE
+  // replaces the compiled in hash, if the file exists
+  SpatialHash_mapFile(physWorldData.worldMeshSpatialHash,
+                      "garden_map_collision_hash.bin");
+#endif
 
-  game = Game_get();
-  game->pathfindingGraph = pathfindingGraph;
-  game->pathfindingState = pathfindingState;
+  for (i = 1; i < argc - 1; i++) {
+    if (strcmp(argv[i], "-record") == 0) {
+      inputRecordingFilename = argv[i + 1];
+    }
+  }
+
+  Game_init(&glgooseGame, garden_map_data, GARDEN_MAP_COUNT, &physWorldData);
+
+  game = &glgooseGame;
+  Game_initPathfinding(game, pathfindingGraph, pathfindingState);
+
+  initialGameSnapshot.resize(Game_getSnapshotSize(game) / sizeof(double) + 1);
+  Game_snapshot(game, initialGameSnapshot.data(),
+                initialGameSnapshot.size() * sizeof(double));
+
+  if (inputRecordingFilename) {
+    printf("recording input to %s\n", inputRecordingFilename);
+    InputRecording_clear();
+    InputRecording_start();
+  }
 
   freeViewPos = game->player.goose->position;
   freeViewPos.x += 10;
@@ -0,0 +1,513 @@
+// headless native build of the game simulation, for measuring performance
+// without the renderer. runs the garden map for a number of ticks with
+// scripted input, which has the goose steal the gardener's item so the
+// gardener chases it, and prints per-subsystem timing from the trace events.
+// can also record the input to a file, or replay a recording (eg. one made in
+// glgoose) as fast as possible, checking the game state matches every tick.
+// -rollback snapshots the game before every tick, then restores the snapshot
+// and runs the tick again, checking both runs end up in the same state.
+// -astar runs on the garden path graph with every edge split into several,
+// which is too big for a next hop table, so characters search for paths with
+// A* expanding at most budget nodes per tick, spreading searches over several
+// ticks
+// build and run with
+// ./headlessbuild.sh [-record file | -replay file | -rollback]
+//   [-astar budget] [ticks] [physics threads]
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "constants.h"
+#include "game.h"
+#include "gameobject.h"
+#include "input.h"
+#include "inputrecording.h"
+#include "physics.h"
+#include "trace.h"
+
+#include "garden_map.h"
+#include "garden_map_collision.h"
+#include "garden_map_graph.h"
+
+#define HEADLESS_DEFAULT_TICKS 3600
+// how close the goose gets to the item before grabbing it
+#define HEADLESS_PICKUP_DIST 80.0f
+// further than this from where it's going, the goose follows the path graph
+#define HEADLESS_DIRECT_STEER_DIST 200.0f
+// by this many ticks the scripted run has had the gardener chase the goose
+#define HEADLESS_PATHFINDING_TICKS 1000
+// when the simulated clock starts, in ms. not 0, which the physics clock takes
+// to mean it hasn't started
+#define HEADLESS_START_TIME 1000.0
+// -astar splits each edge of the path graph into this many
+#define HEADLESS_ASTAR_EDGE_PIECES 3
+
+typedef struct HeadlessTiming {
+  int count;
+  double total;
+  float max;
+} HeadlessTiming;
+
+PhysWorldData physWorldData = {&garden_map_collision_collision_mesh_baked,
+                               &garden_map_collision_collision_mesh_hash,
+                               NULL,
+                               /*gravity*/ -9.8 * N64_SCALE_FACTOR,
+                               /*viscosity*/ 0.05,
+                               /*waterHeight*/ WATER_HEIGHT};
+
+// the goose's side of the scripted run. it steers by the garden path graph,
+// whichever graph the game is using, with its own pathfinding state, so
+// steering the goose doesn't touch the game's
+typedef struct HeadlessScript {
+  Character* character;  // the character the goose steals from
+  int waitNode;  // where the goose waits, away from the character's item
+  int fleeNode;  // where the goose runs off to with the item
+  PathNodeGrid nodeGrid;
+  PathfindingState path;
+  NodeState nodeStates[GARDEN_MAP_GRAPH_SIZE];
+  int openList[GARDEN_MAP_GRAPH_SIZE];
+  int result[GARDEN_MAP_GRAPH_SIZE];
+} HeadlessScript;
+
+HeadlessTiming timings[MAX_TRACE_EVENT_TYPE];
+HeadlessScript script;
+// the path graph and search state for -astar
+Graph astarGraph;
+PathfindingState astarState;
+
+// builds a copy of the source graph with every edge split into pieces by nodes
+// along it. the source graph's nodes keep their ids. edges must go both ways
+void Headless_splitGraphEdges(Graph* graph, Graph* source, int pieces) {
+  int i, j, k, from, to, splitEdges, edgeElementsCount;
+  int* edgeElements;
+  Node* node;
+  EdgeList* sourceEdges;
+  EdgeList* edges;
+
+  splitEdges = 0;
+  edgeElementsCount = 0;
+  for (i = 0; i < source->size; i++) {
+    edgeElementsCount += source->edges[i].size;
+    for (j = 0; j < source->edges[i].size; j++) {
+      splitEdges += i < source->edges[i].elements[j];
+    }
+  }
+  graph->size = source->size + splitEdges * (pieces - 1);
+  graph->nextHops = NULL;
+  edgeElementsCount += splitEdges * (pieces - 1) * 2;
+  graph->nodes = (Node*)malloc(graph->size * sizeof(Node));
+  graph->edges = (EdgeList*)malloc(graph->size * sizeof(EdgeList));
+  edgeElements = (int*)malloc(edgeElementsCount * sizeof(int));
+  invariant(graph->nodes && graph->edges && edgeElements);
+
+  for (i = 0; i < graph->size; i++) {
+    graph->nodes[i].id = i;
+    graph->edges[i].size = 0;
+  }
+  for (i = 0; i < source->size; i++) {
+    graph->nodes[i].position = source->nodes[i].position;
+    graph->edges[i].elements = edgeElements;
+    edgeElements += source->edges[i].size;
+  }
+
+  node = graph->nodes + source->size;
+  for (i = 0; i < source->size; i++) {
+    sourceEdges = &source->edges[i];
+    for (j = 0; j < sourceEdges->size; j++) {
+      to = sourceEdges->elements[j];
+      if (i > to) {
+        continue;
+      }
+      // a chain of nodes from i to the other end
+      from = i;
+      for (k = 1; k < pieces; k++, node++) {
+        Vec3d_copyFrom(&node->position, &source->nodes[to].position);
+        Vec3d_sub(&node->position, &source->nodes[i].position);
+        Vec3d_mulScalar(&node->position, (float)k / pieces);
+        Vec3d_add(&node->position, &source->nodes[i].position);
+        edges = &graph->edges[node->id];
+        edges->elements = edgeElements;
+        edgeElements += 2;
+
+        graph->edges[from].elements[graph->edges[from].size++] = node->id;
+        edges->elements[edges->size++] = from;
+        from = node->id;
+      }
+      graph->edges[from].elements[graph->edges[from].size++] = to;
+      graph->edges[to].elements[graph->edges[to].size++] = from;
+    }
+  }
+  invariant(node == graph->nodes + graph->size);
+  for (i = 0; i < source->size; i++) {
+    invariant(graph->edges[i].size == source->edges[i].size);
+  }
+}
+
+int Headless_getFarthestNode(Graph* graph, Vec3d* position) {
+  int i, farthest;
+
+  farthest = 0;
+  for (i = 1; i < graph->size; i++) {
+    if (Vec3d_distanceTo(&graph->nodes[i].position, position) >
+        Vec3d_distanceTo(&graph->nodes[farthest].position, position)) {
+      farthest = i;
+    }
+  }
+  return farthest;
+}
+
+void Headless_initScript(Game* game) {
+  Graph* graph;
+
+  invariant(game->charactersCount);
+  graph = &garden_map_graph;
+  PathNodeGrid_init(&script.nodeGrid, graph);
+  script.character = &game->characters[0];
+  script.waitNode = Headless_getFarthestNode(
+      graph, &script.character->defaultActivityItem->initialLocation);
+  script.fleeNode = Headless_getFarthestNode(
+      graph, &Path_getNodeByID(graph, script.waitNode)->position);
+}
+
+// points the input at the target, going by the path graph when it's far away
+void Headless_steerTowards(Game* game, Vec3d* target, Input* input) {
+  int from, to;
+  Graph* graph;
+  Vec3d* goosePosition;
+  Vec3d destination;
+  Vec2d direction;
+
+  graph = &garden_map_graph;
+  goosePosition = &game->player.goose->position;
+  destination = *target;
+  from = PathNodeGrid_quantizePosition(&script.nodeGrid, goosePosition);
+  to = PathNodeGrid_quantizePosition(&script.nodeGrid, target);
+  if (from != to &&
+      Vec3d_distanceTo(goosePosition, target) > HEADLESS_DIRECT_STEER_DIST) {
+    Path_initState(graph, &script.path, Path_getNodeByID(graph, from),
+                   Path_getNodeByID(graph, to), script.nodeStates,
+                   GARDEN_MAP_GRAPH_SIZE, script.openList, script.result);
+    if (Path_findAStar(graph, &script.path) && script.path.resultSize > 1) {
+      destination = Path_getNodeByID(graph, script.result[1])->position;
+    }
+  }
+
+  Vec2d_init(&direction, destination.x - goosePosition->x,
+             destination.z - goosePosition->z);
+  if (Vec2d_lengthSquared(&direction) > 0) {
+    Vec2d_normalise(&direction);
+    input->direction = direction;
+  }
+}
+
+// the goose waits out of the way until the gardener is busy with its default
+// activity, then steals the gardener's item in front of it and runs off with
+// it, so the gardener has to find paths to chase the goose and to take the item
+// home. the goose grabs the item whenever it's close enough, even from the
+// gardener. the input only depends on the game state, so every run with the
+// same tick count simulates exactly the same thing
+void Headless_scriptInput(Input* input, Game* game) {
+  Item* item;
+  Character* character;
+  Graph* graph;
+  Vec3d* goosePosition;
+
+  Input_init(input);
+  graph = &garden_map_graph;
+  character = script.character;
+  item = character->defaultActivityItem;
+  goosePosition = &game->player.goose->position;
+  input->run = TRUE;
+  if (game->player.itemHolder.heldItem) {
+    Headless_steerTowards(
+        game, &Path_getNodeByID(graph, script.fleeNode)->position, input);
+    return;
+  }
+
+  if (character->state == DefaultActivityState &&
+      character->startedActivityTick) {
+    Headless_steerTowards(game, &item->obj->position, input);
+  } else {
+    Headless_steerTowards(
+        game, &Path_getNodeByID(graph, script.waitNode)->position, input);
+  }
+  input->pickup =
+      Vec3d_distanceTo(goosePosition, &item->obj->position) <
+      HEADLESS_PICKUP_DIST;
+}
+
+// runs the tick through Game_update() like the game loop does, on a simulated
+// clock which is a fixed timestep further on every tick, so every call runs
+// exactly one step however long the previous one took
+void Headless_update(Game* game, Input* input, int tick) {
+  unsigned int startTick;
+
+  startTick = game->tick;
+  Game_update(game, input,
+              HEADLESS_START_TIME + (tick + 1) * 1000.0 * PHYS_TIMESTEP);
+  invariant(game->tick == startTick + 1);
+}
+
+void Headless_collectTraceEvents() {
+  int i;
+  float duration;
+  HeadlessTiming* timing;
+
+  for (i = 0; i < Trace_getEventsCount(); i++) {
+    timing = &timings[traceEvents[i].type];
+    duration = traceEvents[i].end - traceEvents[i].start;
+    timing->count++;
+    timing->total += duration;
+    if (duration > timing->max) {
+      timing->max = duration;
+    }
+  }
+  Trace_clear();
+}
+
+void Headless_printTimings(Game* game, int ticks, double totalTime) {
+  int i;
+  HeadlessTiming* timing;
+
+  printf("%-38s %8s %12s %12s %12s\n", "event", "count", "total ms",
+         "ms/tick", "max ms");
+  for (i = 0; i < MAX_TRACE_EVENT_TYPE; i++) {
+    timing = &timings[i];
+    if (!timing->count) {
+      continue;
+    }
+    printf("%-38s %8d %12.3f %12.4f %12.4f\n", TraceEventTypeStrings[i],
+           timing->count, timing->total, timing->total / ticks, timing->max);
+  }
+
+  printf("\ncandidate cache hits=%d misses=%d (%.3f ms on misses)\n",
+         game->physicsState.totalCollisionStats.candidateCacheHits,
+         game->physicsState.totalCollisionStats.candidateCacheMisses,
+         game->physicsState.totalCollisionStats.candidateCacheMissTime);
+  printf("path cache hits=%d misses=%d\n", game->pathCache.hits,
+         game->pathCache.misses);
+  printf("path searches suspended=%d abandoned=%d, characters waited %d "
+         "times\n",
+         game->pathSearchesSuspended, game->pathSearchesAbandoned,
+         game->pathSearchWaits);
+  printf("%d ticks in %.3f ms (%.4f ms/tick)\n", ticks, totalTime,
+         totalTime / ticks);
+}
+
+int main(int argc, char** argv) {
+  Input input;
+  Game gameState;
+  Game* game;
+  int ticks, threads, tick, arg, divergedTicks, rollback, snapshotSize;
+  int astarBudget;
+  char* recordFilename;
+  char* replayFilename;
+  void* snapshot;
+  unsigned int stateHash;
+  float profStartUpdate, profEndUpdate, profStartSnapshot;
+  double startTime;
+
+  recordFilename = NULL;
+  replayFilename = NULL;
+  rollback = FALSE;
+  astarBudget = 0;
+  arg = 1;
+  while (arg < argc && argv[arg][0] == '-') {
+    if (strcmp(argv[arg], "-rollback") == 0) {
+      rollback = TRUE;
+      arg++;
+      continue;
+    }
+    if (arg + 1 == argc) {
+      break;
+    }
+    if (strcmp(argv[arg], "-record") == 0) {
+      recordFilename = argv[arg + 1];
+    } else if (strcmp(argv[arg], "-replay") == 0) {
+      replayFilename = argv[arg + 1];
+    } else if (strcmp(argv[arg], "-astar") == 0) {
+      astarBudget = atoi(argv[arg + 1]);
+      if (astarBudget < 1) {
+        break;
+      }
+    } else {
+      break;
+    }
+    arg += 2;
+  }
+  ticks = argc > arg ? atoi(argv[arg]) : HEADLESS_DEFAULT_TICKS;
+  threads = argc > arg + 1 ? atoi(argv[arg + 1]) : 1;
+  if (ticks < 0 || (ticks == 0 && !replayFilename) || threads < 1 ||
+      (recordFilename != NULL) + (replayFilename != NULL) + rollback > 1 ||
+      (arg < argc && argv[arg][0] == '-')) {
+    printf(
+        "usage: %s [-record file | -replay file | -rollback] [-astar budget] "
+        "[ticks] [physics threads]\n",
+        argv[0]);
+    return 1;
+  }
+
+  if (replayFilename) {
+    if (!InputRecording_load(replayFilename)) {
+      printf("failed to load input recording %s\n", replayFilename);
+      return 1;
+    }
+    // replays the whole recording unless told to stop earlier. 0 ticks means
+    // the whole recording too, for passing a threads count
+    if (argc <= arg || ticks == 0 || ticks > InputRecording_getTicksCount()) {
+      ticks = InputRecording_getTicksCount();
+    }
+    if (ticks < 1) {
+      printf("input recording %s is empty\n", replayFilename);
+      return 1;
+    }
+  }
+
+  game = &gameState;
+  Game_init(game, garden_map_data, GARDEN_MAP_COUNT, &physWorldData);
+  if (astarBudget) {
+    Headless_splitGraphEdges(&astarGraph, &garden_map_graph,
+                             HEADLESS_ASTAR_EDGE_PIECES);
+    invariant(astarGraph.size > PATH_NEXT_HOP_TABLE_MAX_NODES);
+    astarState.nodeStateSize = astarGraph.size;
+    astarState.nodeStates =
+        (NodeState*)malloc(astarGraph.size * sizeof(NodeState));
+    astarState.openList = (int*)malloc(astarGraph.size * sizeof(int));
+    astarState.result = (int*)malloc(astarGraph.size * sizeof(int));
+    invariant(astarState.nodeStates && astarState.openList &&
+              astarState.result);
+    Game_initPathfinding(game, &astarGraph, &astarState);
+    game->pathfindingBudgetPerTick = astarBudget;
+  } else {
+    Game_initPathfinding(game, &garden_map_graph,
+                         &garden_map_graph_pathfinding_state);
+  }
+  Headless_initScript(game);
+  // the first update only starts the clock
+  Input_init(&input);
+  Game_update(game, &input, HEADLESS_START_TIME);
+  invariant(game->tick == 0);
+  if (threads > 1) {
+    PhysState_startWorkers(&game->physicsState, threads);
+  }
+
+  if (recordFilename) {
+    InputRecording_clear();
+    InputRecording_start();
+  }
+
+  snapshot = NULL;
+  snapshotSize = 0;
+  stateHash = 0;
+  if (rollback) {
+    snapshotSize = Game_getSnapshotSize(game);
+    snapshot = malloc(snapshotSize);
+    printf("snapshots are %d bytes\n", snapshotSize);
+  }
+
+  divergedTicks = 0;
+  Trace_start();
+  startTime = CUR_TIME_MS();
+  for (tick = 0; tick < ticks; tick++) {
+    if (replayFilename) {
+      // the recording has the input for each tick, so it replays a step per
+      // update whatever frame rate it was recorded at
+      InputRecording_getTickInput(tick, &input);
+      profStartUpdate = CUR_TIME_MS();
+      Headless_update(game, &input, tick);
+      profEndUpdate = CUR_TIME_MS();
+
+      if (Game_hashState(game) != inputRecords[tick].stateHash) {
+        if (!divergedTicks) {
+          printf("replay diverged from recording at tick %d\n", tick);
+        }
+        divergedTicks++;
+      }
+    } else {
+      if (rollback) {
+        profStartSnapshot = CUR_TIME_MS();
+        Game_snapshot(game, snapshot, snapshotSize);
+        Trace_addEvent(GameSnapshotTraceEvent, profStartSnapshot,
+                       CUR_TIME_MS());
+
+        Headless_scriptInput(&input, game);
+        Headless_update(game, &input, tick);
+        stateHash = Game_hashState(game);
+
+        profStartSnapshot = CUR_TIME_MS();
+        Game_restore(game, snapshot);
+        Trace_addEvent(GameRestoreTraceEvent, profStartSnapshot,
+                       CUR_TIME_MS());
+      }
+
+      Headless_scriptInput(&input, game);
+      profStartUpdate = CUR_TIME_MS();
+      Headless_update(game, &input, tick);
+      profEndUpdate = CUR_TIME_MS();
+
+      if (rollback && Game_hashState(game) != stateHash) {
+        if (!divergedTicks) {
+          printf("tick %d diverged after restoring the snapshot\n", tick);
+        }
+        divergedTicks++;
+      }
+    }
+    Trace_addEvent(MainUpdateTraceEvent, profStartUpdate, profEndUpdate);
+
+    Headless_collectTraceEvents();
+  }
+  Trace_stop();
+
+  if (recordFilename) {
+    InputRecording_stop();
+    if (!InputRecording_save(recordFilename)) {
+      printf("failed to save input recording %s\n", recordFilename);
+      return 1;
+    }
+    printf("recorded %d ticks to %s\n", InputRecording_getTicksCount(),
+           recordFilename);
+  }
+
+  Headless_printTimings(game, ticks, CUR_TIME_MS() - startTime);
+  printf("\ngoose ");
+  Vec3d_print(&game->player.goose->position);
+  printf("\nstate hash %08x\n", Game_hashState(game));
+
+  if (threads > 1) {
+    PhysState_stopWorkers(&game->physicsState);
+  }
+
+  if (rollback) {
+    free(snapshot);
+    if (divergedTicks) {
+      printf("%d of %d ticks diverged after restoring\n", divergedTicks,
+             ticks);
+      return 1;
+    }
+    printf("every tick matched after restoring\n");
+  }
+
+  if (replayFilename) {
+    if (divergedTicks) {
+      printf("replay diverged on %d of %d ticks\n", divergedTicks, ticks);
+      return 1;
+    }
+    printf("replay matched recording for %d ticks\n", ticks);
+  }
+
+  // the scripted run is meant to cover the character AI, pathfinding included
+  if (!replayFilename && ticks >= HEADLESS_PATHFINDING_TICKS &&
+      !game->pathCache.misses) {
+    printf("no character searched for a path in %d ticks\n", ticks);
+    return 1;
+  }
+  // and with -astar, searches spread over several ticks
+  if (!replayFilename && ticks >= HEADLESS_PATHFINDING_TICKS && astarBudget &&
+      (!game->pathSearchesSuspended || !game->pathSearchWaits)) {
+    printf("no path search ran out of budget in %d ticks\n", ticks);
+    return 1;
+  }
+  return 0;
+}
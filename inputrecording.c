@@ -0,0 +1,192 @@
+#include "inputrecording.h"
+#include "constants.h"
+
+#ifndef __N64__
+#include <stdio.h>
+#endif
+
+static unsigned char inputRecordingMagic[4] = {'G', 'I', 'N', 'P'};
+
+InputRecord inputRecords[INPUT_RECORDING_MAX_TICKS];
+static int inputRecordsCount = 0;
+static int recordingEnabled = FALSE;
+
+void InputRecording_clear() {
+  inputRecordsCount = 0;
+}
+
+void InputRecording_start() {
+  recordingEnabled = TRUE;
+}
+
+void InputRecording_stop() {
+  recordingEnabled = FALSE;
+}
+
+int InputRecording_isRecording() {
+  return recordingEnabled;
+}
+
+int InputRecording_isFull() {
+  return inputRecordsCount == INPUT_RECORDING_MAX_TICKS;
+}
+
+int InputRecording_getTicksCount() {
+  return inputRecordsCount;
+}
+
+void InputRecording_recordTick(Input* input, unsigned int stateHash) {
+  InputRecord* record;
+
+  if (!recordingEnabled || InputRecording_isFull()) {
+    return;
+  }
+  record = &inputRecords[inputRecordsCount];
+  record->direction = input->direction;
+  record->stateHash = stateHash;
+  record->buttons = (input->run ? InputRecordRunButton : 0) |
+                    (input->pickup ? InputRecordPickupButton : 0) |
+                    (input->zoomIn ? InputRecordZoomInButton : 0) |
+                    (input->zoomOut ? InputRecordZoomOutButton : 0);
+  inputRecordsCount++;
+}
+
+void InputRecording_getTickInput(int tick, Input* result) {
+  InputRecord* record;
+
+  record = &inputRecords[tick];
+  result->direction = record->direction;
+  result->run = (record->buttons & InputRecordRunButton) != 0;
+  result->pickup = (record->buttons & InputRecordPickupButton) != 0;
+  result->zoomIn = (record->buttons & InputRecordZoomInButton) != 0;
+  result->zoomOut = (record->buttons & InputRecordZoomOutButton) != 0;
+}
+
+static unsigned int InputRecording_floatBits(float value) {
+  union {
+    float f;
+    unsigned int u;
+  } bits;
+
+  bits.f = value;
+  return bits.u;
+}
+
+static void InputRecording_writeU32(unsigned int value, unsigned char* buffer) {
+  buffer[0] = value & 0xff;
+  buffer[1] = (value >> 8) & 0xff;
+  buffer[2] = (value >> 16) & 0xff;
+  buffer[3] = (value >> 24) & 0xff;
+}
+
+void InputRecording_serializeHeader(int ticksCount, unsigned char* buffer) {
+  int i;
+  for (i = 0; i < 4; i++) {
+    buffer[i] = inputRecordingMagic[i];
+  }
+  InputRecording_writeU32(INPUT_RECORDING_VERSION, buffer + 4);
+  InputRecording_writeU32(ticksCount, buffer + 8);
+}
+
+void InputRecording_serializeTick(int tick, unsigned char* buffer) {
+  InputRecord* record;
+
+  record = &inputRecords[tick];
+  InputRecording_writeU32(InputRecording_floatBits(record->direction.x),
+                          buffer);
+  InputRecording_writeU32(InputRecording_floatBits(record->direction.y),
+                          buffer + 4);
+  InputRecording_writeU32(record->stateHash, buffer + 8);
+  buffer[12] = record->buttons;
+}
+
+#ifndef __N64__
+static float InputRecording_bitsFloat(unsigned int value) {
+  union {
+    float f;
+    unsigned int u;
+  } bits;
+
+  bits.u = value;
+  return bits.f;
+}
+
+static unsigned int InputRecording_readU32(unsigned char* buffer) {
+  return buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) |
+         ((unsigned int)buffer[3] << 24);
+}
+
+static void InputRecording_deserializeTick(unsigned char* buffer,
+                                           InputRecord* record) {
+  record->direction.x =
+      InputRecording_bitsFloat(InputRecording_readU32(buffer));
+  record->direction.y =
+      InputRecording_bitsFloat(InputRecording_readU32(buffer + 4));
+  record->stateHash = InputRecording_readU32(buffer + 8);
+  record->buttons = buffer[12];
+}
+
+// returns FALSE if the file couldn't be written
+int InputRecording_save(char* filename) {
+  FILE* file;
+  unsigned char buffer[INPUT_RECORDING_TICK_BYTES];
+  int i, ok;
+
+  file = fopen(filename, "wb");
+  if (!file) {
+    return FALSE;
+  }
+
+  InputRecording_serializeHeader(inputRecordsCount, buffer);
+  ok = fwrite(buffer, INPUT_RECORDING_HEADER_BYTES, 1, file) == 1;
+  for (i = 0; ok && i < inputRecordsCount; i++) {
+    InputRecording_serializeTick(i, buffer);
+    ok = fwrite(buffer, INPUT_RECORDING_TICK_BYTES, 1, file) == 1;
+  }
+
+  return fclose(file) == 0 && ok;
+}
+
+// replaces the current recording with the one in the file. returns FALSE if
+// the file couldn't be read or isn't a recording
+int InputRecording_load(char* filename) {
+  FILE* file;
+  unsigned char buffer[INPUT_RECORDING_TICK_BYTES];
+  int i, ticksCount;
+
+  file = fopen(filename, "rb");
+  if (!file) {
+    return FALSE;
+  }
+
+  inputRecordsCount = 0;
+  if (fread(buffer, INPUT_RECORDING_HEADER_BYTES, 1, file) != 1) {
+    fclose(file);
+    return FALSE;
+  }
+  for (i = 0; i < 4; i++) {
+    if (buffer[i] != inputRecordingMagic[i]) {
+      fclose(file);
+      return FALSE;
+    }
+  }
+  ticksCount = InputRecording_readU32(buffer + 8);
+  if (InputRecording_readU32(buffer + 4) != INPUT_RECORDING_VERSION ||
+      ticksCount < 0 || ticksCount > INPUT_RECORDING_MAX_TICKS) {
+    fclose(file);
+    return FALSE;
+  }
+
+  for (i = 0; i < ticksCount; i++) {
+    if (fread(buffer, INPUT_RECORDING_TICK_BYTES, 1, file) != 1) {
+      fclose(file);
+      return FALSE;
+    }
+    InputRecording_deserializeTick(buffer, &inputRecords[i]);
+  }
+  inputRecordsCount = ticksCount;
+
+  fclose(file);
+  return TRUE;
+}
+#endif
@@ -0,0 +1,53 @@
+#ifndef INPUTRECORDING_H
+#define INPUTRECORDING_H
+
+#include "input.h"
+
+// the input for each game tick, along with a hash of the game state after the
+// tick, so a recording can be replayed to check the game still behaves the same
+
+#ifdef __N64__
+#define INPUT_RECORDING_MAX_TICKS 3600  // one minute
+#else
+#define INPUT_RECORDING_MAX_TICKS 216000  // one hour
+#endif
+
+// serialized size of each tick in a recording file
+#define INPUT_RECORDING_TICK_BYTES 13
+#define INPUT_RECORDING_HEADER_BYTES 12  // must be <= INPUT_RECORDING_TICK_BYTES
+#define INPUT_RECORDING_VERSION 1
+
+typedef enum InputRecordButton {
+  InputRecordRunButton = 1 << 0,
+  InputRecordPickupButton = 1 << 1,
+  InputRecordZoomInButton = 1 << 2,
+  InputRecordZoomOutButton = 1 << 3,
+} InputRecordButton;
+
+typedef struct InputRecord {
+  Vec2d direction;
+  unsigned int stateHash;
+  unsigned char buttons;  // InputRecordButton flags
+} InputRecord;
+
+extern InputRecord inputRecords[INPUT_RECORDING_MAX_TICKS];
+
+void InputRecording_clear();
+void InputRecording_start();
+void InputRecording_stop();
+int InputRecording_isRecording();
+int InputRecording_isFull();
+int InputRecording_getTicksCount();
+void InputRecording_recordTick(Input* input, unsigned int stateHash);
+void InputRecording_getTickInput(int tick, Input* result);
+
+// recordings are stored little endian, whichever platform they were made on
+void InputRecording_serializeHeader(int ticksCount, unsigned char* buffer);
+void InputRecording_serializeTick(int tick, unsigned char* buffer);
+
+#ifndef __N64__
+int InputRecording_save(char* filename);
+int InputRecording_load(char* filename);
+#endif
+
+#endif /* !INPUTRECORDING_H */
@@ -28,16 +28,16 @@ void Item_init(Item* self, GameObject* obj, Game* game) {
   self->initialLocation = obj->position;
 }
 
-void Item_take(Item* self, ItemHolder* newHolder) {
+void Item_take(Item* self, ItemHolder* newHolder, Game* game) {
   ItemHolder* originalHolder;
   originalHolder = NULL;
 
   if (self->holder
           // ensure player can't pick up or drop this really quickly
-          ? Game_get()->tick > self->lastPickedUpTick + ITEM_PICKUP_COOLDOWN
+          ? game->tick > self->lastPickedUpTick + ITEM_PICKUP_COOLDOWN
           // ensure that characters can't steal this object back from each other
           // too frequently
-          : Game_get()->tick > self->lastPickedUpTick + ITEM_STEAL_COOLDOWN) {
+          : game->tick > self->lastPickedUpTick + ITEM_STEAL_COOLDOWN) {
 #if ITEM_DEBUG
     if (self->holder) {
       debugPrintf("item taken from %s by %s\n",
@@ -58,10 +58,11 @@ void Item_take(Item* self, ItemHolder* newHolder) {
       // shitty dynamic dispatch
       switch (originalHolder->itemHolderType) {
         case PlayerItemHolder:
-          Player_haveItemTaken((Player*)originalHolder->owner, self);
+          Player_haveItemTaken((Player*)originalHolder->owner, self, game);
           break;
         case CharacterItemHolder:
-          Character_haveItemTaken((Character*)originalHolder->owner, self);
+          Character_haveItemTaken((Character*)originalHolder->owner, self,
+                                  game);
           break;
       }
     }
@@ -71,7 +72,7 @@ void Item_take(Item* self, ItemHolder* newHolder) {
     newHolder->heldItem = self;
     // be held by new holder
     self->holder = newHolder;
-    self->lastPickedUpTick = Game_get()->tick;
+    self->lastPickedUpTick = game->tick;
 
     // disable rendering and physics (character will show as attachment instead)
     self->obj->visible = FALSE;
@@ -83,6 +84,7 @@ void Item_take(Item* self, ItemHolder* newHolder) {
 }
 
 void Item_drop(Item* self) {
+  Vec3d groundPosition;
   invariant(self->holder != NULL);
 
   debugPrintf("item dropped by %s\n",
@@ -92,7 +94,9 @@ void Item_drop(Item* self) {
   // no longer held
   self->holder = NULL;
   // put it back on the ground
-  self->obj->position.y = 0;
+  groundPosition = self->obj->position;
+  groundPosition.y = 0;
+  GameObject_setPosition(self->obj, &groundPosition);
 
   // re-enable rendering and physics
   self->obj->visible = TRUE;
@@ -7,7 +7,7 @@
 
 void Item_init(Item* self, GameObject* obj, Game* game);
 
-void Item_take(Item* self, ItemHolder* newHolder);
+void Item_take(Item* self, ItemHolder* newHolder, Game* game);
 void Item_drop(Item* self);
 
 void ItemHolder_init(ItemHolder* self,
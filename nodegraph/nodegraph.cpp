@@ -140,6 +140,8 @@ bool NodeGraph::save(std::string path, std::string name) {
   fout_h << "extern PathfindingState " << name << "_pathfinding_state;\n";
   fout_h << "extern NodeState " << name << "_pathfinding_node_states["
          << nameUpper << "_SIZE];\n";
+  fout_h << "extern int " << name << "_pathfinding_open_list[" << nameUpper
+         << "_SIZE];\n";
   fout_h << "extern int " << name << "_pathfinding_result[" << nameUpper
          << "_SIZE];\n\n";
   fout_h << "#endif /* !" << nameUpper << "_H */\n";
@@ -203,26 +205,72 @@ bool NodeGraph::save(std::string path, std::string name) {
   }
   fout_c << "};\n\n";
 
+  /*
+  unsigned char garden_map_graph_next_hops[] = {
+      // from node 0
+      0, 1, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+      21, 21, 21, 21, 21, 21, 4, 4, 21, 21, 21, 21, 21,
+  ...
+  };
+   */
+  bool hasNextHops = nodes.size() <= PATH_NEXT_HOP_TABLE_MAX_NODES;
+  if (hasNextHops) {
+    std::vector<std::vector<int>> edgeElements;
+    std::vector<EdgeList> edgeLists;
+    for (auto nodeEdges = nodesEdges.begin(); nodeEdges != nodesEdges.end();
+         ++nodeEdges) {
+      edgeElements.push_back(
+          std::vector<int>(nodeEdges->begin(), nodeEdges->end()));
+    }
+    for (auto elements = edgeElements.begin(); elements != edgeElements.end();
+         ++elements) {
+      edgeLists.push_back({(int)elements->size(), elements->data()});
+    }
+    Graph graph = {(int)nodes.size(), nodes.data(), edgeLists.data(), NULL};
+    std::vector<float> costs(nodes.size() * nodes.size());
+    std::vector<unsigned char> nextHops(nodes.size() * nodes.size());
+    Path_buildNextHopTable(&graph, costs.data(), nextHops.data());
+
+    fout_c << "unsigned char " << name << "_next_hops[] = {\n";
+    for (int from = 0; from < nodes.size(); from++) {
+      fout_c << "    // from node " << from << "\n";
+      for (int to = 0; to < nodes.size(); to++) {
+        fout_c << (to % 16 == 0 ? "    " : " ")
+               << (int)nextHops[from * nodes.size() + to] << ",";
+        if (to % 16 == 15 || to == nodes.size() - 1) {
+          fout_c << "\n";
+        }
+      }
+    }
+    fout_c << "};\n\n";
+  }
+
   /*
   Graph garden_map_graph = {
-      GARDEN_MAP_GRAPH_SIZE,  // int size;
-      garden_map_graphNodes,  // Node* nodes;
-      garden_map_graphEdges,  // EdgeList* edges;
+      GARDEN_MAP_GRAPH_SIZE,       // int size;
+      garden_map_graphNodes,       // Node* nodes;
+      garden_map_graphEdges,       // EdgeList* edges;
+      garden_map_graph_next_hops,  // unsigned char* nextHops;
   };
    */
   fout_c << "Graph " << name << " = {\n";
   fout_c << "    " << nameUpper << "_SIZE,  // int size;\n";
   fout_c << "    " << name << "Nodes,  // Node* nodes;\n";
   fout_c << "    " << name << "Edges,  // EdgeList* edges;\n";
+  fout_c << "    " << (hasNextHops ? name + "_next_hops" : "NULL")
+         << ",  // unsigned char* nextHops;\n";
   fout_c << "};\n\n";
 
   /*
   NodeState
       garden_map_graph_pathfinding_node_states[GARDEN_MAP_GRAPH_SIZE];
+  int garden_map_graph_pathfinding_open_list[GARDEN_MAP_GRAPH_SIZE];
   int garden_map_graph_pathfinding_result[GARDEN_MAP_GRAPH_SIZE];
    */
   fout_c << "NodeState " << name << "_pathfinding_node_states[" << nameUpper
          << "_SIZE];\n";
+  fout_c << "int " << name << "_pathfinding_open_list[" << nameUpper
+         << "_SIZE];\n";
   fout_c << "int " << name << "_pathfinding_result[" << nameUpper
          << "_SIZE];\n\n";
 
@@ -233,8 +281,10 @@ bool NodeGraph::save(std::string path, std::string name) {
       garden_map_graph_pathfinding_node_states,  // NodeState* nodeStates;
       GARDEN_MAP_GRAPH_SIZE,                     // int nodeStateSize;
       0,                                             // int open;
+      garden_map_graph_pathfinding_open_list,    // int* openList;
       garden_map_graph_pathfinding_result,       // int* result;
       GARDEN_MAP_GRAPH_SIZE,                     // int resultSize;
+      0,                                             // int expanded;
   };
    */
   fout_c << "PathfindingState " << name << "_pathfinding_state = {\n";
@@ -243,8 +293,10 @@ bool NodeGraph::save(std::string path, std::string name) {
   fout_c << "    " << name << "_pathfinding_node_states,\n";
   fout_c << "    " << nameUpper << "_SIZE, // int nodeStateSize;\n";
   fout_c << "    0, // int open;\n";
+  fout_c << "    " << name << "_pathfinding_open_list, // int* openList;\n";
   fout_c << "    " << name << "_pathfinding_result, // int* result;\n";
   fout_c << "    0, // int resultSize;\n";
+  fout_c << "    0, // int expanded;\n";
   fout_c << "};\n\n";
   fout_c.close();
 
@@ -1,4 +1,9 @@
 #include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#ifdef __N64__
+#include <malloc.h>
+#endif
 
 #include "constants.h"
 #include "pathfinding.h"
@@ -26,6 +31,7 @@ void Path_initState(Graph* graph,
                     Node* end,
                     NodeState* nodeStates,
                     int nodeStateSize,
+                    int* openList,
                     int* result) {
   int i;
   Node* node;
@@ -34,8 +40,10 @@ void Path_initState(Graph* graph,
   state->end = end;
   state->nodeStates = nodeStates;
   state->nodeStateSize = nodeStateSize;
+  state->openList = openList;
   state->result = result;
   state->resultSize = 0;
+  state->expanded = 0;
   for (i = 0, node = graph->nodes, nodeState = state->nodeStates;  //
        i < graph->size;                                            //
        i++, node++, nodeState++                                    //
@@ -46,13 +54,86 @@ void Path_initState(Graph* graph,
     nodeState->costSoFar = 0.0f;
     nodeState->estimatedTotalCost = 0.0f;
     nodeState->category = UnvisitedNodeStateCategory;
+    nodeState->openListIndex = -1;
   }
   state->open = 0;
 }
 
+// whether node state a should come out of the open list before b
+int Path_isOpenNodeBefore(NodeState* a, NodeState* b) {
+  return a->estimatedTotalCost < b->estimatedTotalCost ||
+         (a->estimatedTotalCost == b->estimatedTotalCost &&
+          a->nodeID < b->nodeID);
+}
+
+void Path_setOpenListEntry(PathfindingState* state, int index, int nodeID) {
+  state->openList[index] = nodeID;
+  state->nodeStates[nodeID].openListIndex = index;
+}
+
+void Path_openListSiftUp(PathfindingState* state, int index) {
+  int nodeID, parent;
+  NodeState* nodeState;
+
+  nodeID = state->openList[index];
+  nodeState = state->nodeStates + nodeID;
+  while (index > 0) {
+    parent = (index - 1) / 2;
+    if (!Path_isOpenNodeBefore(nodeState,
+                               state->nodeStates + state->openList[parent])) {
+      break;
+    }
+    Path_setOpenListEntry(state, index, state->openList[parent]);
+    index = parent;
+  }
+  Path_setOpenListEntry(state, index, nodeID);
+}
+
+void Path_openListSiftDown(PathfindingState* state, int index) {
+  int nodeID, child;
+  NodeState* nodeState;
+
+  nodeID = state->openList[index];
+  nodeState = state->nodeStates + nodeID;
+  for (;;) {
+    child = index * 2 + 1;
+    if (child >= state->open) {
+      break;
+    }
+    if (child + 1 < state->open &&
+        Path_isOpenNodeBefore(state->nodeStates + state->openList[child + 1],
+                              state->nodeStates + state->openList[child])) {
+      child++;
+    }
+    if (!Path_isOpenNodeBefore(state->nodeStates + state->openList[child],
+                               nodeState)) {
+      break;
+    }
+    Path_setOpenListEntry(state, index, state->openList[child]);
+    index = child;
+  }
+  Path_setOpenListEntry(state, index, nodeID);
+}
+
 void Path_addToOpenList(PathfindingState* state, NodeState* nodeState) {
   nodeState->category = OpenNodeStateCategory;
-  state->open++;
+  if (state->openList) {
+    state->openList[state->open] = nodeState->nodeID;
+    state->open++;
+    Path_openListSiftUp(state, state->open - 1);
+  } else {
+    state->open++;
+  }
+}
+
+// moves an open node to its place in the open list after its
+// estimatedTotalCost changed
+void Path_updateOpenNode(PathfindingState* state, NodeState* nodeState) {
+  if (state->openList) {
+    invariant(nodeState->openListIndex != -1);
+    Path_openListSiftUp(state, nodeState->openListIndex);
+    Path_openListSiftDown(state, nodeState->openListIndex);
+  }
 }
 
 NodeState* Path_getSmallestOpenNode(Graph* graph, PathfindingState* state) {
@@ -77,6 +158,27 @@ NodeState* Path_getSmallestOpenNode(Graph* graph, PathfindingState* state) {
   return minCostNodeState;
 }
 
+// takes the open node with the smallest estimatedTotalCost out of the open
+// list. it stays in the open category until it's closed
+NodeState* Path_removeSmallestOpenNode(Graph* graph, PathfindingState* state) {
+  NodeState* smallest;
+
+  if (!state->openList) {
+    smallest = Path_getSmallestOpenNode(graph, state);
+    state->open--;
+    return smallest;
+  }
+
+  smallest = state->nodeStates + state->openList[0];
+  smallest->openListIndex = -1;
+  state->open--;
+  if (state->open > 0) {
+    Path_setOpenListEntry(state, 0, state->openList[state->open]);
+    Path_openListSiftDown(state, 0);
+  }
+  return smallest;
+}
+
 Node* Path_getNodeByID(Graph* graph, int nodeID) {
   return graph->nodes + nodeID;  // offset into edges
 }
@@ -89,6 +191,9 @@ NodeState* Path_getNodeState(PathfindingState* state, int nodeID) {
   return state->nodeStates + nodeID;  // offset into edges
 }
 
+// the closest node to a position, measuring the distance to every node.
+// PathNodeGrid_getNearest() finds the same node faster, and can skip nodes
+// which can't be reached from the position
 int Path_quantizePosition(Graph* graph, Vec3d* position) {
   int closestNode = 0;
   float closestNodeDist = FLT_MAX;
@@ -171,34 +276,168 @@ float Path_getClosestPointParameter(Vec3d* segmentPoint0,
   return resultSegmentParameter;
 }
 
-// based on A* implementation from AI For Games
+// fills in the shortest path from the start to the end node by following the
+// graph's next hop table
+int Path_followNextHops(Graph* graph, PathfindingState* state) {
+  int nodeID, endID;
+
+  nodeID = state->start->id;
+  endID = state->end->id;
+  state->resultSize = 0;
+  if (graph->nextHops[nodeID * graph->size + endID] == PATH_NO_NEXT_HOP) {
+    debugPrintf("Pathfinding: no next hop towards the goal\n");
+    return FALSE;
+  }
+
+  state->result[state->resultSize++] = nodeID;
+  while (nodeID != endID) {
+    nodeID = graph->nextHops[nodeID * graph->size + endID];
+    invariant(state->resultSize < graph->size);
+    state->result[state->resultSize++] = nodeID;
+  }
+  return TRUE;
+}
+
+// finds the shortest path between every pair of nodes with the Floyd-Warshall
+// algorithm, to fill in a next hop table for the graph. costs is scratch space
+// for size * size floats, and nextHops needs to be size * size bytes too
+void Path_buildNextHopTable(Graph* graph,
+                            float* costs,
+                            unsigned char* nextHops) {
+  int size, from, to, via, i;
+  EdgeList* edges;
+  float cost;
+
+  size = graph->size;
+  invariant(size <= PATH_NEXT_HOP_TABLE_MAX_NODES);
+  for (from = 0; from < size; from++) {
+    for (to = 0; to < size; to++) {
+      costs[from * size + to] = from == to ? 0.0f : FLT_MAX;
+      nextHops[from * size + to] = from == to ? from : PATH_NO_NEXT_HOP;
+    }
+    edges = Path_getNodeEdgesByID(graph, from);
+    for (i = 0; i < edges->size; i++) {
+      to = edges->elements[i];
+      cost = Path_distance(Path_getNodeByID(graph, from),
+                           Path_getNodeByID(graph, to));
+      if (cost < costs[from * size + to]) {
+        costs[from * size + to] = cost;
+        nextHops[from * size + to] = to;
+      }
+    }
+  }
+
+  for (via = 0; via < size; via++) {
+    for (from = 0; from < size; from++) {
+      if (costs[from * size + via] == FLT_MAX) {
+        continue;
+      }
+      for (to = 0; to < size; to++) {
+        if (costs[via * size + to] == FLT_MAX) {
+          continue;
+        }
+        cost = costs[from * size + via] + costs[via * size + to];
+        if (cost < costs[from * size + to]) {
+          costs[from * size + to] = cost;
+          nextHops[from * size + to] = nextHops[from * size + via];
+        }
+      }
+    }
+  }
+}
+
+// Compile the list of edges in the path, working back from the goal node.
+static void Path_compileResult(PathfindingState* state, NodeState* current) {
+  int* result;
+
+  result = state->result;
+
+  // add end node
+  *result = current->nodeID;
+  state->resultSize++;
+  result++;
+
+  // Work back along the path, accumulating edges.
+  while (current->reachedViaNode != NULL) {
+    current = Path_getNodeState(state, current->reachedViaNode->id);
+    // add node
+    *result = current->nodeID;
+    state->resultSize++;
+    result++;
+  }
+
+  Path_reverse(state);
+}
+
+// based on A* implementation from AI For Games. if the graph has a next hop
+// table the path is looked up instead
 int Path_findAStar(Graph* graph, PathfindingState* state) {
+  Path_startAStar(graph, state);
+  return Path_continueAStar(graph, state, PATH_NO_EXPANSION_LIMIT) ==
+         PathSearchFound;
+}
+
+// begins a search set up with Path_initState(), which Path_continueAStar()
+// then carries out
+void Path_startAStar(Graph* graph, PathfindingState* state) {
+  NodeState* startNode;
+
+  if (graph->nextHops) {
+    return;
+  }
+
+  // Initialize the record for the start node.
+  startNode = Path_getNodeState(state, state->start->id);
+  startNode->estimatedTotalCost = Path_heuristic(state->start, state->end);
+  startNode->costSoFar = 0.0f;
+  Path_addToOpenList(state, startNode);
+}
+
+// expands up to maxExpansions more nodes of a search begun with
+// Path_startAStar(), or PATH_NO_EXPANSION_LIMIT to finish it. returns
+// PathSearchInProgress if it stopped before reaching the goal, in which case
+// calling it again with the same state carries on from where it left off. the
+// nodes are expanded in the same order however the search is split up, so the
+// path found is the same. paths in a next hop table are always looked up in
+// one go, without expanding any nodes
+PathSearchStatus Path_continueAStar(Graph* graph,
+                                    PathfindingState* state,
+                                    int maxExpansions) {
   // This structure is used to keep track of the
   // information we need for each node.
-  NodeState* startNode;
   NodeState* current;
   EdgeList* edges;
   int* reachedViaNodeID;
   float edgeCost;
-  int i;
+  int i, expansions;
   NodeState* endNode;
   float endNodeCost;  // current to end node cost
   float endNodeHeuristic;
-  int* result;
-  // Initialize the record for the start node.
-  startNode = Path_getNodeState(state, state->start->id);
-  startNode->estimatedTotalCost = Path_heuristic(state->start, state->end);
-  startNode->costSoFar = 0.0f;
-  Path_addToOpenList(state, startNode);
 
-  while (state->open > 0) {
+  if (graph->nextHops) {
+    return Path_followNextHops(graph, state) ? PathSearchFound
+                                             : PathSearchFailed;
+  }
+
+  for (expansions = 0;
+       maxExpansions == PATH_NO_EXPANSION_LIMIT || expansions < maxExpansions;
+       expansions++) {
+    if (state->open == 0) {
+      // We’ve run out of nodes without finding the goal, so there’s
+      // no solution.
+      debugPrintf("Pathfinding: ran out of nodes without finding the goal\n");
+      return PathSearchFailed;
+    }
+
     // Find the smallest element in the open list (using the
-    // estimatedTotalCost).
-    current = Path_getSmallestOpenNode(graph, state);
+    // estimatedTotalCost), and remove it from the open list.
+    current = Path_removeSmallestOpenNode(graph, state);
 
     // If it is the goal node, then terminate.
     if (current->node == state->end) {
-      break;
+      Path_compileResult(state, current);
+      // path is in state->result
+      return PathSearchFound;
     }
 
     // Otherwise get its outgoing edges.
@@ -252,49 +491,321 @@ int Path_findAStar(Graph* graph, PathfindingState* state) {
       endNode->reachedViaNode = current->node;
       endNode->estimatedTotalCost = endNodeCost + endNodeHeuristic;
 
-      // And add it to the open list.
+      // And add it to the open list, or move it to its new place there.
       if (endNode->category != OpenNodeStateCategory) {
         Path_addToOpenList(state, endNode);
+      } else {
+        Path_updateOpenNode(state, endNode);
       }
     }
     // We’ve finished looking at the edges for the current
-    // node, so add it to the closed list and remove it from the
+    // node, so add it to the closed list. It was already removed from the
     // open list.
-    if (current->category == OpenNodeStateCategory) {
-      state->open--;
-    }
     current->category = ClosedNodeStateCategory;
+    state->expanded++;
   }
 
-  // We’re here if we’ve either found the goal, or if we’ve no more
-  // nodes to search, find which.
-  if (current->node != state->end) {
-    // We’ve run out of nodes without finding the goal, so there’s
-    // no solution.
-    debugPrintf("Pathfinding: ran out of nodes without finding the goal\n");
-    return FALSE;
-  } else {
-    // Compile the list of edges in the path.
+  return PathSearchInProgress;
+}
 
-    result = state->result;
+void PathCache_init(PathCache* self, int maxPathLength) {
+  int i;
 
-    // add end node
-    *result = current->nodeID;
-    state->resultSize++;
-    result++;
+  self->maxPathLength = maxPathLength;
+  self->results = (int*)malloc(PATH_CACHE_SIZE * maxPathLength * sizeof(int));
+  invariant(self->results);
+  // entries start out stale, as the generation starts at 1
+  for (i = 0; i < PATH_CACHE_SIZE; i++) {
+    self->entries[i].start = -1;
+    self->entries[i].end = -1;
+    self->entries[i].generation = 0;
+    self->entries[i].lastUsed = 0;
+    self->entries[i].found = FALSE;
+    self->entries[i].result = self->results + i * maxPathLength;
+    self->entries[i].resultSize = 0;
+  }
+  self->generation = 1;
+  self->useCounter = 0;
+  self->hits = 0;
+  self->misses = 0;
+}
+
+void PathCache_destroy(PathCache* self) {
+  free(self->results);
+  self->results = NULL;
+}
 
-    // Work back along the path, accumulating edges.
-    while (current->reachedViaNode != NULL) {
-      current = Path_getNodeState(state, current->reachedViaNode->id);
-      // add node
-      *result = current->nodeID;
-      state->resultSize++;
-      result++;
+void PathCache_invalidate(PathCache* self) {
+  self->generation++;
+}
+
+// the cached search from start to end, or NULL if it needs doing
+PathCacheEntry* PathCache_find(PathCache* self, int start, int end) {
+  int i;
+  PathCacheEntry* entry;
+
+  for (i = 0, entry = self->entries; i < PATH_CACHE_SIZE; i++, entry++) {
+    if (entry->generation == self->generation && entry->start == start &&
+        entry->end == end) {
+      entry->lastUsed = ++self->useCounter;
+      self->hits++;
+      return entry;
     }
+  }
+  self->misses++;
+  return NULL;
+}
 
-    Path_reverse(state);
+// stores the result of a search, replacing a stale entry if there is one, or
+// else the least recently used one
+PathCacheEntry* PathCache_add(PathCache* self,
+                              int start,
+                              int end,
+                              int found,
+                              int* result,
+                              int resultSize) {
+  int i;
+  PathCacheEntry* entry;
+  PathCacheEntry* replaced;
+
+  invariant(resultSize <= self->maxPathLength);
+  replaced = self->entries;
+  for (i = 0, entry = self->entries; i < PATH_CACHE_SIZE; i++, entry++) {
+    if (entry->generation != self->generation) {
+      replaced = entry;
+      break;
+    }
+    if (entry->lastUsed < replaced->lastUsed) {
+      replaced = entry;
+    }
+  }
 
-    // path is in state->result
-    return TRUE;
+  replaced->start = start;
+  replaced->end = end;
+  replaced->generation = self->generation;
+  replaced->lastUsed = ++self->useCounter;
+  replaced->found = found;
+  replaced->resultSize = found ? resultSize : 0;
+  for (i = 0; i < replaced->resultSize; i++) {
+    replaced->result[i] = result[i];
   }
+  return replaced;
+}
+
+static int PathNodeGrid_getCell(float unitsPos,
+                                float unitsMin,
+                                float cellSize,
+                                int cells) {
+  int cell;
+
+  cell = floorf((unitsPos - unitsMin) / cellSize);
+  return CLAMP(cell, 0, cells - 1);
+}
+
+void PathNodeGrid_init(PathNodeGrid* self, Graph* graph) {
+  int i, cell, cellsCount, cellsPerSide;
+  float maxX, maxZ;
+  Node* node;
+
+  invariant(graph->size > 0);
+  self->graph = graph;
+  self->minX = self->minZ = FLT_MAX;
+  maxX = maxZ = -FLT_MAX;
+  for (i = 0, node = graph->nodes; i < graph->size; i++, node++) {
+    self->minX = MIN(self->minX, node->position.x);
+    self->minZ = MIN(self->minZ, node->position.z);
+    maxX = MAX(maxX, node->position.x);
+    maxZ = MAX(maxZ, node->position.z);
+  }
+  cellsPerSide =
+      ceilf(sqrtf((float)graph->size / PATH_NODE_GRID_NODES_PER_CELL));
+  self->cellSize =
+      MAX(MAX(maxX - self->minX, maxZ - self->minZ) / cellsPerSide, 1.0f);
+  self->cellsX = (int)((maxX - self->minX) / self->cellSize) + 1;
+  self->cellsZ = (int)((maxZ - self->minZ) / self->cellSize) + 1;
+  cellsCount = self->cellsX * self->cellsZ;
+
+  self->cellStarts =
+      (int*)malloc((cellsCount + 1 + graph->size * 2) * sizeof(int));
+  self->candidateDistances = (float*)malloc(graph->size * sizeof(float));
+  invariant(self->cellStarts && self->candidateDistances);
+  self->cellNodes = self->cellStarts + cellsCount + 1;
+  self->candidates = self->cellNodes + graph->size;
+
+  // counting sort of the nodes by cell. cellStarts[cell] is moved along to
+  // the end of the cell as its nodes are added, then everything is shifted
+  // back by one cell
+  for (i = 0; i <= cellsCount; i++) {
+    self->cellStarts[i] = 0;
+  }
+  for (i = 0, node = graph->nodes; i < graph->size; i++, node++) {
+    cell = PathNodeGrid_getCell(node->position.z, self->minZ, self->cellSize,
+                                self->cellsZ) *
+               self->cellsX +
+           PathNodeGrid_getCell(node->position.x, self->minX, self->cellSize,
+                                self->cellsX);
+    self->cellStarts[cell + 1]++;
+  }
+  for (i = 1; i <= cellsCount; i++) {
+    self->cellStarts[i] += self->cellStarts[i - 1];
+  }
+  for (i = 0, node = graph->nodes; i < graph->size; i++, node++) {
+    cell = PathNodeGrid_getCell(node->position.z, self->minZ, self->cellSize,
+                                self->cellsZ) *
+               self->cellsX +
+           PathNodeGrid_getCell(node->position.x, self->minX, self->cellSize,
+                                self->cellsX);
+    self->cellNodes[self->cellStarts[cell]++] = i;
+  }
+  for (i = cellsCount; i > 0; i--) {
+    self->cellStarts[i] = self->cellStarts[i - 1];
+  }
+  self->cellStarts[0] = 0;
+}
+
+void PathNodeGrid_destroy(PathNodeGrid* self) {
+  free(self->cellStarts);
+  free(self->candidateDistances);
+  self->cellStarts = NULL;
+  self->candidateDistances = NULL;
+}
+
+// the closest any node outside of the ring of cells around cellX, cellZ could
+// be to the position
+static float PathNodeGrid_getDistanceOutsideRing(PathNodeGrid* self,
+                                                 Vec3d* position,
+                                                 int cellX,
+                                                 int cellZ,
+                                                 int ring) {
+  float distance;
+
+  distance = FLT_MAX;
+  if (cellX - ring > 0) {
+    distance = MIN(distance, position->x - (self->minX + (cellX - ring) *
+                                                             self->cellSize));
+  }
+  if (cellX + ring < self->cellsX - 1) {
+    distance = MIN(distance, self->minX + (cellX + ring + 1) * self->cellSize -
+                                 position->x);
+  }
+  if (cellZ - ring > 0) {
+    distance = MIN(distance, position->z - (self->minZ + (cellZ - ring) *
+                                                             self->cellSize));
+  }
+  if (cellZ + ring < self->cellsZ - 1) {
+    distance = MIN(distance, self->minZ + (cellZ + ring + 1) * self->cellSize -
+                                 position->z);
+  }
+  // allow for rounding when the nodes near the cell edges were filed
+  return distance == FLT_MAX ? distance : distance - 0.01f;
+}
+
+// adds a node to the candidates, keeping them sorted by distance and then id,
+// so the results are the same as Path_quantizePosition()
+static int PathNodeGrid_addCandidate(PathNodeGrid* self,
+                                     int candidatesCount,
+                                     int maxCandidates,
+                                     int nodeID,
+                                     float distance) {
+  int i;
+
+  i = candidatesCount;
+  if (candidatesCount == maxCandidates) {
+    // full, so the furthest candidate is dropped
+    if (distance >= self->candidateDistances[candidatesCount - 1]) {
+      return candidatesCount;
+    }
+    i--;
+  } else {
+    candidatesCount++;
+  }
+  // nodes are visited by cell, so an equally distant node can have a lower id
+  while (i > 0 && (distance < self->candidateDistances[i - 1] ||
+                   (distance == self->candidateDistances[i - 1] &&
+                    nodeID < self->candidates[i - 1]))) {
+    self->candidates[i] = self->candidates[i - 1];
+    self->candidateDistances[i] = self->candidateDistances[i - 1];
+    i--;
+  }
+  self->candidates[i] = nodeID;
+  self->candidateDistances[i] = distance;
+  return candidatesCount;
+}
+
+// finds up to maxResults nodes closest to the position, nearest first. if
+// there's a filter, it's called for nodes in order of distance until enough
+// have been accepted, and nodes it rejects are left out. searches rings of
+// cells outwards from the position's cell, until no node further out could be
+// closer than the nodes found
+int PathNodeGrid_getNearest(PathNodeGrid* self,
+                            Vec3d* position,
+                            int maxResults,
+                            PathNodeFilter filter,
+                            void* filterContext,
+                            int* results) {
+  int cellX, cellZ, ring, lastRing, x, z, i, cell, nodeID;
+  int candidatesCount, maxCandidates, tested, resultsCount;
+  float distanceOutsideRing;
+  Node* node;
+
+  cellX = PathNodeGrid_getCell(position->x, self->minX, self->cellSize,
+                               self->cellsX);
+  cellZ = PathNodeGrid_getCell(position->z, self->minZ, self->cellSize,
+                               self->cellsZ);
+  lastRing = MAX(MAX(cellX, self->cellsX - 1 - cellX),
+                 MAX(cellZ, self->cellsZ - 1 - cellZ));
+  // without a filter, only the closest maxResults nodes can be in the results
+  maxCandidates =
+      filter ? self->graph->size : MIN(maxResults, self->graph->size);
+  candidatesCount = 0;
+  tested = 0;
+  resultsCount = 0;
+
+  for (ring = 0; ring <= lastRing && resultsCount < maxResults; ring++) {
+    for (z = MAX(cellZ - ring, 0); z <= MIN(cellZ + ring, self->cellsZ - 1);
+         z++) {
+      for (x = MAX(cellX - ring, 0); x <= MIN(cellX + ring, self->cellsX - 1);
+           x++) {
+        // inside the ring only the cells on its edge are new
+        if (z != cellZ - ring && z != cellZ + ring && x != cellX - ring &&
+            x != cellX + ring) {
+          x = cellX + ring - 1;
+          continue;
+        }
+        cell = z * self->cellsX + x;
+        for (i = self->cellStarts[cell]; i < self->cellStarts[cell + 1]; i++) {
+          nodeID = self->cellNodes[i];
+          node = Path_getNodeByID(self->graph, nodeID);
+          candidatesCount = PathNodeGrid_addCandidate(
+              self, candidatesCount, maxCandidates, nodeID,
+              Vec3d_distanceTo(position, &node->position));
+        }
+      }
+    }
+
+    // candidates closer than any node outside the ring are in their final
+    // order, so can be tested
+    distanceOutsideRing =
+        PathNodeGrid_getDistanceOutsideRing(self, position, cellX, cellZ, ring);
+    while (tested < candidatesCount &&
+           self->candidateDistances[tested] < distanceOutsideRing &&
+           resultsCount < maxResults) {
+      nodeID = self->candidates[tested];
+      tested++;
+      if (!filter || filter(Path_getNodeByID(self->graph, nodeID), position,
+                            filterContext)) {
+        results[resultsCount] = nodeID;
+        resultsCount++;
+      }
+    }
+  }
+  return resultsCount;
+}
+
+// the same node as Path_quantizePosition()
+int PathNodeGrid_quantizePosition(PathNodeGrid* self, Vec3d* position) {
+  int nodeID;
+
+  PathNodeGrid_getNearest(self, position, 1, NULL, NULL, &nodeID);
+  return nodeID;
 }
@@ -4,6 +4,16 @@
 #ifndef _PATHFINDING_H_
 #define _PATHFINDING_H_
 
+#define PATH_CACHE_SIZE 16
+// graphs with up to this many nodes are exported with a next hop table, which
+// is size * size bytes, and paths are looked up in it instead of searched for.
+// node ids need to fit in the table's bytes, so it must be below 255
+#define PATH_NEXT_HOP_TABLE_MAX_NODES 64
+#define PATH_NO_NEXT_HOP 0xff
+#define PATH_NODE_GRID_NODES_PER_CELL 2
+// for Path_continueAStar(), to search until it's done
+#define PATH_NO_EXPANSION_LIMIT -1
+
 typedef enum NodeStateCategory {
   ClosedNodeStateCategory,
   OpenNodeStateCategory,
@@ -11,6 +21,13 @@ typedef enum NodeStateCategory {
   MAX_A_STAR_NODE_CATEGORY
 } NodeStateCategory;
 
+typedef enum PathSearchStatus {
+  PathSearchInProgress,
+  PathSearchFound,
+  PathSearchFailed,
+  MAX_PATH_SEARCH_STATUS
+} PathSearchStatus;
+
 typedef struct Node {
   int id;
   Vec3d position;
@@ -27,6 +44,10 @@ typedef struct Graph {
   Node* nodes;
   // array indexed by id of EdgeLists
   EdgeList* edges;
+  // for small graphs, the next node along the shortest path from each node to
+  // each other node, at [from * size + to], or PATH_NO_NEXT_HOP if there's no
+  // path. NULL if the graph is searched with A*
+  unsigned char* nextHops;
 } Graph;
 
 typedef struct NodeState {
@@ -36,18 +57,74 @@ typedef struct NodeState {
   float costSoFar;
   float estimatedTotalCost;
   NodeStateCategory category;
+  int openListIndex;  // where the node is in the open list, while it's open
 } NodeState;
 
+// the open list is a binary heap of node ids, ordered by estimatedTotalCost
+// (then by id, so ties are broken the same way as scanning the nodes in order).
+// it's nodeStateSize long and provided by the caller like the other arrays, so
+// pathfinding doesn't allocate. if it's NULL the open node with the smallest
+// cost is found by scanning every node state, which is O(V^2) overall.
+// a search can be done a few nodes at a time with Path_continueAStar(), in
+// which case the state holds everything needed to pick it up again
 typedef struct PathfindingState {
   Node* start;
   Node* end;
   NodeState* nodeStates;
   int nodeStateSize;
   int open;
+  int* openList;
   int* result;
   int resultSize;
+  int expanded;  // nodes the search has expanded so far
 } PathfindingState;
 
+// a path found between two nodes, or the lack of one
+typedef struct PathCacheEntry {
+  int start;  // node ids
+  int end;
+  unsigned int generation;  // of the cache when the search was done
+  unsigned int lastUsed;
+  int found;
+  int* result;
+  int resultSize;
+} PathCacheEntry;
+
+// the results of recent searches, keyed by start and end node, so characters
+// going back and forth between the same places don't search again. when it's
+// full the least recently used entry is replaced. invalidating the cache (eg.
+// when the graph changes) bumps the generation, which makes every entry stale
+typedef struct PathCache {
+  PathCacheEntry entries[PATH_CACHE_SIZE];
+  int* results;  // PATH_CACHE_SIZE paths of maxPathLength nodes
+  int maxPathLength;
+  unsigned int generation;
+  unsigned int useCounter;
+  int hits;
+  int misses;
+} PathCache;
+
+// whether a node is acceptable as the result of a nearest node query
+typedef int (*PathNodeFilter)(Node* node, Vec3d* position, void* context);
+
+// uniform grid on the x,z plane over a graph's nodes, for finding the nodes
+// nearest to a position without measuring the distance to every node. the
+// nodes don't move, so it's built once when the graph is loaded, with about
+// PATH_NODE_GRID_NODES_PER_CELL nodes in each cell
+typedef struct PathNodeGrid {
+  Graph* graph;
+  float minX;
+  float minZ;
+  float cellSize;
+  int cellsX;
+  int cellsZ;
+  int* cellStarts;  // where each cell's nodes start in cellNodes, plus the end
+  int* cellNodes;   // node ids, sorted by cell and then id
+  // scratch, graph size long. nodes found so far, nearest first
+  int* candidates;
+  float* candidateDistances;
+} PathNodeGrid;
+
 EdgeList* Path_getNodeEdgesByID(Graph* graph, int nodeID);
 
 Node* Path_getNodeByID(Graph* graph, int nodeID);
@@ -55,6 +132,14 @@ Node* Path_getNodeByID(Graph* graph, int nodeID);
 int Path_quantizePosition(Graph* graph, Vec3d* position);
 
 int Path_findAStar(Graph* graph, PathfindingState* state);
+void Path_startAStar(Graph* graph, PathfindingState* state);
+PathSearchStatus Path_continueAStar(Graph* graph,
+                                    PathfindingState* state,
+                                    int maxExpansions);
+
+void Path_buildNextHopTable(Graph* graph,
+                            float* costs,
+                            unsigned char* nextHops);
 
 void Path_initState(Graph* graph,
                     PathfindingState* state,
@@ -62,10 +147,32 @@ void Path_initState(Graph* graph,
                     Node* end,
                     NodeState* nodeStates,
                     int nodeStateSize,
+                    int* openList,
                     int* result);
 
 float Path_getClosestPointParameter(Vec3d* segmentPoint0,
                                     Vec3d* segmentPoint1,
                                     Vec3d* point);
 
+void PathNodeGrid_init(PathNodeGrid* self, Graph* graph);
+void PathNodeGrid_destroy(PathNodeGrid* self);
+int PathNodeGrid_getNearest(PathNodeGrid* self,
+                            Vec3d* position,
+                            int maxResults,
+                            PathNodeFilter filter,
+                            void* filterContext,
+                            int* results);
+int PathNodeGrid_quantizePosition(PathNodeGrid* self, Vec3d* position);
+
+void PathCache_init(PathCache* self, int maxPathLength);
+void PathCache_destroy(PathCache* self);
+void PathCache_invalidate(PathCache* self);
+PathCacheEntry* PathCache_find(PathCache* self, int start, int end);
+PathCacheEntry* PathCache_add(PathCache* self,
+                              int start,
+                              int end,
+                              int found,
+                              int* result,
+                              int resultSize);
+
 #endif /* !_PATHFINDING_H_ */
@@ -1,7 +1,12 @@
+#include <assert.h>
 
 #include <math.h>
 #include <stdlib.h>
 
+#ifndef __N64__
+#include <pthread.h>
+#endif
+
 #include "collision.h"
 #include "constants.h"
 #include "physics.h"
@@ -13,7 +18,65 @@
 #define PHYSICS_MOTION_DAMPENING 0
 #define PHYSICS_USE_VERLET_INTEGRATION 0
 #define PHYS_MAX_COLLISION_ITERATIONS 10
+// most world triangles resolved at once for a body
+#define PHYS_MAX_CONTACTS 16
+#define PHYS_CONTACT_SOLVER_ITERATIONS 8
+// the solver stops when no contact is penetrating by more than this
+#define PHYS_CONTACT_SOLVER_TOLERANCE 0.0001
+// with continuous collision, bodies moving less than this fraction of their
+// radius in a step aren't swept. the discrete collision response can't push
+// them out the wrong side of a surface
+#define PHYS_CCD_MIN_MOTION 0.5
+// how many times a swept body can hit something and slide along it in a step
+#define PHYS_CCD_MAX_SWEEPS 4
 #define PHYS_DEBUG_PRINT_COLLISIONS 0
+// bodies moving slower than this (units per second) for PHYS_SLEEP_STEPS
+// steps in a row go to sleep
+#define PHYS_SLEEP_SPEED 2.0
+#define PHYS_SLEEP_STEPS 30
+// a sleeping body must be moved at least this far to wake it. the game copies
+// object positions onto bodies every frame, which adds rounding error
+#define PHYS_WAKE_MIN_TRANSLATION 0.01
+// slack added to the broadphase search window, to cover float rounding
+#define PHYS_BROADPHASE_MARGIN 1.0
+// with fewer awake bodies than this, world collision isn't worth splitting
+// between worker threads
+#define PHYS_WORKERS_MIN_BODIES 64
+// bodies a worker takes at a time
+#define PHYS_WORKERS_CHUNK_SIZE 16
+// bodies are grouped into squares of this many spatial hash cells a side, and
+// nearby groups handed to the same worker, so each worker's bodies query
+// nearby triangles
+#define PHYS_WORKERS_REGION_CELLS 4
+// the arrays in a PhysWorld. 8 vectors and 3 floats for each body, and flags
+#define PHYS_WORLD_VEC3D_ARRAYS 8
+#define PHYS_WORLD_FLOAT_ARRAYS 3
+// the arrays are padded to a multiple of this many bodies, so passes over
+// them can run whole vectors at a time. padding is disabled bodies
+#define PHYS_WORLD_LANES 4
+#define PHYS_WORLD_PADDED(count) \
+  (((count) + PHYS_WORLD_LANES - 1) & ~(PHYS_WORLD_LANES - 1))
+// GCC can't tell the arrays don't overlap, so it needs telling, or it won't
+// vectorize passes over them
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__N64__)
+#define PHYS_WORLD_IVDEP 1
+#else
+#define PHYS_WORLD_IVDEP 0
+#endif
+
+// one body's entry in one of its world's arrays, eg. PHYS_BODY(body, mass) or
+// PHYS_BODY(body, position.y)
+#define PHYS_BODY(body, array) ((body)->world->array[(body)->index])
+
+// a float's bits. the passes over the world choose between results by masking
+// these, as GCC won't vectorize a loop which chooses between floats with ?:
+typedef union PhysFloatBits {
+  float f;
+  int i;
+} PhysFloatBits;
+
+// a where the mask bits are set, b where they're not
+#define PHYS_SELECT(mask, a, b) (((a) & (mask)) | ((b) & ~(mask)))
 
 void PhysState_init(PhysState* self, PhysWorldData* worldData) {
   self->accumulatedTime = 0.0;
@@ -21,45 +84,254 @@ void PhysState_init(PhysState* self, PhysWorldData* worldData) {
   self->simulationRate = 1.0;
   self->timeScale = 1.0;
   self->dynamicTimestep = TRUE;
+  self->continuousCollision = FALSE;
   self->worldData = worldData;
+  // set up by PhysBroadphase_init()
+  self->broadphase.capacity = 0;
+  // set up by PhysState_startWorkers()
+  self->workers = NULL;
+  PhysCollisionStats_init(&self->totalCollisionStats);
+
+  // precompute per-triangle collision data once, rather than every query
+  CollisionMesh_build(worldData->worldMesh);
+  if (worldData->worldMeshSpatialHash->queryContext) {
+    SpatialHashQueryContext_init(
+        worldData->worldMeshSpatialHash->queryContext,
+        worldData->worldMeshSpatialHash->queryContext->visitedEpochs,
+        worldData->worldMeshSpatialHash->queryContext->visitedEpochsSize);
+  }
+  if (worldData->worldMeshBVH) {
+    CollisionBVH_build(worldData->worldMeshBVH,
+                       worldData->worldMesh->triangles,
+                       worldData->worldMesh->trianglesLength);
+  }
 }
 
+void PhysBroadphase_init(PhysBroadphase* self, int capacity) {
+  void* buffer;
+
+  self->capacity = capacity;
+  // about half the buckets will be empty, which keeps hash collisions rare
+  self->bucketsCount = 1;
+  while (self->bucketsCount < capacity * 2) {
+    self->bucketsCount *= 2;
+  }
+  self->cellSize = 1.0;
+  buffer = malloc((self->bucketsCount + capacity * 4) * sizeof(int));
+  invariant(buffer);
+  self->buckets = (int*)buffer;
+  self->next = self->buckets + self->bucketsCount;
+  self->prev = self->next + capacity;
+  self->bodyBuckets = self->prev + capacity;
+  self->candidates = self->bodyBuckets + capacity;
+}
+
+void PhysBroadphase_destroy(PhysBroadphase* self) {
+  if (self->capacity) {
+    free(self->buckets);
+  }
+  self->capacity = 0;
+}
+
+void PhysVec3dArray_init(PhysVec3dArray* self, float* buffer, int capacity) {
+  self->x = buffer;
+  self->y = buffer + capacity;
+  self->z = buffer + capacity * 2;
+}
+
+void PhysWorld_init(PhysWorld* self, int capacity) {
+  float* buffer;
+  PhysVec3dArray* arrays[PHYS_WORLD_VEC3D_ARRAYS];
+  float** floatArrays[PHYS_WORLD_FLOAT_ARRAYS];
+  int i, floatsCount;
+
+  self->capacity = capacity;
+  self->count = 0;
+  // room for the padding too
+  capacity = PHYS_WORLD_PADDED(capacity);
+  floatsCount =
+      (PHYS_WORLD_VEC3D_ARRAYS * 3 + PHYS_WORLD_FLOAT_ARRAYS) * capacity;
+  self->bufferSize = floatsCount * sizeof(float) + capacity * sizeof(int);
+  self->buffer = malloc(MAX(self->bufferSize, 1));
+  invariant(self->buffer);
+
+  arrays[0] = &self->prevPosition;
+  arrays[1] = &self->position;
+  arrays[2] = &self->prevStepPosition;
+  arrays[3] = &self->velocity;
+  arrays[4] = &self->nonIntegralVelocity;
+  arrays[5] = &self->acceleration;
+  arrays[6] = &self->nonIntegralAcceleration;
+  arrays[7] = &self->prevAcceleration;
+  floatArrays[0] = &self->mass;
+  floatArrays[1] = &self->massInverse;
+  floatArrays[2] = &self->radius;
+  buffer = (float*)self->buffer;
+  for (i = 0; i < PHYS_WORLD_VEC3D_ARRAYS; i++) {
+    PhysVec3dArray_init(arrays[i], buffer, capacity);
+    buffer += capacity * 3;
+  }
+  for (i = 0; i < PHYS_WORLD_FLOAT_ARRAYS; i++) {
+    *floatArrays[i] = buffer;
+    buffer += capacity;
+  }
+  self->flags = (int*)buffer;
+
+  // so the passes over the padding don't work with uninitialized floats
+  for (i = 0, buffer = (float*)self->buffer; i < floatsCount; i++) {
+    buffer[i] = 0.0;
+  }
+  for (i = 0; i < capacity; i++) {
+    self->flags[i] = 0;
+  }
+}
+
+void PhysWorld_destroy(PhysWorld* self) {
+  free(self->buffer);
+  self->buffer = NULL;
+  self->capacity = 0;
+  self->count = 0;
+}
+
+void PhysVec3dArray_get(PhysVec3dArray* self, int index, Vec3d* result) {
+  result->x = self->x[index];
+  result->y = self->y[index];
+  result->z = self->z[index];
+}
+
+void PhysVec3dArray_set(PhysVec3dArray* self, int index, Vec3d* value) {
+  self->x[index] = value->x;
+  self->y[index] = value->y;
+  self->z[index] = value->z;
+}
+
+void PhysVec3dArray_origin(PhysVec3dArray* self, int index) {
+  self->x[index] = 0.0;
+  self->y[index] = 0.0;
+  self->z[index] = 0.0;
+}
+
+void PhysVec3dArray_add(PhysVec3dArray* self, int index, Vec3d* value) {
+  self->x[index] += value->x;
+  self->y[index] += value->y;
+  self->z[index] += value->z;
+}
+
+void PhysVec3dArray_copy(PhysVec3dArray* self,
+                         PhysVec3dArray* from,
+                         int index) {
+  self->x[index] = from->x[index];
+  self->y[index] = from->y[index];
+  self->z[index] = from->z[index];
+}
+
+// adds the body to the end of the world's arrays
 void PhysBody_init(PhysBody* self,
+                   PhysWorld* world,
                    float mass,
                    float radius,
                    Vec3d* position,
                    int id) {
+  int index;
+
+  invariant(world->count < world->capacity);
+  index = world->count++;
+  self->world = world;
+  self->index = index;
   self->id = id;
-  self->mass = mass;
-  self->massInverse = 1.0 / mass;
-  self->radius = radius;
+  world->mass[index] = mass;
+  world->massInverse[index] = 1.0 / mass;
+  world->radius[index] = radius;
+  world->flags[index] = PHYS_BODY_ENABLED;
   self->radiusSquared = radius * radius;
   self->restitution = 1.0;
-  self->enabled = TRUE;
-  self->position = *position;
-  self->prevPosition = *position;
-  Vec3d_origin(&self->velocity);
-  Vec3d_origin(&self->nonIntegralVelocity);
-  Vec3d_origin(&self->acceleration);
-  Vec3d_origin(&self->nonIntegralAcceleration);
-  Vec3d_origin(&self->prevAcceleration);
+  self->controlled = FALSE;
+  self->stillSteps = 0;
+  self->sleepPosition = *position;
+  self->moved = FALSE;
+  PhysVec3dArray_set(&world->position, index, position);
+  PhysVec3dArray_set(&world->prevPosition, index, position);
+  PhysVec3dArray_set(&world->prevStepPosition, index, position);
+  PhysVec3dArray_origin(&world->velocity, index);
+  PhysVec3dArray_origin(&world->nonIntegralVelocity, index);
+  PhysVec3dArray_origin(&world->acceleration, index);
+  PhysVec3dArray_origin(&world->nonIntegralAcceleration, index);
+  PhysVec3dArray_origin(&world->prevAcceleration, index);
+  CollisionCandidateCache_init(&self->worldCandidates);
+}
+
+void PhysBody_getPosition(PhysBody* body, Vec3d* result) {
+  PhysVec3dArray_get(&body->world->position, body->index, result);
+}
+
+void PhysBody_setPosition(PhysBody* body, Vec3d* position) {
+  PhysVec3dArray_set(&body->world->position, body->index, position);
+}
+
+void PhysBody_getPrevPosition(PhysBody* body, Vec3d* result) {
+  PhysVec3dArray_get(&body->world->prevPosition, body->index, result);
+}
+
+void PhysBody_getPrevStepPosition(PhysBody* body, Vec3d* result) {
+  PhysVec3dArray_get(&body->world->prevStepPosition, body->index, result);
+}
+
+void PhysBody_getVelocity(PhysBody* body, Vec3d* result) {
+  PhysVec3dArray_get(&body->world->velocity, body->index, result);
+}
+
+void PhysBody_getNonIntegralVelocity(PhysBody* body, Vec3d* result) {
+  PhysVec3dArray_get(&body->world->nonIntegralVelocity, body->index, result);
+}
+
+void PhysBody_setNonIntegralVelocity(PhysBody* body, Vec3d* velocity) {
+  PhysVec3dArray_set(&body->world->nonIntegralVelocity, body->index,
+                     velocity);
+}
+
+void PhysBody_getAcceleration(PhysBody* body, Vec3d* result) {
+  PhysVec3dArray_get(&body->world->acceleration, body->index, result);
+}
+
+void PhysBody_getNonIntegralAcceleration(PhysBody* body, Vec3d* result) {
+  PhysVec3dArray_get(&body->world->nonIntegralAcceleration, body->index,
+                     result);
+}
+
+float PhysBody_getRadius(PhysBody* body) {
+  return PHYS_BODY(body, radius);
+}
+
+int PhysBody_isEnabled(PhysBody* body) {
+  return (PHYS_BODY(body, flags) & PHYS_BODY_ENABLED) != 0;
+}
+
+int PhysBody_isSleeping(PhysBody* body) {
+  return (PHYS_BODY(body, flags) & PHYS_BODY_SLEEPING) != 0;
+}
+
+// enabled and not sleeping
+int PhysBody_isAwake(PhysBody* body) {
+  return (PHYS_BODY(body, flags) & (PHYS_BODY_ENABLED | PHYS_BODY_SLEEPING)) ==
+         PHYS_BODY_ENABLED;
 }
 
 void PhysBehavior_floorBounce(PhysBody* body, float floorHeight) {
   float opposite;
   Vec3d response;
 
-  opposite = (-1.0) * body->mass;
-  if (body->position.y - body->radius < floorHeight) {
-    body->position.y = floorHeight + body->radius;
-    Vec3d_init(&response, 0.0, body->nonIntegralVelocity.y * opposite, 0.0);
-    Vec3d_add(&body->acceleration, &response);
+  opposite = (-1.0) * PHYS_BODY(body, mass);
+  if (PHYS_BODY(body, position.y) - PHYS_BODY(body, radius) < floorHeight) {
+    PHYS_BODY(body, position.y) = floorHeight + PHYS_BODY(body, radius);
+    Vec3d_init(&response, 0.0,
+               PHYS_BODY(body, nonIntegralVelocity.y) * opposite, 0.0);
+    PhysVec3dArray_add(&body->world->acceleration, body->index, &response);
   }
 }
 
 void PhysBehavior_floorClamp(PhysBody* body, float floorHeight) {
-  if (body->position.y - body->radius < floorHeight) {
-    body->position.y = floorHeight + body->radius;
+  if (PHYS_BODY(body, position.y) - PHYS_BODY(body, radius) < floorHeight) {
+    PHYS_BODY(body, position.y) = floorHeight + PHYS_BODY(body, radius);
   }
 }
 
@@ -69,11 +341,11 @@ void PhysBehavior_waterBuoyancy(PhysBody* body,
   Vec3d response;
   // float maxDepth = -58.0;
 
-  if (body->position.y < waterHeight) {
+  if (PHYS_BODY(body, position.y) < waterHeight) {
     // float buoyancyRatio = CLAMP(
     //     (body->position.y - waterHeight) / (maxDepth - waterHeight), -2.0,
     //     0.0);
-    body->position.y = waterHeight;
+    PHYS_BODY(body, position.y) = waterHeight;
     Vec3d_init(&response, 0.0,
                -gravity->y,  // gravity->y * buoyancyRatio
                0.0);
@@ -81,18 +353,138 @@ void PhysBehavior_waterBuoyancy(PhysBody* body,
   }
 }
 
+// the body's cached world triangles covering its motion from sweptStart to
+// sweptEnd, or NULL if the cache can't be used
+CollisionCandidateCache* PhysBehavior_getCachedWorldCandidates(
+    PhysBody* body,
+    PhysWorldData* world,
+    Vec3d* sweptStart,
+    Vec3d* sweptEnd,
+    PhysCollisionStats* stats) {
+  CollisionCandidateCache* candidates;
+  float profStartCandidates;
+
+  if (world->worldMeshBVH) {
+    return NULL;
+  }
+  candidates = &body->worldCandidates;
+  profStartCandidates = CUR_TIME_MS();
+  if (CollisionCandidateCache_update(candidates, sweptStart, sweptEnd,
+                                     PHYS_BODY(body, radius),
+                                     world->worldMeshSpatialHash)) {
+    stats->candidateCacheHits++;
+  } else {
+    // this can run on a worker thread, so the time goes in the stats rather
+    // than the trace buffer
+    stats->candidateCacheMisses++;
+    stats->candidateCacheMissTime += CUR_TIME_MS() - profStartCandidates;
+  }
+  return candidates->valid ? candidates : NULL;
+}
+
+// finds every world triangle the body penetrates. contacts needs room for
+// PHYS_MAX_CONTACTS
+int PhysBehavior_getWorldContacts(PhysBody* body,
+                                  PhysWorldData* world,
+                                  SphereTriangleCollision* contacts,
+                                  PhysCollisionStats* stats) {
+  CollisionCandidateCache* candidates;
+  int spatialHashResultsCount;
+  int spatialHashResults[COLLISION_SPATIAL_HASH_MAX_RESULTS];
+  Vec3d position, prevPosition;
+  float radius;
+
+  PhysBody_getPosition(body, &position);
+  PhysBody_getPrevPosition(body, &prevPosition);
+  radius = PHYS_BODY(body, radius);
+  candidates = PhysBehavior_getCachedWorldCandidates(
+      body, world, &prevPosition, &position, stats);
+  if (candidates) {
+    return Collision_getMeshSphereContacts(
+        world->worldMesh, &position, radius, candidates->candidates,
+        candidates->candidatesCount, contacts, PHYS_MAX_CONTACTS);
+  }
+  spatialHashResultsCount = Collision_getMeshSphereCandidates(
+      &position, radius, world->worldMeshSpatialHash, world->worldMeshBVH,
+      spatialHashResults);
+  return Collision_getMeshSphereContacts(
+      world->worldMesh, &position, radius, spatialHashResults,
+      spatialHashResultsCount, contacts, PHYS_MAX_CONTACTS);
+}
+
+// how far the body needs to move along the triangle normal to no longer
+// penetrate the triangle
+float PhysBehavior_contactPenetration(PhysBody* body,
+                                      SphereTriangleCollision* contact) {
+  Vec3d position;
+
+  PhysBody_getPosition(body, &position);
+  if (CollisionMesh_comparePoint(contact->triangleData, &position) >= 0) {
+    // center of body is in front of or on face
+    return PHYS_BODY(body, radius) + PHYS_COLLISION_MIN_SEPARATION -
+           contact->distance;
+  }
+  // center of body is behind face
+  return PHYS_BODY(body, radius) + PHYS_COLLISION_MIN_SEPARATION +
+         contact->distance;
+}
+
+// finds a correction which moves the body out of all of the contacts at once,
+// using projected Gauss-Seidel. each contact requires that the correction
+// moves the body at least its penetration along the contact normal, and can
+// only push. returns the number of iterations used
+int PhysBehavior_solveContacts(PhysBody* body,
+                               SphereTriangleCollision* contacts,
+                               int contactsCount,
+                               Vec3d* correction) {
+  int i, k;
+  float penetrations[PHYS_MAX_CONTACTS];
+  float impulses[PHYS_MAX_CONTACTS];
+  float residual, impulse, maxResidual;
+  Vec3d* normal;
+  Vec3d push;
+
+  for (k = 0; k < contactsCount; k++) {
+    penetrations[k] = PhysBehavior_contactPenetration(body, contacts + k);
+    impulses[k] = 0;
+  }
+
+  Vec3d_origin(correction);
+  for (i = 0; i < PHYS_CONTACT_SOLVER_ITERATIONS; i++) {
+    maxResidual = 0;
+    for (k = 0; k < contactsCount; k++) {
+      normal = &contacts[k].triangleData->normal;
+      residual = penetrations[k] - Vec3d_dot(normal, correction);
+      impulse = MAX(impulses[k] + residual, 0);
+      if (impulse != impulses[k]) {
+        push = *normal;
+        Vec3d_mulScalar(&push, impulse - impulses[k]);
+        Vec3d_add(correction, &push);
+        impulses[k] = impulse;
+      }
+      maxResidual = MAX(maxResidual, residual);
+    }
+    if (maxResidual <= PHYS_CONTACT_SOLVER_TOLERANCE) {
+      return i + 1;
+    }
+  }
+  return PHYS_CONTACT_SOLVER_ITERATIONS;
+}
+
 int PhysBehavior_worldCollisionResponseStep(PhysBody* body,
-                                            PhysWorldData* world) {
-  int hasCollision;
-  float distanceToIntersect, responseDistance, bodyInFrontOfTriangle;
-  SphereTriangleCollision collision;
-  Vec3d response, beforePos;
+                                            PhysWorldData* world,
+                                            PhysCollisionStats* stats) {
+  int contactsCount, iterations;
+  SphereTriangleCollision contacts[PHYS_MAX_CONTACTS];
+  Vec3d response;
+#if PHYS_DEBUG_PRINT_COLLISIONS
+  Vec3d beforePos, afterPos;
+#endif
 
-  hasCollision = Collision_testMeshSphereCollision(
-      world->worldMeshTris, world->worldMeshTrisLength, &body->position,
-      body->radius, world->worldMeshSpatialHash, &collision);
+  contactsCount = PhysBehavior_getWorldContacts(body, world, contacts, stats);
+  stats->passes++;
 
-  if (!hasCollision) {
+  if (!contactsCount) {
     return FALSE;
   }
 
@@ -102,39 +494,27 @@ int PhysBehavior_worldCollisionResponseStep(PhysBody* body,
   // }
   debugPrintf("body %d collided\n", body->id);
 #endif
-  distanceToIntersect = collision.distance;
-
-  bodyInFrontOfTriangle =
-      Triangle_comparePoint(collision.triangle, &body->position);
+  stats->contacts += contactsCount;
 
-  // move away by radius
-  Triangle_getNormal(collision.triangle, &response);
+  // move away from all the contacts at once
+  iterations =
+      PhysBehavior_solveContacts(body, contacts, contactsCount, &response);
+  stats->solverIterations += iterations;
 
-  responseDistance = 0;
-
-  if (bodyInFrontOfTriangle >= 0) {
-    // center of body is in front of or on face
-    responseDistance =
-        body->radius + PHYS_COLLISION_MIN_SEPARATION - distanceToIntersect;
-  } else {
-    // center of body is behind face
-    responseDistance =
-        body->radius + PHYS_COLLISION_MIN_SEPARATION + distanceToIntersect;
-  }
-
-  beforePos = body->position;
+#if PHYS_DEBUG_PRINT_COLLISIONS
+  PhysBody_getPosition(body, &beforePos);
+#endif
 #if PHYSICS_USE_VERLET_INTEGRATION
-  Vec3d_mulScalar(&response, responseDistance);
   PhysBody_translateWithoutForce(body, &response);
 #else
-  Vec3d_mulScalar(&response, responseDistance);
   PhysBody_translateWithoutForce(body, &response);
-  Vec3d_origin(&body->nonIntegralVelocity);
+  PhysVec3dArray_origin(&body->world->nonIntegralVelocity, body->index);
   // Vec3d_mulScalar(&response, responseDistance * body->mass);
   // PhysBody_applyForce(body, &response);
 #endif
 
 #if PHYS_DEBUG_PRINT_COLLISIONS
+  PhysBody_getPosition(body, &afterPos);
   if (body->id == 2) {
     printf("player collided with world\n");
   }
@@ -143,16 +523,12 @@ int PhysBehavior_worldCollisionResponseStep(PhysBody* body,
   }
 #ifdef __cplusplus
   printf(
-      "PhysBody id=%d hasCollision tri=%d distanceToIntersect=%f beforePos=%s "
-      "afterPos=%s "
-      "posInTriangle=%s response=%s "
-      "responseDistance=%f bodyInFrontOfTriangle=%f",
-      body->id, collision.index, distanceToIntersect,
+      "PhysBody id=%d hasCollision contacts=%d iterations=%d beforePos=%s "
+      "afterPos=%s response=%s",
+      body->id, contactsCount, iterations,
       Vec3d_toStdString(&beforePos).c_str(),
-      Vec3d_toStdString(&body->position).c_str(),
-      Vec3d_toStdString(&collision.posInTriangle).c_str(),
-      Vec3d_toStdString(&response).c_str(), responseDistance,
-      bodyInFrontOfTriangle
+      Vec3d_toStdString(&afterPos).c_str(),
+      Vec3d_toStdString(&response).c_str()
 
   );
 #endif
@@ -161,6 +537,92 @@ int PhysBehavior_worldCollisionResponseStep(PhysBody* body,
   return TRUE;
 }
 
+// the first world triangle hit by the body moving from start to end
+int PhysBehavior_sweepWorld(PhysBody* body,
+                            PhysWorldData* world,
+                            Vec3d* start,
+                            Vec3d* end,
+                            SphereSweepCollision* hit,
+                            PhysCollisionStats* stats) {
+  CollisionCandidateCache* candidates;
+  int spatialHashResultsCount;
+  int spatialHashResults[COLLISION_SPATIAL_HASH_MAX_RESULTS];
+  float radius;
+
+  radius = PHYS_BODY(body, radius);
+  candidates =
+      PhysBehavior_getCachedWorldCandidates(body, world, start, end, stats);
+  if (candidates) {
+    return Collision_sweepSphereCandidates(
+        world->worldMesh, start, end, radius, candidates->candidates,
+        candidates->candidatesCount, hit);
+  }
+  spatialHashResultsCount = Collision_getSweptSphereCandidates(
+      start, end, radius, world->worldMeshSpatialHash, world->worldMeshBVH,
+      spatialHashResults);
+  return Collision_sweepSphereCandidates(world->worldMesh, start, end, radius,
+                                         spatialHashResults,
+                                         spatialHashResultsCount, hit);
+}
+
+// clamps the body's motion this step (from prevPosition to position) to the
+// first world triangle it would hit, then slides the rest of the motion along
+// that surface, which can hit something else, and so on
+void PhysBehavior_continuousCollisionResponse(PhysBody* body,
+                                              PhysWorldData* world,
+                                              PhysCollisionStats* stats) {
+  int i;
+  float intoSurface;
+  Vec3d start, end, remaining, offset, velocity;
+  SphereSweepCollision hit;
+
+  PhysBody_getPrevPosition(body, &start);
+  PhysBody_getPosition(body, &end);
+  if (Vec3d_distanceToSq(&start, &end) <=
+      body->radiusSquared * PHYS_CCD_MIN_MOTION * PHYS_CCD_MIN_MOTION) {
+    return;
+  }
+
+  for (i = 0; i < PHYS_CCD_MAX_SWEEPS; i++) {
+    if (!PhysBehavior_sweepWorld(body, world, &start, &end, &hit, stats)) {
+      break;
+    }
+    // move up to the contact, leaving a small gap
+    remaining = end;
+    Vec3d_sub(&remaining, &start);
+    offset = remaining;
+    Vec3d_mulScalar(&offset, hit.time);
+    Vec3d_add(&start, &offset);
+    Vec3d_sub(&remaining, &offset);
+    offset = hit.normal;
+    Vec3d_mulScalar(&offset, PHYS_COLLISION_MIN_SEPARATION);
+    Vec3d_add(&start, &offset);
+
+    // the rest of the motion and the velocity lose their component into the
+    // surface
+    intoSurface = Vec3d_dot(&remaining, &hit.normal);
+    offset = hit.normal;
+    Vec3d_mulScalar(&offset, intoSurface);
+    Vec3d_sub(&remaining, &offset);
+    PhysBody_getNonIntegralVelocity(body, &velocity);
+    intoSurface = Vec3d_dot(&velocity, &hit.normal);
+    if (intoSurface < 0) {
+      offset = hit.normal;
+      Vec3d_mulScalar(&offset, intoSurface);
+      Vec3d_sub(&velocity, &offset);
+      PhysBody_setNonIntegralVelocity(body, &velocity);
+    }
+
+    end = start;
+    Vec3d_add(&end, &remaining);
+  }
+  if (i == PHYS_CCD_MAX_SWEEPS) {
+    // still hitting things, so stop at the last contact
+    end = start;
+  }
+  PhysBody_setPosition(body, &end);
+}
+
 void PhysBehavior_collisionSeparationOffset(Vec3d* result,
                                             Vec3d* pos,
                                             float overlap,
@@ -170,138 +632,642 @@ void PhysBehavior_collisionSeparationOffset(Vec3d* result,
   Vec3d_mulScalar(result, overlap * separationForce);
 }
 
+// separates a pair of bodies if they overlap
+int PhysBehavior_bodyPairCollisionResponse(PhysBody* body,
+                                           PhysBody* otherBody) {
+  Vec3d position, delta, collisionSeparationOffset;
+  float distanceSquared, radii, distance, overlap, mt, bodySeparationForce,
+      otherBodySeparationForce;
+
+  if (PhysBody_isSleeping(body) && PhysBody_isSleeping(otherBody)) {
+    return FALSE;
+  }
+
+  PhysBody_getPosition(body, &position);
+  PhysBody_getPosition(otherBody, &delta);
+  Vec3d_sub(&delta, &position);
+  distanceSquared = Vec3d_magSq(&delta);
+  radii = PHYS_BODY(body, radius) + PHYS_BODY(otherBody, radius);
+  if (distanceSquared > radii * radii) {
+    return FALSE;
+  }
+
+  distance = sqrtf(distanceSquared);
+  overlap = radii - distance - 0.5;
+  /* Total mass. */
+  mt = PHYS_BODY(body, mass) + PHYS_BODY(otherBody, mass);
+  /* Distribute collision responses. */
+  bodySeparationForce = PHYS_BODY(otherBody, mass) / mt;
+  otherBodySeparationForce = PHYS_BODY(body, mass) / mt;
+
+  /* Move particles so they no longer overlap.*/
+  PhysBehavior_collisionSeparationOffset(&collisionSeparationOffset, &delta,
+                                         overlap, -bodySeparationForce);
+  PhysVec3dArray_add(&body->world->position, body->index,
+                     &collisionSeparationOffset);
+
+  PhysBehavior_collisionSeparationOffset(&collisionSeparationOffset, &delta,
+                                         overlap, otherBodySeparationForce);
+  PhysVec3dArray_add(&otherBody->world->position, otherBody->index,
+                     &collisionSeparationOffset);
+
+  // contact with an awake body wakes a sleeping one
+  PhysBody_wake(body);
+  PhysBody_wake(otherBody);
+  return TRUE;
+}
+
 int PhysBehavior_bodyBodyCollisionResponse(PhysBody* body,
                                            PhysBody* pool,
                                            int numInPool) {
-  Vec3d delta, direction, collisionSeparationOffset;
   int i, hasCollision;
-  float distanceSquared, radii, distance, overlap, mt, bodySeparationForce,
-      otherBodySeparationForce;
   PhysBody* otherBody;
 
   hasCollision = FALSE;
 
-  Vec3d_origin(&delta);
-  Vec3d_origin(&direction);
-
   for (i = 0, otherBody = pool; i < numInPool; i++, otherBody++) {
-    if (body != otherBody && otherBody->enabled) {
-      Vec3d_copyFrom(&delta, &otherBody->position);
-      Vec3d_sub(&delta, &body->position);
-      distanceSquared = Vec3d_magSq(&delta);
-      Vec3d_copyFrom(&direction, &delta);
-      Vec3d_normalise(&direction);
-      radii = body->radius + otherBody->radius;
-      if (distanceSquared <= radii * radii) {  // collision
-        hasCollision = TRUE;
-
-        distance = sqrtf(distanceSquared);
-        overlap = radii - distance - 0.5;
-        /* Total mass. */
-        mt = body->mass + otherBody->mass;
-        /* Distribute collision responses. */
-        bodySeparationForce = otherBody->mass / mt;
-        otherBodySeparationForce = body->mass / mt;
-
-        /* Move particles so they no longer overlap.*/
-        PhysBehavior_collisionSeparationOffset(
-            &collisionSeparationOffset, &delta, overlap, -bodySeparationForce);
-        Vec3d_add(&body->position, &collisionSeparationOffset);
-
-        PhysBehavior_collisionSeparationOffset(&collisionSeparationOffset,
-                                               &delta, overlap,
-                                               otherBodySeparationForce);
-        Vec3d_add(&otherBody->position, &collisionSeparationOffset);
-      }
+    if (body != otherBody && PhysBody_isEnabled(otherBody)) {
+      hasCollision =
+          PhysBehavior_bodyPairCollisionResponse(body, otherBody) ||
+          hasCollision;
     }
   }
   return hasCollision;
 }
 
-int PhysBehavior_collisionResponseStep(PhysBody* body,
-                                       PhysWorldData* world,
-                                       PhysBody* pool,
-                                       int numInPool) {
-  int hasCollision;
+int PhysBroadphase_getCell(PhysBroadphase* self, float unitsPos) {
+  return floorf(unitsPos / self->cellSize);
+}
 
-  hasCollision = FALSE;
-  hasCollision =
-      hasCollision || PhysBehavior_worldCollisionResponseStep(body, world);
-  return hasCollision;
+int PhysBroadphase_getBucket(PhysBroadphase* self, int cellX, int cellZ) {
+  return (((unsigned int)cellX * 73856093u) ^
+          ((unsigned int)cellZ * 19349663u)) &
+         (self->bucketsCount - 1);
 }
 
-void PhysBehavior_collisionResponse(PhysWorldData* world,
-                                    PhysBody* bodies,
-                                    int numBodies) {
-  int i, k, hasAnyCollision;
+// the bucket for the cell the body's position is in
+int PhysBroadphase_getBodyBucket(PhysBroadphase* self, PhysBody* body) {
+  return PhysBroadphase_getBucket(
+      self, PhysBroadphase_getCell(self, PHYS_BODY(body, position.x)),
+      PhysBroadphase_getCell(self, PHYS_BODY(body, position.z)));
+}
+
+void PhysBroadphase_remove(PhysBroadphase* self, int bodyIndex) {
+  int bucket;
+
+  bucket = self->bodyBuckets[bodyIndex];
+  if (self->prev[bodyIndex] == -1) {
+    self->buckets[bucket] = self->next[bodyIndex];
+  } else {
+    self->next[self->prev[bodyIndex]] = self->next[bodyIndex];
+  }
+  if (self->next[bodyIndex] != -1) {
+    self->prev[self->next[bodyIndex]] = self->prev[bodyIndex];
+  }
+  self->bodyBuckets[bodyIndex] = -1;
+}
+
+void PhysBroadphase_insert(PhysBroadphase* self,
+                           PhysBody* bodies,
+                           int bodyIndex) {
+  int bucket;
+
+  bucket = PhysBroadphase_getBodyBucket(self, bodies + bodyIndex);
+  self->bodyBuckets[bodyIndex] = bucket;
+  self->prev[bodyIndex] = -1;
+  self->next[bodyIndex] = self->buckets[bucket];
+  if (self->buckets[bucket] != -1) {
+    self->prev[self->buckets[bucket]] = bodyIndex;
+  }
+  self->buckets[bucket] = bodyIndex;
+}
+
+// moves a body to the bucket for its current position
+void PhysBroadphase_update(PhysBroadphase* self,
+                           PhysBody* bodies,
+                           int bodyIndex) {
+  if (self->bodyBuckets[bodyIndex] !=
+      PhysBroadphase_getBodyBucket(self, bodies + bodyIndex)) {
+    PhysBroadphase_remove(self, bodyIndex);
+    PhysBroadphase_insert(self, bodies, bodyIndex);
+  }
+}
+
+void PhysBroadphase_build(PhysBroadphase* self,
+                          PhysBody* bodies,
+                          int numBodies) {
+  int i;
+  float maxRadius;
+
+  maxRadius = 0;
+  for (i = 0; i < numBodies; ++i) {
+    if (PhysBody_isEnabled(bodies + i)) {
+      maxRadius = MAX(maxRadius, PHYS_BODY(bodies + i, radius));
+    }
+  }
+  // a body can then only overlap bodies in the 3x3 cells around it
+  self->cellSize = MAX(2 * maxRadius + PHYS_BROADPHASE_MARGIN, 1.0);
+
+  for (i = 0; i < self->bucketsCount; ++i) {
+    self->buckets[i] = -1;
+  }
+  for (i = 0; i < numBodies; ++i) {
+    if (PhysBody_isEnabled(bodies + i)) {
+      PhysBroadphase_insert(self, bodies, i);
+    } else {
+      self->bodyBuckets[i] = -1;
+    }
+  }
+}
+
+// collects the bodies with index greater than afterIndex in the cells within
+// the given rect, sorted by index
+int PhysBroadphase_getCandidates(PhysBroadphase* self,
+                                 int minCellX,
+                                 int minCellZ,
+                                 int maxCellX,
+                                 int maxCellZ,
+                                 int afterIndex) {
+  int cellX, cellZ, bodyIndex, j, insertAt, candidatesCount;
+
+  candidatesCount = 0;
+  for (cellX = minCellX; cellX <= maxCellX; ++cellX) {
+    for (cellZ = minCellZ; cellZ <= maxCellZ; ++cellZ) {
+      for (bodyIndex = self->buckets[PhysBroadphase_getBucket(self, cellX,
+                                                              cellZ)];
+           bodyIndex != -1; bodyIndex = self->next[bodyIndex]) {
+        if (bodyIndex <= afterIndex) {
+          continue;
+        }
+        j = candidatesCount;
+        while (j > 0 && self->candidates[j - 1] > bodyIndex) {
+          j--;
+        }
+        // cells which hash to the same bucket give the same bodies again
+        if (j > 0 && self->candidates[j - 1] == bodyIndex) {
+          continue;
+        }
+        for (insertAt = j, j = candidatesCount; j > insertAt; --j) {
+          self->candidates[j] = self->candidates[j - 1];
+        }
+        self->candidates[insertAt] = bodyIndex;
+        candidatesCount++;
+      }
+    }
+  }
+  return candidatesCount;
+}
+
+// gives the same results as calling PhysBehavior_bodyBodyCollisionResponse()
+// for each body in turn: pairs are resolved in the same order, against the
+// current positions, but only bodies in nearby cells are tested. bodies are
+// moved to their new cells as they're separated, and if the body being tested
+// moves far enough to cover different cells, the rest of its candidates are
+// collected again
+void PhysBehavior_broadphaseCollisionResponse(PhysBroadphase* broadphase,
+                                              PhysBody* bodies,
+                                              int numBodies) {
+  int k, i, otherIndex, candidatesCount, lastIndex, requery;
+  int minCellX, minCellZ, maxCellX, maxCellZ;
+  float window;
   PhysBody* body;
-  float profStartObjCollision;
-  float profStartWorldCollision;
-  // int floorHeight = 0.0;
+  float* positionX;
+  float* positionZ;
+
+  PhysBroadphase_build(broadphase, bodies, numBodies);
 
-  profStartObjCollision = CUR_TIME_MS();
   for (k = 0, body = bodies; k < numBodies; k++, body++) {
-    if (body->enabled) {
+    // sleeping bodies are only separated from awake ones, which test them
+    if (!PhysBody_isAwake(body)) {
+      continue;
+    }
+    positionX = &PHYS_BODY(body, position.x);
+    positionZ = &PHYS_BODY(body, position.z);
+    // no other body is further than this from overlapping
+    window = PHYS_BODY(body, radius) + broadphase->cellSize / 2;
+    lastIndex = -1;
+    do {
+      requery = FALSE;
+      minCellX = PhysBroadphase_getCell(broadphase, *positionX - window);
+      minCellZ = PhysBroadphase_getCell(broadphase, *positionZ - window);
+      maxCellX = PhysBroadphase_getCell(broadphase, *positionX + window);
+      maxCellZ = PhysBroadphase_getCell(broadphase, *positionZ + window);
+      candidatesCount = PhysBroadphase_getCandidates(
+          broadphase, minCellX, minCellZ, maxCellX, maxCellZ, lastIndex);
+      for (i = 0; i < candidatesCount; ++i) {
+        otherIndex = broadphase->candidates[i];
+        lastIndex = otherIndex;
+        if (otherIndex == k ||
+            !PhysBehavior_bodyPairCollisionResponse(body,
+                                                    bodies + otherIndex)) {
+          continue;
+        }
+        PhysBroadphase_update(broadphase, bodies, k);
+        PhysBroadphase_update(broadphase, bodies, otherIndex);
+        if (PhysBroadphase_getCell(broadphase, *positionX - window) !=
+                minCellX ||
+            PhysBroadphase_getCell(broadphase, *positionZ - window) !=
+                minCellZ ||
+            PhysBroadphase_getCell(broadphase, *positionX + window) !=
+                maxCellX ||
+            PhysBroadphase_getCell(broadphase, *positionZ + window) !=
+                maxCellZ) {
+          requery = TRUE;
+          break;
+        }
+      }
+    } while (requery);
+  }
+}
+
+// separates all overlapping bodies, using the broadphase if it has room
+void PhysBehavior_bodiesCollisionResponse(PhysBroadphase* broadphase,
+                                          PhysBody* bodies,
+                                          int numBodies) {
+  int k;
+  PhysBody* body;
+
+  if (broadphase && broadphase->capacity >= numBodies) {
+    PhysBehavior_broadphaseCollisionResponse(broadphase, bodies, numBodies);
+    return;
+  }
+  for (k = 0, body = bodies; k < numBodies; k++, body++) {
+    if (PhysBody_isAwake(body)) {
       // PhysBehavior_floorBounce(body, floorHeight);
       // PhysBehavior_floorClamp(body, floorHeight);
       PhysBehavior_bodyBodyCollisionResponse(body, bodies, numBodies);
     }
   }
-  Trace_addEvent(PhysObjCollisionTraceEvent, profStartObjCollision,
-                 CUR_TIME_MS());
+}
+
+// resolves a body's world collisions. each pass resolves every contact found,
+// but moving out of them can push the body into more triangles, so it runs
+// passes until there are none left
+void PhysBehavior_bodyWorldCollisionResponse(PhysBody* body,
+                                             PhysWorldData* world,
+                                             PhysCollisionStats* stats) {
+  int i, k, contactsCount;
+  SphereTriangleCollision contacts[PHYS_MAX_CONTACTS];
 
-  // run multiple iterations, because the response to a collision can create
-  // another collision
   for (i = 0; i < PHYS_MAX_COLLISION_ITERATIONS; ++i) {
-    hasAnyCollision = FALSE;
-    profStartWorldCollision = CUR_TIME_MS();
-    for (k = 0, body = bodies; k < numBodies; k++, body++) {
-      if (body->enabled) {
-        hasAnyCollision =
-            hasAnyCollision ||
-            PhysBehavior_collisionResponseStep(body, world, bodies, numBodies);
-      }
+    if (!PhysBehavior_worldCollisionResponseStep(body, world, stats)) {
+      return;
     }
-    Trace_addEvent(PhysWorldCollisionTraceEvent, profStartWorldCollision,
-                   CUR_TIME_MS());
-    if (!hasAnyCollision) {
+  }
+
+  // out of passes, so measure what's left
+  contactsCount = PhysBehavior_getWorldContacts(body, world, contacts, stats);
+  if (!contactsCount) {
+    return;
+  }
+  stats->unresolvedBodies++;
+  for (k = 0; k < contactsCount; k++) {
+    stats->maxUnresolvedPenetration =
+        MAX(stats->maxUnresolvedPenetration,
+            PhysBehavior_contactPenetration(body, contacts + k));
+  }
+#ifndef PHYS_DEBUG
+  debugPrintf(
+      "hit PHYS_MAX_COLLISION_ITERATIONS and ended collision response for body "
+      "%d with %d contacts remaining\n",
+      body->id, contactsCount);
+#endif
+}
+
+void PhysCollisionStats_init(PhysCollisionStats* self) {
+  self->passes = 0;
+  self->contacts = 0;
+  self->solverIterations = 0;
+  self->unresolvedBodies = 0;
+  self->maxUnresolvedPenetration = 0;
+  self->candidateCacheHits = 0;
+  self->candidateCacheMisses = 0;
+  self->candidateCacheMissTime = 0;
+}
+
+void PhysCollisionStats_add(PhysCollisionStats* self,
+                            PhysCollisionStats* other) {
+  self->passes += other->passes;
+  self->contacts += other->contacts;
+  self->solverIterations += other->solverIterations;
+  self->unresolvedBodies += other->unresolvedBodies;
+  self->maxUnresolvedPenetration =
+      MAX(self->maxUnresolvedPenetration, other->maxUnresolvedPenetration);
+  self->candidateCacheHits += other->candidateCacheHits;
+  self->candidateCacheMisses += other->candidateCacheMisses;
+  self->candidateCacheMissTime += other->candidateCacheMissTime;
+}
+
+#ifndef __N64__
+// a body's world collision response only reads the world and changes that
+// body, so bodies can be resolved on any thread in any order and get the same
+// result. the only shared state written by a query is the spatial hash's
+// visited triangle stamps, so each worker gets its own copy of the hash
+// header with its own query context
+typedef struct PhysWorker {
+  struct PhysWorkerPool* pool;
+  pthread_t thread;
+  SpatialHash worldMeshSpatialHash;
+  SpatialHashQueryContext queryContext;
+  PhysWorldData world;
+  PhysCollisionStats stats;
+} PhysWorker;
+
+typedef struct PhysWorkerRegionKey {
+  int region;
+  int bodyIndex;
+} PhysWorkerRegionKey;
+
+typedef struct PhysWorkerPool {
+  int workersCount;  // including the calling thread, which is workers[0]
+  PhysWorker* workers;
+  pthread_mutex_t mutex;
+  pthread_cond_t jobReady;
+  pthread_cond_t jobDone;
+  int jobGeneration;  // incremented to start each job
+  int workersBusy;
+  int shutdown;  // boolean
+  // the current job
+  PhysBody* bodies;
+  int* order;  // awake bodies, sorted by region
+  PhysWorkerRegionKey* keys;  // scratch for sorting order
+  int orderCapacity;  // of order and keys
+  int orderCount;
+  int nextChunk;  // taken with __sync_fetch_and_add()
+} PhysWorkerPool;
+
+void PhysWorker_runJob(PhysWorker* self) {
+  PhysWorkerPool* pool;
+  int chunk, k, end;
+  PhysBody* body;
+
+  pool = self->pool;
+  PhysCollisionStats_init(&self->stats);
+  for (;;) {
+    chunk = __sync_fetch_and_add(&pool->nextChunk, 1);
+    k = chunk * PHYS_WORKERS_CHUNK_SIZE;
+    if (k >= pool->orderCount) {
       break;
     }
+    end = MIN(k + PHYS_WORKERS_CHUNK_SIZE, pool->orderCount);
+    for (; k < end; k++) {
+      body = pool->bodies + pool->order[k];
+      PhysBehavior_bodyWorldCollisionResponse(body, &self->world,
+                                              &self->stats);
+    }
   }
-#ifndef PHYS_DEBUG
-  if (i > 0) {
-    debugPrintf("collision response took %d iters\n", i);
+}
+
+void* PhysWorker_main(void* arg) {
+  PhysWorker* self;
+  PhysWorkerPool* pool;
+  int seenGeneration;
+
+  self = (PhysWorker*)arg;
+  pool = self->pool;
+  seenGeneration = 0;
+  for (;;) {
+    pthread_mutex_lock(&pool->mutex);
+    while (!pool->shutdown && pool->jobGeneration == seenGeneration) {
+      pthread_cond_wait(&pool->jobReady, &pool->mutex);
+    }
+    if (pool->shutdown) {
+      pthread_mutex_unlock(&pool->mutex);
+      return NULL;
+    }
+    seenGeneration = pool->jobGeneration;
+    pthread_mutex_unlock(&pool->mutex);
+
+    PhysWorker_runJob(self);
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->workersBusy--;
+    if (pool->workersBusy == 0) {
+      pthread_cond_signal(&pool->jobDone);
+    }
+    pthread_mutex_unlock(&pool->mutex);
   }
-  if (hasAnyCollision) {
-    debugPrintf(
-        "hit PHYS_MAX_COLLISION_ITERATIONS and ended collision response with "
-        "collisions remaining\n");
+}
+
+int PhysWorkerRegionKey_compare(const void* a, const void* b) {
+  const PhysWorkerRegionKey* keyA = (const PhysWorkerRegionKey*)a;
+  const PhysWorkerRegionKey* keyB = (const PhysWorkerRegionKey*)b;
+  if (keyA->region != keyB->region) {
+    return keyA->region < keyB->region ? -1 : 1;
+  }
+  return keyA->bodyIndex - keyB->bodyIndex;
+}
+
+// lists the awake bodies, grouped by region of the world mesh spatial hash
+void PhysWorkerPool_orderBodies(PhysWorkerPool* self,
+                                PhysWorldData* world,
+                                PhysBody* bodies,
+                                int numBodies) {
+  int i, count, regionX, regionZ, regionsInDimension;
+  PhysBody* body;
+  PhysWorkerRegionKey* keys;
+  SpatialHash* hash;
+
+  if (self->orderCapacity < numBodies) {
+    free(self->order);
+    free(self->keys);
+    self->order = (int*)malloc(numBodies * sizeof(int));
+    self->keys =
+        (PhysWorkerRegionKey*)malloc(numBodies * sizeof(PhysWorkerRegionKey));
+    invariant(self->order && self->keys);
+    self->orderCapacity = numBodies;
+  }
+  keys = self->keys;
+
+  hash = world->worldMeshSpatialHash;
+  regionsInDimension =
+      hash->cellsInDimension / PHYS_WORKERS_REGION_CELLS + 1;
+  count = 0;
+  for (i = 0, body = bodies; i < numBodies; i++, body++) {
+    if (!PhysBody_isAwake(body)) {
+      continue;
+    }
+    regionX =
+        SpatialHash_unitsToGridForDimension(PHYS_BODY(body, position.x), hash) /
+        PHYS_WORKERS_REGION_CELLS;
+    regionZ =
+        SpatialHash_unitsToGridForDimension(PHYS_BODY(body, position.z), hash) /
+        PHYS_WORKERS_REGION_CELLS;
+    keys[count].region = regionZ * regionsInDimension + regionX;
+    keys[count].bodyIndex = i;
+    count++;
+  }
+  qsort(keys, count, sizeof(PhysWorkerRegionKey), PhysWorkerRegionKey_compare);
+  for (i = 0; i < count; i++) {
+    self->order[i] = keys[i].bodyIndex;
+  }
+  self->orderCount = count;
+}
+
+// returns FALSE if there are too few bodies to be worth splitting up, and the
+// caller should resolve them itself
+int PhysWorkerPool_worldCollisionResponse(PhysWorkerPool* self,
+                                          PhysWorldData* world,
+                                          PhysBody* bodies,
+                                          int numBodies,
+                                          PhysCollisionStats* stats) {
+  int i;
+  PhysWorker* worker;
+
+  PhysWorkerPool_orderBodies(self, world, bodies, numBodies);
+  if (self->orderCount < PHYS_WORKERS_MIN_BODIES) {
+    return FALSE;
+  }
+  for (i = 0, worker = self->workers; i < self->workersCount; i++, worker++) {
+    // pick up any changes to the world since the workers were started
+    worker->world = *world;
+    worker->world.worldMeshSpatialHash = &worker->worldMeshSpatialHash;
   }
+
+  pthread_mutex_lock(&self->mutex);
+  self->bodies = bodies;
+  self->nextChunk = 0;
+  self->workersBusy = self->workersCount - 1;
+  self->jobGeneration++;
+  pthread_cond_broadcast(&self->jobReady);
+  pthread_mutex_unlock(&self->mutex);
+
+  PhysWorker_runJob(self->workers);
+
+  pthread_mutex_lock(&self->mutex);
+  while (self->workersBusy > 0) {
+    pthread_cond_wait(&self->jobDone, &self->mutex);
+  }
+  pthread_mutex_unlock(&self->mutex);
+
+  // merged in a fixed order, so the stats don't depend on the thread count
+  for (i = 0; i < self->workersCount; i++) {
+    PhysCollisionStats_add(stats, &self->workers[i].stats);
+  }
+  return TRUE;
+}
+#endif
+
+void PhysBehavior_collisionResponse(PhysState* physics,
+                                    PhysBody* bodies,
+                                    int numBodies) {
+  int k;
+  PhysBody* body;
+  PhysWorldData* world;
+  PhysCollisionStats* stats;
+  float profStartObjCollision;
+  float profStartWorldCollision;
+  // int floorHeight = 0.0;
+
+  world = physics->worldData;
+  stats = &physics->collisionStats;
+
+  profStartObjCollision = CUR_TIME_MS();
+  PhysBehavior_bodiesCollisionResponse(&physics->broadphase, bodies,
+                                       numBodies);
+  Trace_addEvent(PhysObjCollisionTraceEvent, profStartObjCollision,
+                 CUR_TIME_MS());
+
+  profStartWorldCollision = CUR_TIME_MS();
+#ifndef __N64__
+  if (!physics->workers ||
+      !PhysWorkerPool_worldCollisionResponse(physics->workers, world, bodies,
+                                             numBodies, stats))
+#endif
+  {
+    for (k = 0, body = bodies; k < numBodies; k++, body++) {
+      if (PhysBody_isAwake(body)) {
+        PhysBehavior_bodyWorldCollisionResponse(body, world, stats);
+      }
+    }
+  }
+  Trace_addEvent(PhysWorldCollisionTraceEvent, profStartWorldCollision,
+                 CUR_TIME_MS());
+#ifndef PHYS_DEBUG
+  debugPrintf(
+      "collision response: %d passes, %d contacts, %d solver iters, %d "
+      "unresolved bodies, max unresolved penetration %f\n",
+      stats->passes, stats->contacts, stats->solverIterations,
+      stats->unresolvedBodies, stats->maxUnresolvedPenetration);
 #endif
 }
 
 void PhysBody_setEnabled(PhysBody* body, int enabled) {
   if (enabled) {
-    body->enabled = TRUE;
+    PHYS_BODY(body, flags) |= PHYS_BODY_ENABLED;
+    PhysBody_wake(body);
     // prevent velocity from movement while disabled
-    Vec3d_copyFrom(&body->prevPosition, &body->position);
+    PhysVec3dArray_copy(&body->world->prevPosition, &body->world->position,
+                        body->index);
   } else {
-    body->enabled = FALSE;
+    PHYS_BODY(body, flags) &= ~PHYS_BODY_ENABLED;
   }
 }
 
 void PhysBehavior_constantForce(PhysBody* body, Vec3d force) {
-  Vec3d_add(&body->acceleration, &force);
+  PhysVec3dArray_add(&body->world->acceleration, body->index, &force);
 }
 
 void PhysBody_applyForce(PhysBody* body, Vec3d* force) {
-  Vec3d_add(&body->acceleration, force);
+  if (Vec3d_magSq(force) > 0) {
+    PhysBody_wake(body);
+  }
+  PhysVec3dArray_add(&body->world->acceleration, body->index, force);
 }
 
 // move but don't affect velocity
 void PhysBody_translateWithoutForce(PhysBody* body, Vec3d* translation) {
-  Vec3d_add(&body->position, translation);
-  Vec3d_add(&body->prevPosition, translation);
+  Vec3d position;
+
+  PhysVec3dArray_add(&body->world->position, body->index, translation);
+  PhysVec3dArray_add(&body->world->prevPosition, body->index, translation);
+  if (!PhysBody_isSleeping(body)) {
+    return;
+  }
+  PhysBody_getPosition(body, &position);
+  if (Vec3d_distanceToSq(&position, &body->sleepPosition) >
+      PHYS_WAKE_MIN_TRANSLATION * PHYS_WAKE_MIN_TRANSLATION) {
+    PhysBody_wake(body);
+  }
+}
+
+// bodies which are already awake are unaffected
+void PhysBody_wake(PhysBody* body) {
+  if (PhysBody_isSleeping(body)) {
+    PHYS_BODY(body, flags) &= ~PHYS_BODY_SLEEPING;
+    body->stillSteps = 0;
+  }
+}
+
+// stops the body where it is
+void PhysBody_stop(PhysBody* body) {
+  PhysWorld* world;
+
+  world = body->world;
+  PhysVec3dArray_origin(&world->velocity, body->index);
+  PhysVec3dArray_origin(&world->nonIntegralVelocity, body->index);
+  PhysVec3dArray_origin(&world->acceleration, body->index);
+  PhysVec3dArray_origin(&world->prevAcceleration, body->index);
+}
+
+// bodies which have been still for long enough go to sleep
+void PhysBody_updateSleep(PhysBody* body) {
+  Vec3d velocity;
+
+  PhysBody_getNonIntegralVelocity(body, &velocity);
+  if (Vec3d_magSq(&velocity) > PHYS_SLEEP_SPEED * PHYS_SLEEP_SPEED) {
+    body->stillSteps = 0;
+    return;
+  }
+  body->stillSteps++;
+  if (body->stillSteps < PHYS_SLEEP_STEPS) {
+    return;
+  }
+  PHYS_BODY(body, flags) |= PHYS_BODY_SLEEPING;
+  PhysBody_getPosition(body, &body->sleepPosition);
+  PhysVec3dArray_copy(&body->world->prevPosition, &body->world->position,
+                      body->index);
+  PhysBody_stop(body);
 }
 
 void PhysBody_update(PhysBody* self,
@@ -311,7 +1277,8 @@ void PhysBody_update(PhysBody* self,
                      int numInPool,
                      PhysState* physics) {
   Vec3d gravity;
-  Vec3d_init(&gravity, 0, physics->worldData->gravity * self->mass, 0);
+  Vec3d_init(&gravity, 0, physics->worldData->gravity * PHYS_BODY(self, mass),
+             0);
   // do behaviours
   PhysBehavior_constantForce(self, gravity);  // apply gravity
 
@@ -319,49 +1286,59 @@ void PhysBody_update(PhysBody* self,
 }
 
 void PhysBody_dampenSmallMovements(PhysBody* body) {
+  Vec3d position, prevPosition;
+
   // dampen small movements
-  if (Vec3d_distanceTo(&body->position, &body->prevPosition) <
-      PHYS_MIN_MOVEMENT) {
-    body->position = body->prevPosition;
-    Vec3d_origin(&body->velocity);
-    Vec3d_origin(&body->nonIntegralVelocity);
-    Vec3d_origin(&body->acceleration);
-    Vec3d_origin(&body->prevAcceleration);
+  PhysBody_getPosition(body, &position);
+  PhysBody_getPrevPosition(body, &prevPosition);
+  if (Vec3d_distanceTo(&position, &prevPosition) < PHYS_MIN_MOVEMENT) {
+    PhysBody_setPosition(body, &prevPosition);
+    PhysBody_stop(body);
   }
 }
 
 void PhysBody_integrateMotionVerlet(PhysBody* body, float dt, float drag) {
-  Vec3d newPosition;
+  Vec3d newPosition, position, prevPosition, velocity, acceleration;
+  PhysWorld* world;
+
+  world = body->world;
+  PhysBody_getPosition(body, &position);
+  PhysBody_getPrevPosition(body, &prevPosition);
+  PhysBody_getAcceleration(body, &acceleration);
   Vec3d_origin(&newPosition);
   /* Scale force to mass. */
-  Vec3d_mulScalar(&body->acceleration, body->massInverse);
+  Vec3d_mulScalar(&acceleration, PHYS_BODY(body, massInverse));
   /* Derive velocity. */
-  Vec3d_copyFrom(&body->velocity, &body->position);
-  Vec3d_sub(&body->velocity, &body->prevPosition);
+  Vec3d_copyFrom(&velocity, &position);
+  Vec3d_sub(&velocity, &prevPosition);
   /* Apply friction. */
-  Vec3d_mulScalar(&body->velocity, drag);
+  Vec3d_mulScalar(&velocity, drag);
   /* Apply acceleration force to new position. */
   /* Get integral acceleration, apply to velocity, then apply updated
      velocity to position */
-  Vec3d_copyFrom(&newPosition, &body->position);
-  Vec3d_mulScalar(&body->acceleration, dt);
-  Vec3d_add(&body->velocity, &body->acceleration);
-  Vec3d_add(&newPosition, &body->velocity);
+  Vec3d_copyFrom(&newPosition, &position);
+  Vec3d_mulScalar(&acceleration, dt);
+  Vec3d_add(&velocity, &acceleration);
+  Vec3d_add(&newPosition, &velocity);
 
   /* Store old position, update position to new position. */
-  Vec3d_copyFrom(&body->prevPosition, &body->position);
-  Vec3d_copyFrom(&body->position, &newPosition);
+  PhysVec3dArray_set(&world->prevPosition, body->index, &position);
+  PhysVec3dArray_set(&world->position, body->index, &newPosition);
+  PhysVec3dArray_set(&world->velocity, body->index, &velocity);
+  PhysVec3dArray_set(&world->acceleration, body->index, &acceleration);
 
 #if PHYSICS_MOTION_DAMPENING
-  PhysBody_dampenSmallMovements(&body);
+  PhysBody_dampenSmallMovements(body);
 #endif
 
   /* Reset acceleration force. */
-  Vec3d_copyFrom(&body->prevAcceleration, &body->acceleration);
-  Vec3d_origin(&body->acceleration);
+  PhysVec3dArray_copy(&world->prevAcceleration, &world->acceleration,
+                      body->index);
+  PhysVec3dArray_origin(&world->acceleration, body->index);
   /* store velocity for use in acc calculations by user code */
-  Vec3d_copyFrom(&body->nonIntegralVelocity, &body->velocity);
-  Vec3d_mulScalar(&body->nonIntegralVelocity, 1.0 / dt);
+  PhysBody_getVelocity(body, &velocity);
+  Vec3d_mulScalar(&velocity, 1.0 / dt);
+  PhysVec3dArray_set(&world->nonIntegralVelocity, body->index, &velocity);
 }
 void PhysBody_integrateMotionSemiImplicitEuler(PhysBody* body,
                                                float dt,
@@ -372,39 +1349,224 @@ void PhysBody_integrateMotionSemiImplicitEuler(PhysBody* body,
   // velocityForDT = velocity * dt
   // position = position + velocityForDT
 
-  Vec3d newPosition;
+  Vec3d newPosition, acceleration, velocity, nonIntegralVelocity;
+  PhysWorld* world;
+
+  world = body->world;
+  PhysBody_getAcceleration(body, &acceleration);
+  PhysBody_getNonIntegralVelocity(body, &nonIntegralVelocity);
   /* Scale force by mass to calculate actual acceleration */
   // acceleration = ( force / mass )
-  Vec3d_mulScalar(&body->acceleration, body->massInverse);
-  body->nonIntegralAcceleration = body->acceleration;  // for debugging
+  Vec3d_mulScalar(&acceleration, PHYS_BODY(body, massInverse));
+  PhysVec3dArray_set(&world->nonIntegralAcceleration, body->index,
+                     &acceleration);  // for debugging
   // accelerationForDT = acceleration * dt
-  Vec3d_mulScalar(&body->acceleration, dt);
+  Vec3d_mulScalar(&acceleration, dt);
+  PhysVec3dArray_set(&world->acceleration, body->index, &acceleration);
 
   // velocity = velocity + accelerationForDT
-  Vec3d_add(&body->nonIntegralVelocity, &body->acceleration);
+  Vec3d_add(&nonIntegralVelocity, &acceleration);
+  PhysVec3dArray_set(&world->nonIntegralVelocity, body->index,
+                     &nonIntegralVelocity);
 
   // velocityForDT = velocity * dt
-  body->velocity = body->nonIntegralVelocity;
-  Vec3d_mulScalar(&body->velocity, dt);
+  velocity = nonIntegralVelocity;
+  Vec3d_mulScalar(&velocity, dt);
 
   /* Apply friction. */
-  Vec3d_mulScalar(&body->velocity, drag);
+  Vec3d_mulScalar(&velocity, drag);
+  PhysVec3dArray_set(&world->velocity, body->index, &velocity);
 
   // position = position + velocityForDT;
-  newPosition = body->position;
-  Vec3d_add(&newPosition, &body->velocity);
+  PhysBody_getPosition(body, &newPosition);
+  Vec3d_add(&newPosition, &velocity);
 
   /* Store old position, update position to new position. */
-  body->prevPosition = body->position;
-  body->position = newPosition;
+  PhysVec3dArray_copy(&world->prevPosition, &world->position, body->index);
+  PhysVec3dArray_set(&world->position, body->index, &newPosition);
 
 #if PHYSICS_MOTION_DAMPENING
   PhysBody_dampenSmallMovements(body);
 #endif
 
   /* Reset acceleration force. */
-  body->prevAcceleration = body->acceleration;
-  Vec3d_origin(&body->acceleration);
+  PhysVec3dArray_copy(&world->prevAcceleration, &world->acceleration,
+                      body->index);
+  PhysVec3dArray_origin(&world->acceleration, body->index);
+}
+
+float* PhysVec3dArray_getAxis(PhysVec3dArray* self, int axis) {
+  return axis == 0 ? self->x : axis == 1 ? self->y : self->z;
+}
+
+// the mask for the bodies integration changes: all ones for bodies which are
+// enabled and awake, and zero for the rest
+int PhysWorld_getAwakeMask(int flags) {
+  return -((flags & (PHYS_BODY_ENABLED | PHYS_BODY_SLEEPING)) ==
+           PHYS_BODY_ENABLED);
+}
+
+// adds gravity to the y forces of the awake bodies, and holds the ones below
+// the water up
+void PhysWorld_applyGravityAndBuoyancy(PhysWorld* self,
+                                       float gravity,
+                                       float waterHeight) {
+  int i, end, awake, underwater;
+  float* mass;
+  float* positionY;
+  float* forceY;
+  float gravityForce;
+  PhysFloatBits force, buoyedForce, prevForce, position, surface;
+
+  end = PHYS_WORLD_PADDED(self->count);
+  mass = self->mass;
+  positionY = self->position.y;
+  forceY = self->acceleration.y;
+  surface.f = waterHeight;
+#if PHYS_WORLD_IVDEP
+#pragma GCC ivdep
+#endif
+  for (i = 0; i < end; i++) {
+    awake = PhysWorld_getAwakeMask(self->flags[i]);
+    position.f = positionY[i];
+    underwater = awake & -(position.f < waterHeight);
+    gravityForce = gravity * mass[i];
+    prevForce.f = forceY[i];
+    force.f = prevForce.f + gravityForce;
+    buoyedForce.f = force.f + -gravityForce;
+    force.i = PHYS_SELECT(awake, force.i, prevForce.i);
+    force.i = PHYS_SELECT(underwater, buoyedForce.i, force.i);
+    forceY[i] = force.f;
+    position.i = PHYS_SELECT(underwater, surface.i, position.i);
+    positionY[i] = position.f;
+  }
+}
+
+// PhysWorld_integrateSemiImplicitEuler() for the x, y or z (0, 1 or 2)
+// components
+void PhysWorld_integrateAxisSemiImplicitEuler(PhysWorld* self,
+                                              int axis,
+                                              float dt,
+                                              float drag) {
+  int i, end, awake;
+  float* massInverse;
+  float* position;
+  float* prevPosition;
+  float* velocity;
+  float* nonIntegralVelocity;
+  float* acceleration;
+  float* nonIntegralAcceleration;
+  float* prevAcceleration;
+  PhysFloatBits force, oldPosition, oldVelocity, oldNonIntegralVelocity;
+  PhysFloatBits newPosition, newVelocity, newNonIntegralVelocity;
+  PhysFloatBits accelerationPerSecond, accelerationForDT, result;
+
+  end = PHYS_WORLD_PADDED(self->count);
+  massInverse = self->massInverse;
+  position = PhysVec3dArray_getAxis(&self->position, axis);
+  prevPosition = PhysVec3dArray_getAxis(&self->prevPosition, axis);
+  velocity = PhysVec3dArray_getAxis(&self->velocity, axis);
+  nonIntegralVelocity =
+      PhysVec3dArray_getAxis(&self->nonIntegralVelocity, axis);
+  acceleration = PhysVec3dArray_getAxis(&self->acceleration, axis);
+  nonIntegralAcceleration =
+      PhysVec3dArray_getAxis(&self->nonIntegralAcceleration, axis);
+  prevAcceleration = PhysVec3dArray_getAxis(&self->prevAcceleration, axis);
+#if PHYS_WORLD_IVDEP
+#pragma GCC ivdep
+#endif
+  for (i = 0; i < end; i++) {
+    awake = PhysWorld_getAwakeMask(self->flags[i]);
+    force.f = acceleration[i];
+    oldPosition.f = position[i];
+    oldVelocity.f = velocity[i];
+    oldNonIntegralVelocity.f = nonIntegralVelocity[i];
+
+    // acceleration = force / mass
+    accelerationPerSecond.f = force.f * massInverse[i];
+    // velocity = velocity + acceleration * dt
+    accelerationForDT.f = accelerationPerSecond.f * dt;
+    newNonIntegralVelocity.f = oldNonIntegralVelocity.f + accelerationForDT.f;
+    // position = position + velocity * dt, with friction
+    newVelocity.f = newNonIntegralVelocity.f * dt * drag;
+    newPosition.f = oldPosition.f + newVelocity.f;
+
+    // everything's worked out for every body, then kept for the awake ones
+    result.f = nonIntegralAcceleration[i];
+    result.i = PHYS_SELECT(awake, accelerationPerSecond.i, result.i);
+    nonIntegralAcceleration[i] = result.f;  // for debugging
+    result.i = PHYS_SELECT(awake, newNonIntegralVelocity.i,
+                           oldNonIntegralVelocity.i);
+    nonIntegralVelocity[i] = result.f;
+    result.i = PHYS_SELECT(awake, newVelocity.i, oldVelocity.i);
+    velocity[i] = result.f;
+    result.f = prevPosition[i];
+    result.i = PHYS_SELECT(awake, oldPosition.i, result.i);
+    prevPosition[i] = result.f;
+    result.i = PHYS_SELECT(awake, newPosition.i, oldPosition.i);
+    position[i] = result.f;
+    /* Reset acceleration force. */
+    result.f = prevAcceleration[i];
+    result.i = PHYS_SELECT(awake, accelerationForDT.i, result.i);
+    prevAcceleration[i] = result.f;
+    force.i &= ~awake;
+    acceleration[i] = force.f;
+  }
+}
+
+// the same as PhysBody_update() followed by
+// PhysBody_integrateMotionSemiImplicitEuler() for each awake body in the
+// world. it runs along the arrays for each component, without branches, so
+// the compiler can vectorize it
+void PhysWorld_integrateSemiImplicitEuler(PhysWorld* self,
+                                          float dt,
+                                          float drag,
+                                          float gravity,
+                                          float waterHeight) {
+  int axis;
+
+  PhysWorld_applyGravityAndBuoyancy(self, gravity, waterHeight);
+  for (axis = 0; axis < 3; axis++) {
+    PhysWorld_integrateAxisSemiImplicitEuler(self, axis, dt, drag);
+  }
+}
+
+// bodies passed to the physics step must be every body in their world, in
+// order
+int PhysBody_isWholeWorld(PhysBody* bodies, int numBodies) {
+  int i;
+
+  for (i = 0; i < numBodies; i++) {
+    if (bodies[i].world != bodies->world || bodies[i].index != i) {
+      return FALSE;
+    }
+  }
+  return !numBodies || bodies->world->count == numBodies;
+}
+
+void PhysBody_integrateBodiesSemiImplicitEuler(PhysBody* bodies,
+                                               int numBodies,
+                                               float dt,
+                                               float drag,
+                                               PhysState* physics) {
+#if PHYSICS_MOTION_DAMPENING
+  int i;
+#endif
+
+  if (!numBodies) {
+    return;
+  }
+  invariant(PhysBody_isWholeWorld(bodies, numBodies));
+  PhysWorld_integrateSemiImplicitEuler(bodies->world, dt, drag,
+                                       physics->worldData->gravity,
+                                       physics->worldData->waterHeight);
+#if PHYSICS_MOTION_DAMPENING
+  for (i = 0; i < numBodies; i++) {
+    if (PhysBody_isAwake(bodies + i)) {
+      PhysBody_dampenSmallMovements(bodies + i);
+    }
+  }
+#endif
 }
 
 void PhysBody_integrateBodies(PhysBody* bodies,
@@ -414,36 +1576,59 @@ void PhysBody_integrateBodies(PhysBody* bodies,
                               PhysState* physics) {
   PhysBody* body;
   int i;
+
+  PhysCollisionStats_init(&physics->collisionStats);
+
+#if PHYSICS_USE_VERLET_INTEGRATION
   for (i = 0, body = bodies; i < numBodies; i++, body++) {
-    if (body->enabled) {
+    if (PhysBody_isAwake(body)) {
       PhysBody_update(body, dt, drag, bodies, numBodies, physics);
     }
   }
 
   for (i = 0, body = bodies; i < numBodies; i++, body++) {
-    if (body->enabled /*&& !body->controlled*/) {
-#if PHYSICS_USE_VERLET_INTEGRATION
+    if (PhysBody_isAwake(body) /*&& !body->controlled*/) {
       PhysBody_integrateMotionVerlet(body, dt, drag);
+    }
+  }
 #else
-      PhysBody_integrateMotionSemiImplicitEuler(body, dt, drag);
+  PhysBody_integrateBodiesSemiImplicitEuler(bodies, numBodies, dt, drag,
+                                            physics);
 #endif
+
+  if (physics->continuousCollision) {
+    for (i = 0, body = bodies; i < numBodies; i++, body++) {
+      if (PhysBody_isAwake(body)) {
+        PhysBehavior_continuousCollisionResponse(body, physics->worldData,
+                                                 &physics->collisionStats);
+      }
     }
   }
 
   // do this after so we can fix any world penetration resulting from motion
   // integration
-  PhysBehavior_collisionResponse(physics->worldData, bodies, numBodies);
+  PhysBehavior_collisionResponse(physics, bodies, numBodies);
+
+  for (i = 0, body = bodies; i < numBodies; i++, body++) {
+    // bodies woken by a collision this step are awake by now too
+    body->moved = PhysBody_isAwake(body);
+    if (body->moved) {
+      PhysBody_updateSleep(body);
+    }
+  }
+
+  PhysCollisionStats_add(&physics->totalCollisionStats,
+                         &physics->collisionStats);
 }
 
-void PhysState_step(PhysState* physics,
-                    PhysBody* bodies,
-                    int numBodies,
-                    float now) {
+// adds the time since the last call to the accumulator, and takes as many
+// fixed timesteps out of it as should be simulated now. the caller runs
+// PhysState_fixedStep() that many times
+int PhysState_advanceClock(PhysState* physics, float now) {
   float time;
-  int i;
+  int steps;
   float timestep;
   float delta;
-  float drag;
   /* Initialise the clock on first step. */
   if (physics->clock == 0.0) {
     physics->clock = now;
@@ -457,44 +1642,87 @@ void PhysState_step(PhysState* physics,
                    16.667 * physics->timeScale * physics->simulationRate;
   delta = time - physics->clock;
   /* sufficient change. */
-  if (delta > 0.0) {
-    /* Convert time to seconds. */
-    delta = delta * 0.001;
-    /* Drag is inversely proportional to viscosity. */
-    drag = 1.0 - physics->worldData->viscosity;
-    /* Update the clock. */
-    physics->clock = time;
-    /* Increment time accumulatedTime.
-       Don't accumulate any additional time if we're already more than 1 second
-       behind. This happens when the tab is backgrounded, and if this grows
-       large enough we won't be able to ever catch up.
-       */
-    if (physics->accumulatedTime < 1.0) {
-      physics->accumulatedTime = physics->accumulatedTime + delta;
-    } else {
+  if (delta <= 0.0) {
+    return 0;
+  }
+  /* Convert time to seconds. */
+  delta = delta * 0.001;
+  timestep = PHYS_TIMESTEP * physics->timeScale;
+  if (fabsf(delta - timestep) < timestep * PHYS_TIMESTEP_SNAP) {
+    delta = timestep;
+  }
+  /* Update the clock. */
+  physics->clock = time;
+  /* Increment time accumulatedTime.
+     Don't accumulate any additional time if we're already more than 1 second
+     behind. This happens when the tab is backgrounded, and if this grows
+     large enough we won't be able to ever catch up.
+     */
+  if (physics->accumulatedTime < 1.0) {
+    physics->accumulatedTime = physics->accumulatedTime + delta;
+  } else {
 #ifndef PHYS_DEBUG
-      debugPrintf(
-          "Physics: accumulated too much time, not accumulating any more\n");
+    debugPrintf(
+        "Physics: accumulated too much time, not accumulating any more\n");
 #endif
-    };
-    /* Integrate until the accumulatedTime is empty or until the */
-    /* maximum amount of iterations per step is reached. */
-    i = 0;
-    timestep = PHYS_TIMESTEP * physics->timeScale;
-    while (physics->accumulatedTime >= timestep && i < PHYS_MAX_STEPS) {
-      /* Integrate bodies by fixed timestep. */
-      PhysBody_integrateBodies(bodies, numBodies, timestep, drag, physics);
-      /* Reduce accumulatedTime by one timestep. */
-      physics->accumulatedTime = physics->accumulatedTime - timestep;
-      i++;
-
-      // TODO: updating physics step multiple times without running game update
-      // step is probably wrong, as forces are reset after each step
-      break;
-    }
+  };
+  /* Take fixed timesteps out of the accumulatedTime until it's empty or the */
+  /* maximum amount of steps per call is reached. */
+  steps = 0;
+  while (physics->accumulatedTime >= timestep && steps < PHYS_MAX_STEPS) {
+    physics->accumulatedTime = physics->accumulatedTime - timestep;
+    steps++;
+  }
+  // if we're too far behind to catch up, drop the time we couldn't simulate,
+  // so the game runs slower rather than running max steps every frame
+  if (physics->accumulatedTime >= timestep) {
+    physics->accumulatedTime = 0.0;
+  }
 #ifndef PHYS_DEBUG
-    debugPrintf("Physics: ran %d timesteps\n", i + 1);
+  debugPrintf("Physics: ran %d timesteps\n", steps);
 #endif
+  return steps;
+}
+
+// how far the clock is between the last fixed step and the next one, from 0
+// to 1. rendering uses this to interpolate from prevStepPosition to position
+float PhysState_getInterpolationAlpha(PhysState* physics) {
+  float alpha;
+  alpha = physics->accumulatedTime / (PHYS_TIMESTEP * physics->timeScale);
+  return CLAMP(alpha, 0.0, 1.0);
+}
+
+// remember where the bodies are before anything moves them in this step
+void PhysState_saveStepPositions(PhysBody* bodies, int numBodies) {
+  PhysBody* body;
+  int i;
+  for (i = 0, body = bodies; i < numBodies; i++, body++) {
+    PhysVec3dArray_copy(&body->world->prevStepPosition, &body->world->position,
+                        body->index);
+  }
+}
+
+// integrate the bodies by one fixed timestep. forces applied to the bodies
+// are reset afterwards, so they must be applied again before the next step
+void PhysState_fixedStep(PhysState* physics, PhysBody* bodies, int numBodies) {
+  /* Drag is inversely proportional to viscosity. */
+  float drag = 1.0 - physics->worldData->viscosity;
+  PhysBody_integrateBodies(bodies, numBodies,
+                           PHYS_TIMESTEP * physics->timeScale, drag, physics);
+}
+
+// runs all the fixed steps due by now. forces applied to the bodies only act
+// on the first of them, so callers which apply forces each step should use
+// PhysState_advanceClock() and PhysState_fixedStep() instead
+void PhysState_step(PhysState* physics,
+                    PhysBody* bodies,
+                    int numBodies,
+                    float now) {
+  int i, steps;
+  steps = PhysState_advanceClock(physics, now);
+  for (i = 0; i < steps; i++) {
+    PhysState_saveStepPositions(bodies, numBodies);
+    PhysState_fixedStep(physics, bodies, numBodies);
   }
 }
 
@@ -504,8 +1732,88 @@ void PhysState_step(PhysState* physics,
 void PhysBody_toString(PhysBody* self, char* buffer) {
   char pos[60];
   char vel[60];
-  Vec3d_toString(&self->position, pos);
-  Vec3d_toString(&self->nonIntegralVelocity, vel);
+  Vec3d position, velocity;
+  PhysBody_getPosition(self, &position);
+  PhysBody_getNonIntegralVelocity(self, &velocity);
+  Vec3d_toString(&position, pos);
+  Vec3d_toString(&velocity, vel);
   sprintf(buffer, "PhysBody id=%d pos=%s vel=%s", self->id, pos, vel);
 }
+
+// splits the world collision response between threadsCount threads (counting
+// the thread which steps the physics). the world data must have been set up
+// by PhysState_init() first
+void PhysState_startWorkers(PhysState* self, int threadsCount) {
+  int i, trianglesCount;
+  PhysWorkerPool* pool;
+  PhysWorker* worker;
+  unsigned int* visitedEpochs;
+  int created;
+
+  invariant(!self->workers);
+  invariant(threadsCount > 0);
+  pool = (PhysWorkerPool*)malloc(sizeof(PhysWorkerPool));
+  invariant(pool);
+  pool->workersCount = threadsCount;
+  pool->workers = (PhysWorker*)malloc(threadsCount * sizeof(PhysWorker));
+  invariant(pool->workers);
+  pthread_mutex_init(&pool->mutex, NULL);
+  pthread_cond_init(&pool->jobReady, NULL);
+  pthread_cond_init(&pool->jobDone, NULL);
+  pool->jobGeneration = 0;
+  pool->workersBusy = 0;
+  pool->shutdown = FALSE;
+  pool->bodies = NULL;
+  pool->order = NULL;
+  pool->keys = NULL;
+  pool->orderCapacity = 0;
+  pool->orderCount = 0;
+  pool->nextChunk = 0;
+
+  trianglesCount = self->worldData->worldMesh->trianglesLength;
+  for (i = 0, worker = pool->workers; i < threadsCount; i++, worker++) {
+    worker->pool = pool;
+    worker->worldMeshSpatialHash = *self->worldData->worldMeshSpatialHash;
+    visitedEpochs =
+        (unsigned int*)malloc(trianglesCount * sizeof(unsigned int));
+    invariant(visitedEpochs);
+    SpatialHashQueryContext_init(&worker->queryContext, visitedEpochs,
+                                 trianglesCount);
+    worker->worldMeshSpatialHash.queryContext = &worker->queryContext;
+  }
+  for (i = 1, worker = pool->workers + 1; i < threadsCount; i++, worker++) {
+    created = pthread_create(&worker->thread, NULL, PhysWorker_main,
+                             (void*)worker) == 0;
+    invariant(created);
+  }
+  self->workers = pool;
+}
+
+void PhysState_stopWorkers(PhysState* self) {
+  int i;
+  PhysWorkerPool* pool;
+
+  pool = self->workers;
+  if (!pool) {
+    return;
+  }
+  pthread_mutex_lock(&pool->mutex);
+  pool->shutdown = TRUE;
+  pthread_cond_broadcast(&pool->jobReady);
+  pthread_mutex_unlock(&pool->mutex);
+  for (i = 1; i < pool->workersCount; i++) {
+    pthread_join(pool->workers[i].thread, NULL);
+  }
+  for (i = 0; i < pool->workersCount; i++) {
+    free(pool->workers[i].queryContext.visitedEpochs);
+  }
+  pthread_mutex_destroy(&pool->mutex);
+  pthread_cond_destroy(&pool->jobReady);
+  pthread_cond_destroy(&pool->jobDone);
+  free(pool->order);
+  free(pool->keys);
+  free(pool->workers);
+  free(pool);
+  self->workers = NULL;
+}
 #endif
@@ -9,16 +9,57 @@
 #define PHYS_MAX_STEPS 4
 
 #define PHYS_TIMESTEP 1.0 / 60.0
+// deltas within this fraction of a timestep of it are taken as exactly one
+// timestep, so that a clock which advances by a timestep every call runs one
+// step every call, rather than sometimes none then two from float rounding
+#define PHYS_TIMESTEP_SNAP 0.02
 
 typedef struct PhysWorldData {
-  Triangle* worldMeshTris;
-  int worldMeshTrisLength;
+  CollisionMesh* worldMesh;
   SpatialHash* worldMeshSpatialHash;
+  // optional, if set the BVH is used instead of the spatial hash. its buffers
+  // must be sized for worldMesh, it's built by PhysState_init()
+  CollisionBVH* worldMeshBVH;
   float gravity;
   float viscosity;
   float waterHeight;
 } PhysWorldData;
 
+// uniform grid on the x,z plane for body vs body collision. it's rebuilt each
+// step, with cells sized to fit the biggest body, and hashed into buckets so
+// it doesn't need to cover the whole world. all arrays are allocated by
+// PhysBroadphase_init()
+typedef struct PhysBroadphase {
+  int capacity;      // max number of bodies
+  int bucketsCount;  // a power of 2
+  float cellSize;
+  int* buckets;      // first body in each bucket, or -1. bucketsCount long
+  int* next;         // next body in the same bucket, or -1. by body index
+  int* prev;         // previous body in the same bucket, or -1
+  int* bodyBuckets;  // bucket each body is in, or -1 if it's not in the grid
+  int* candidates;   // scratch for the bodies which might overlap one body
+} PhysBroadphase;
+
+// world collision statistics for the last step
+typedef struct PhysCollisionStats {
+  int passes;            // world collision queries, over all bodies
+  int contacts;          // penetrating triangles found, over all passes
+  int solverIterations;  // contact solver iterations, over all passes
+  // bodies still penetrating the world after PHYS_MAX_COLLISION_ITERATIONS
+  // passes, and the deepest penetration among them
+  int unresolvedBodies;
+  float maxUnresolvedPenetration;
+  // world candidate cache lookups, and the ms spent collecting candidates
+  // again on misses
+  int candidateCacheHits;
+  int candidateCacheMisses;
+  float candidateCacheMissTime;
+} PhysCollisionStats;
+
+// threads which share out the world collision response (see
+// PhysState_startWorkers()). native builds only
+struct PhysWorkerPool;
+
 typedef struct PhysState {
   float accumulatedTime;
   float clock;
@@ -26,58 +67,169 @@ typedef struct PhysState {
   float simulationRate;
   float timeScale;
   int dynamicTimestep;  // boolean
+  // if set, fast moving bodies are swept against the world mesh as they're
+  // integrated, so they can't pass through thin geometry at low tick rates
+  int continuousCollision;  // boolean
   PhysWorldData* worldData;
+  // if its capacity is less than the number of bodies, every pair of bodies is
+  // tested instead
+  PhysBroadphase broadphase;
+  PhysCollisionStats collisionStats;
+  // collisionStats summed over every step. kept here rather than in the global
+  // profiling counters so that games on different threads don't share them
+  PhysCollisionStats totalCollisionStats;
+  // if set, world collision is split between these threads
+  struct PhysWorkerPool* workers;
 } PhysState;
 
-typedef struct PhysBody {
-  int id;
-  float mass;
-  float massInverse;
-  float radius;
-  float radiusSquared;
-  float restitution;
-  int enabled;
-  int controlled;  // controlled bodies have no inertia
+// the x, y and z components of a vector for every body in a PhysWorld
+typedef struct PhysVec3dArray {
+  float* x;
+  float* y;
+  float* z;
+} PhysVec3dArray;
+
+// bits of PhysWorld.flags
+#define PHYS_BODY_ENABLED 1
+// sleeping bodies skip integration and world collision until something
+// wakes them: a force, being moved, or contact with an awake body
+#define PHYS_BODY_SLEEPING 2
+
+// the motion state of a set of bodies, with an array for each component, so
+// passes over all of them (see PhysWorld_integrateSemiImplicitEuler()) read
+// and write contiguous floats rather than striding through PhysBody records.
+// all arrays are allocated by PhysWorld_init(), in one buffer
+typedef struct PhysWorld {
+  int capacity;  // max number of bodies
+  int count;     // bodies added by PhysBody_init()
   // in verlet, this is used to derive the velocity (pos - prevPos) so changing
   // pos explicitly without changing prevPos will result in acceleration when
   // velocity is derived
-  Vec3d prevPosition;
-  Vec3d position;
+  PhysVec3dArray prevPosition;
+  PhysVec3dArray position;
+  // position before the last fixed step. rendering interpolates from this to
+  // position, by how far the clock is towards the next step
+  PhysVec3dArray prevStepPosition;
   // in verlet this is derived.
   // after integration, it represents the velocity for dt
-  Vec3d velocity;
+  PhysVec3dArray velocity;
   // after integration, this represents the velocity for 1 second
-  Vec3d nonIntegralVelocity;
+  PhysVec3dArray nonIntegralVelocity;
   // this is really force (eg. in newtons) until after integration, when it
   // becomes acceleration
-  Vec3d acceleration;
+  PhysVec3dArray acceleration;
   // after integration, this represents the acceleration for 1 second
-  Vec3d nonIntegralAcceleration;
+  PhysVec3dArray nonIntegralAcceleration;
   // this is the resultant acceleration from the 2x previous timestep
-  Vec3d prevAcceleration;
+  PhysVec3dArray prevAcceleration;
+  float* mass;
+  float* massInverse;
+  float* radius;
+  int* flags;
+  // holds all of the arrays, so the world can be saved with one copy
+  void* buffer;
+  int bufferSize;  // bytes
+} PhysWorld;
+
+// one body in a PhysWorld. the motion state is in the world's arrays, at
+// index, and is read and written through the PhysBody_get/set functions. the
+// rest is only used by the collision response
+typedef struct PhysBody {
+  PhysWorld* world;
+  int index;
+  int id;
+  float radiusSquared;
+  float restitution;
+  int controlled;  // controlled bodies have no inertia
+  int stillSteps;  // consecutive steps spent moving slower than sleep speed
+  Vec3d sleepPosition;  // where the body went to sleep
+  // whether the last step could have moved the body. sleeping and disabled
+  // bodies are only moved by their owner
+  int moved;
+  // world mesh triangles near this body, reused between collision iterations
+  // and frames while it stays in the same spatial hash cells
+  CollisionCandidateCache worldCandidates;
 } PhysBody;
 
 void PhysState_init(PhysState* self, PhysWorldData* worldData);
 
+void PhysBroadphase_init(PhysBroadphase* self, int capacity);
+void PhysBroadphase_destroy(PhysBroadphase* self);
+
+void PhysWorld_init(PhysWorld* self, int capacity);
+void PhysWorld_destroy(PhysWorld* self);
+void PhysWorld_integrateSemiImplicitEuler(PhysWorld* self,
+                                          float dt,
+                                          float drag,
+                                          float gravity,
+                                          float waterHeight);
+
+void PhysVec3dArray_get(PhysVec3dArray* self, int index, Vec3d* result);
+void PhysVec3dArray_set(PhysVec3dArray* self, int index, Vec3d* value);
+
+void PhysCollisionStats_init(PhysCollisionStats* self);
+void PhysCollisionStats_add(PhysCollisionStats* self,
+                            PhysCollisionStats* other);
+
+int PhysState_advanceClock(PhysState* physics, float now);
+float PhysState_getInterpolationAlpha(PhysState* physics);
+void PhysState_saveStepPositions(PhysBody* bodies, int numBodies);
+void PhysState_fixedStep(PhysState* physics, PhysBody* bodies, int numBodies);
 void PhysState_step(PhysState* physics,
                     PhysBody* bodies,
                     int numBodies,
                     float now);
 
 void PhysBody_init(PhysBody* self,
+                   PhysWorld* world,
                    float mass,
                    float radius,
                    Vec3d* position,
                    int id);
 
+void PhysBody_update(PhysBody* self,
+                     float dt,
+                     float drag,
+                     PhysBody* pool,
+                     int numInPool,
+                     PhysState* physics);
+void PhysBody_integrateMotionSemiImplicitEuler(PhysBody* body,
+                                               float dt,
+                                               float drag);
+void PhysBody_integrateBodiesSemiImplicitEuler(PhysBody* bodies,
+                                               int numBodies,
+                                               float dt,
+                                               float drag,
+                                               PhysState* physics);
 void PhysBody_applyForce(PhysBody* body, Vec3d* force);
 void PhysBody_translateWithoutForce(PhysBody* body, Vec3d* translation);
 void PhysBody_setEnabled(PhysBody* body, int enabled);
+void PhysBody_wake(PhysBody* body);
+
+void PhysBody_getPosition(PhysBody* body, Vec3d* result);
+void PhysBody_setPosition(PhysBody* body, Vec3d* position);
+void PhysBody_getPrevPosition(PhysBody* body, Vec3d* result);
+void PhysBody_getPrevStepPosition(PhysBody* body, Vec3d* result);
+void PhysBody_getVelocity(PhysBody* body, Vec3d* result);
+void PhysBody_getNonIntegralVelocity(PhysBody* body, Vec3d* result);
+void PhysBody_setNonIntegralVelocity(PhysBody* body, Vec3d* velocity);
+void PhysBody_getAcceleration(PhysBody* body, Vec3d* result);
+void PhysBody_getNonIntegralAcceleration(PhysBody* body, Vec3d* result);
+float PhysBody_getRadius(PhysBody* body);
+int PhysBody_isEnabled(PhysBody* body);
+int PhysBody_isSleeping(PhysBody* body);
+
+void PhysBehavior_bodiesCollisionResponse(PhysBroadphase* broadphase,
+                                          PhysBody* bodies,
+                                          int numBodies);
 
 #ifndef __N64__
 #include <stdio.h>
 
 void PhysBody_toString(PhysBody* self, char* buffer);
+
+void PhysState_startWorkers(PhysState* self, int threadsCount);
+void PhysState_stopWorkers(PhysState* self);
 #endif
 
 #endif /* !PHYSICS_H */
@@ -2,6 +2,7 @@
 
 #include "animation.h"
 #include "game.h"
+#include "gameobjectgrid.h"
 #include "gameutils.h"
 #include "gooseanimtypes.h"
 #include "input.h"
@@ -37,8 +38,10 @@ void Player_init(Player* self, GameObject* obj) {
   self->lastPickupTick = 0;
 }
 
-int Player_debounceInput(unsigned int lastTrigger, unsigned int cooldown) {
-  if (Game_get()->tick > lastTrigger + cooldown) {
+int Player_debounceInput(unsigned int lastTrigger,
+                         unsigned int cooldown,
+                         Game* game) {
+  if (game->tick > lastTrigger + cooldown) {
     return TRUE;
   }
   return FALSE;
@@ -83,7 +86,7 @@ float Player_move(Player* self, Input* input, Game* game) {
   Vec3d_mulScalar(&playerMovement,
                   movementMagnitude * GOOSE_SPEED * movementSpeedRatio);
 
-  Vec3d_add(&goose->position, &playerMovement);
+  GameObject_translate(goose, &playerMovement);
   resultantMovementSpeed = Vec3d_mag(&playerMovement);
   resultantMovementSpeed /= PLAYER_WALK_ANIM_MOVEMENT_DIVISOR;
 
@@ -93,8 +96,10 @@ float Player_move(Player* self, Input* input, Game* game) {
 void Player_update(Player* self, Input* input, Game* game) {
   float resultantMovementSpeed;
   GameObject* goose;
-  int i;
+  int i, nearbyCount;
   Item* item;
+  Vec3d heldItemPosition;
+  GameObject* nearby[MAX_WORLD_OBJECTS];
   goose = self->goose;
   resultantMovementSpeed = Player_move(self, input, game);
 
@@ -129,12 +134,14 @@ void Player_update(Player* self, Input* input, Game* game) {
 
   if (self->itemHolder.heldItem) {
     // bring item with you
-    self->itemHolder.heldItem->obj->position = self->goose->position;
-    Vec3d_add(&self->itemHolder.heldItem->obj->position, &playerItemOffset);
+    heldItemPosition = self->goose->position;
+    Vec3d_add(&heldItemPosition, &playerItemOffset);
+    GameObject_setPosition(self->itemHolder.heldItem->obj, &heldItemPosition);
   }
 
   if (input->pickup &&
-      Player_debounceInput(self->lastPickupTick, PLAYER_PICKUP_COOLDOWN)) {
+      Player_debounceInput(self->lastPickupTick, PLAYER_PICKUP_COOLDOWN,
+                           game)) {
     if (self->itemHolder.heldItem) {
       // drop item
       Item_drop(self->itemHolder.heldItem);
@@ -142,11 +149,14 @@ void Player_update(Player* self, Input* input, Game* game) {
     } else {
       // TODO: should have a concept of target so goose can look at items to
       // pickup
-      for (i = 0, item = game->items; i < game->itemsCount; i++, item++) {
-        if (Vec3d_distanceTo(&self->goose->position, &item->obj->position) <
-            PLAYER_NEAR_OBJ_DIST) {
+      nearbyCount = GameObjectGrid_getNear(
+          &game->objectGrid, &self->goose->position, PLAYER_NEAR_OBJ_DIST,
+          nearby, MAX_WORLD_OBJECTS);
+      for (i = 0; i < nearbyCount; i++) {
+        item = Game_getItemForObject(game, nearby[i]);
+        if (item) {
           // yes, pick up
-          Item_take(item, &self->itemHolder);
+          Item_take(item, &self->itemHolder, game);
           if (self->itemHolder.heldItem == item) {
             self->lastPickupTick = game->tick;
             // one's enough
@@ -158,7 +168,7 @@ void Player_update(Player* self, Input* input, Game* game) {
   }
 }
 
-void Player_haveItemTaken(Player* self, Item* item) {
+void Player_haveItemTaken(Player* self, Item* item, Game* game) {
   // react to item being taken
 }
 
@@ -175,8 +185,10 @@ void Player_print(Player* self) {
 void Player_toString(Player* self, char* buffer) {
   char pos[60];
   char vel[60];
+  Vec3d velocity;
   Vec3d_toString(&self->goose->position, pos);
-  Vec3d_toString(&self->goose->physBody->nonIntegralVelocity, vel);
+  PhysBody_getNonIntegralVelocity(self->goose->physBody, &velocity);
+  Vec3d_toString(&velocity, vel);
   sprintf(buffer, "Player id=%d pos=%s vel=%s heldItem=%s", self->goose->id,
           pos, vel,
           self->itemHolder.heldItem
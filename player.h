@@ -9,7 +9,7 @@
 void Player_init(Player* self, GameObject* obj);
 void Player_update(Player* self, Input* input, Game* game);
 
-void Player_haveItemTaken(Player* self, Item* item);
+void Player_haveItemTaken(Player* self, Item* item, Game* game);
 
 #ifndef __N64__
 void Player_print(Player* self);
@@ -0,0 +1,18 @@
+import sys
+
+# turns the INPUTS= lines logged by the n64 build (see logInputRecordingChunk in
+# stage00.c) back into an input recording file, which can be replayed with
+# ./headlessbuild.sh -replay
+# usage: python process_input_recording.py logfile recording.inp
+
+line_prefix = "INPUTS="
+
+data = bytearray()
+
+with open(sys.argv[1]) as fp:
+    for line in fp:
+        if line.startswith(line_prefix):
+            data.extend(bytes.fromhex(line[len(line_prefix) :].strip()))
+
+with open(sys.argv[2], "wb") as outfile:
+    outfile.write(data)
@@ -10,7 +10,8 @@ with open("trace.h") as fp:
     matches = re.search(r"TraceEventType\s+{([^}]+?)}", file_text)
     assert matches
 
-    parts = matches.group(1).split(",")
+    # strip comments so they don't end up in the names
+    parts = re.sub(r"//[^\n]*", "", matches.group(1)).split(",")
     event_names = [part.strip().replace("TraceEvent", "") for part in parts]
     event_names = [name for name in event_names if name != ""]
 
@@ -26,61 +26,25 @@ int Renderer_isDynamicObject(GameObject* obj) {
   return obj->physBody != NULL;
 }
 
+// these use the flags baked by Game_init()
 int Renderer_isZBufferedGameObject(GameObject* obj) {
-  if (Renderer_isDynamicObject(obj))
-    return TRUE;
-  if (Renderer_isAnimatedGameObject(obj))
-    return TRUE;
-
-  switch (obj->modelType) {
-    case BushModel:
-      // case WatergrassModel:
-      // case ReedModel:
-      return TRUE;
-    default:
-      return FALSE;
-  }
+  return (obj->flags & GameObjectZBufferedFlag) != 0;
 }
+
 int Renderer_isZWriteGameObject(GameObject* obj) {
-  switch (obj->modelType) {
-    // case GroundModel:
-    case WaterModel:
-      return TRUE;
-    default:
-      return FALSE;
-  }
+  return (obj->flags & GameObjectZWriteFlag) != 0;
 }
 
 int Renderer_isBackgroundGameObject(GameObject* obj) {
-  switch (obj->modelType) {
-    case GroundModel:
-    case WaterModel:
-      return TRUE;
-    default:
-      return FALSE;
-  }
+  return (obj->flags & GameObjectBackgroundFlag) != 0;
 }
 
 int Renderer_isLitGameObject(GameObject* obj) {
-  switch (obj->modelType) {
-    case GroundModel:
-    case WaterModel:
-    case WallModel:
-    case PlanterModel:
-      return TRUE;
-    default:
-      return FALSE;
-  }
+  return (obj->flags & GameObjectLitFlag) != 0;
 }
 
 int Renderer_isAnimatedGameObject(GameObject* obj) {
-  switch (obj->modelType) {
-    case GooseModel:
-    case GardenerCharacterModel:
-      return TRUE;
-    default:
-      return FALSE;
-  }
+  return (obj->flags & GameObjectAnimatedFlag) != 0;
 }
 
 float Renderer_gameobjectSortDist(GameObject* obj, Vec3d* viewPos) {
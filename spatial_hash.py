@@ -1,6 +1,7 @@
 import math
 import json
 import random
+import struct
 
 
 class SpatialHash:
@@ -303,6 +304,54 @@ def create_spatial_hash(triangles, cell_width, units_in_dimension=10000):
     return spatial_hash
 
 
+# compressed sparse row form of the buckets, as used by the game code:
+# bucket i holds triangle_indices[offsets[i]:offsets[i + 1]]
+def to_csr(spatial_hash):
+    offsets = [0]
+    triangle_indices = []
+    for bucket in spatial_hash.buckets:
+        if bucket is not None:
+            triangle_indices.extend(bucket)
+        offsets.append(len(triangle_indices))
+    return offsets, triangle_indices
+
+
+# 16 bit entries are used unless the offsets or indices don't fit
+def csr_needs_wide_indices(offsets, triangle_indices):
+    return max(offsets + triangle_indices) > 0xFFFF
+
+
+SPATIAL_HASH_FILE_MAGIC = b"SHCR"
+SPATIAL_HASH_FILE_VERSION = 1
+
+# binary version of the hash, which the desktop build can mmap with
+# SpatialHash_mapFile(). must match SpatialHashFileHeader in collision.c
+def write_binary(spatial_hash, filepath):
+    offsets, triangle_indices = to_csr(spatial_hash)
+    wide_indices = csr_needs_wide_indices(offsets, triangle_indices)
+    entry_format = "I" if wide_indices else "H"
+    with open(filepath, "wb") as outfile:
+        outfile.write(
+            struct.pack(
+                "<4siifiiii",
+                SPATIAL_HASH_FILE_MAGIC,
+                SPATIAL_HASH_FILE_VERSION,
+                len(spatial_hash.buckets),
+                spatial_hash.cell_width,
+                spatial_hash.cells_in_dimension,
+                spatial_hash.cell_offset_in_dimension,
+                1 if wide_indices else 0,
+                len(triangle_indices),
+            )
+        )
+        outfile.write(struct.pack("<%d%s" % (len(offsets), entry_format), *offsets))
+        outfile.write(
+            struct.pack(
+                "<%d%s" % (len(triangle_indices), entry_format), *triangle_indices
+            )
+        )
+
+
 def test(filepath):
     import turtle
 
@@ -21,6 +21,7 @@
 #include "gameobject.h"
 #include "graphic.h"
 #include "input.h"
+#include "inputrecording.h"
 #include "main.h"
 #include "modeltype.h"
 #include "pathfinding.h"
@@ -70,6 +71,7 @@ typedef enum RenderMode {
 static Vec3d viewPos;
 static Vec3d viewRot;
 static Input input;
+static Game stage00Game;
 
 static u16 perspNorm;
 static u32 nearPlane; /* Near Plane */
@@ -105,6 +107,12 @@ static UsbLoggerState usbLoggerState;
 
 static int logTraceStartOffset = 0;
 static int loggingTrace = FALSE;
+// -1 until the header has been logged
+static int logInputRecordingOffset = -1;
+static int loggingInputRecording = FALSE;
+// the game state straight after Game_init(), restored when a recording starts
+// so that it can be replayed from Game_init() by the headless build
+static void* initialGameSnapshot;
 
 static int twoCycleMode;
 static RenderMode renderModeSetting;
@@ -171,9 +179,9 @@ void initStage00() {
   ed64PrintfSync2("audio heap used=%d, free=%d\n", nuAuStlHeapGetUsed(),
                   nuAuStlHeapGetFree());
 
-  physWorldData = (PhysWorldData){garden_map_collision_collision_mesh,
-                                  GARDEN_MAP_COLLISION_LENGTH,
+  physWorldData = (PhysWorldData){&garden_map_collision_collision_mesh_baked,
                                   &garden_map_collision_collision_mesh_hash,
+                                  /*worldMeshBVH*/ NULL,
                                   /*gravity*/ -9.8 * N64_SCALE_FACTOR,
                                   /*viscosity*/ 0.05,
                                   /*waterHeight*/ WATER_HEIGHT};
@@ -190,6 +198,7 @@ void initStage00() {
   profAvgPath = 0;
 
   loggingTrace = FALSE;
+  loggingInputRecording = FALSE;
 
   twoCycleMode = FALSE;
   renderModeSetting = ToonFlatShadingRenderMode;
@@ -199,14 +208,17 @@ void initStage00() {
   Vec3d_init(&viewRot, 0.0F, 0.0F, 0.0F);
   Input_init(&input);
 
-  Game_init(garden_map_data, GARDEN_MAP_COUNT, &physWorldData);
+  Game_init(&stage00Game, garden_map_data, GARDEN_MAP_COUNT, &physWorldData);
 
   invariant(GARDEN_MAP_COUNT <= MAX_WORLD_OBJECTS);
 
-  game = Game_get();
+  game = &stage00Game;
 
-  game->pathfindingGraph = &garden_map_graph;
-  game->pathfindingState = &garden_map_graph_pathfinding_state;
+  Game_initPathfinding(game, &garden_map_graph,
+                       &garden_map_graph_pathfinding_state);
+
+  initialGameSnapshot = malloc(Game_getSnapshotSize(game));
+  Game_snapshot(game, initialGameSnapshot, Game_getSnapshotSize(game));
 
   lastFrameTime = CUR_TIME_MS();
 
@@ -285,7 +297,7 @@ void makeDL00() {
   char conbuf[100];
 #endif
 
-  game = Game_get();
+  game = &stage00Game;
   consoleOffset = 20;
 
   curTime = CUR_TIME_MS();
@@ -555,6 +567,64 @@ void logTraceChunk() {
 #endif
 }
 
+// logs the input recording as hex, to be turned back into a recording file with
+// process_input_recording.py
+void logInputRecordingChunk() {
+  int i, k;
+  unsigned char buffer[INPUT_RECORDING_TICK_BYTES];
+#if ED64
+
+  if (usbLoggerBufferRemaining() < 120) {
+    return;
+  }
+  if (logInputRecordingOffset == -1) {
+    InputRecording_serializeHeader(InputRecording_getTicksCount(), buffer);
+    debugPrintf("INPUTS=");
+    for (k = 0; k < INPUT_RECORDING_HEADER_BYTES; k++) {
+      debugPrintf("%02x", buffer[k]);
+    }
+    debugPrintf("\n");
+    logInputRecordingOffset = 0;
+    return;
+  }
+
+  debugPrintf("INPUTS=");
+  for (i = logInputRecordingOffset; i < InputRecording_getTicksCount(); i++) {
+    // check we have room for more data
+    if (usbLoggerBufferRemaining() < 40) {
+      break;
+    }
+    InputRecording_serializeTick(i, buffer);
+    for (k = 0; k < INPUT_RECORDING_TICK_BYTES; k++) {
+      debugPrintf("%02x", buffer[k]);
+    }
+    logInputRecordingOffset = i + 1;
+  }
+  debugPrintf("\n");
+
+  if (logInputRecordingOffset == InputRecording_getTicksCount()) {
+    // finished
+    loggingInputRecording = FALSE;
+    logInputRecordingOffset = -1;
+  }
+#endif
+}
+
+void startRecordingInput() {
+  // recordings don't store the state they started from, so restart the game
+  Game_restore(&stage00Game, initialGameSnapshot);
+  InputRecording_clear();
+  InputRecording_start();
+}
+
+void finishRecordingInput() {
+  InputRecording_stop();
+#if ED64 && LOG_TRACES
+  // cleared by logInputRecordingChunk() once it has all been logged
+  loggingInputRecording = usbEnabled;
+#endif
+}
+
 void startRecordingTrace() {
   Trace_clear();
   Trace_start();
@@ -575,7 +645,7 @@ void updateGame00(void) {
   traceRCP();  // record rcp perf from prev frame
 #endif
 
-  game = Game_get();
+  game = &stage00Game;
 
   Vec2d_origin(&input.direction);
 
@@ -620,6 +690,15 @@ void updateGame00(void) {
         }
       }
     }
+    if (contdata[0].trigger & D_CBUTTONS) {
+      if (!loggingInputRecording) {
+        if (!InputRecording_isRecording()) {
+          startRecordingInput();
+        } else {
+          finishRecordingInput();
+        }
+      }
+    }
     // if (contdata[0].button & U_CBUTTONS) {
     //   farPlane += 100.0;
     // }
@@ -641,16 +720,21 @@ void updateGame00(void) {
   if (Trace_getEventsCount() == TRACE_EVENT_BUFFER_SIZE) {
     finishRecordingTrace();
   }
+  if (InputRecording_isRecording() && InputRecording_isFull()) {
+    finishRecordingInput();
+  }
 
   if (usbEnabled) {
 #if LOG_TRACES
     if (loggingTrace) {
       logTraceChunk();
+    } else if (loggingInputRecording) {
+      logInputRecordingChunk();
     }
 #endif
   }
 
-  Game_update(&input);
+  Game_update(game, &input, CUR_TIME_MS());
 
   // if (totalUpdates % 60 == 0) {
   //   debugPrintfSync("retrace=%d\n", nuScRetraceCounter);
@@ -754,12 +838,13 @@ void drawWorldObjects(Dynamic* dynamicp) {
   int* worldObjectsVisibility;
   int* intersectingObjects;
   int visibleObjectsCount;
+  Vec3d objPosition;
   int visibilityCulled = 0;
   float profStartSort, profStartIter, profStartAnim;
   // float profStartAnimLerp;
   float profStartFrustum;
 
-  game = Game_get();
+  game = &stage00Game;
   worldObjectsVisibility = (int*)malloc(game->worldObjectsCount * sizeof(int));
   invariant(worldObjectsVisibility);
 
@@ -899,14 +984,15 @@ void drawWorldObjects(Dynamic* dynamicp) {
     }
 
     // set the transform in world space for the gameobject to render
+    Game_getObjInterpolatedPosition(game, obj, &objPosition);
     guPosition(&dynamicp->objTransforms[i],
                0.0F,                                        // rot x
                obj->rotation.y,                             // rot y
                0.0F,                                        // rot z
                modelTypesProperties[obj->modelType].scale,  // scale
-               obj->position.x,                             // pos x
-               obj->position.y,                             // pos y
-               obj->position.z                              // pos z
+               objPosition.x,                               // pos x
+               objPosition.y,                               // pos y
+               objPosition.z                                // pos z
     );
     gSPMatrix(
         glistp++, OS_K0_TO_PHYSICAL(&(dynamicp->objTransforms[i])),
@@ -1,5 +1,32 @@
 #include "trace.h"
 
+char* TraceEventTypeStrings[] = {
+    "FrameTraceEvent",
+    "SkippedGfxTaskTraceEvent",
+    "MainCPUTraceEvent",
+    "MainMakeDisplayListTraceEvent",
+    "MainUpdateTraceEvent",
+    "RSPTaskTraceEvent",
+    "RDPTaskTraceEvent",
+    "CharactersUpdateTraceEvent",
+    "PathfindingTraceEvent",
+    "DrawTraceEvent",
+    "DrawSortTraceEvent",
+    "DrawIterTraceEvent",
+    "DrawFrustumCullTraceEvent",
+    "PhysUpdateTraceEvent",
+    "PhysWorldCollisionTraceEvent",
+    "PhysObjCollisionTraceEvent",
+    "CollisionGetTrianglesTraceEvent",
+    "CollisionTestMeshSphereTraceEvent",
+    "DebugDrawTraceEvent",
+    "DrawAnimTraceEvent",
+    "AnimLerpTraceEvent",
+    "GameSnapshotTraceEvent",
+    "GameRestoreTraceEvent",
+    "MAX_TRACE_EVENT_TYPE",
+};
+
 float profilingAccumulated[MAX_TRACE_EVENT_TYPE];
 int profilingCounts[MAX_TRACE_EVENT_TYPE];
 
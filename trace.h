@@ -5,6 +5,7 @@
 
 #define TRACE_EVENT_BUFFER_SIZE 10000
 
+// when updating this, also update TraceEventTypeStrings[]
 typedef enum TraceEventType {
   FrameTraceEvent,
   SkippedGfxTaskTraceEvent,
@@ -27,6 +28,8 @@ typedef enum TraceEventType {
   DebugDrawTraceEvent,
   DrawAnimTraceEvent,
   AnimLerpTraceEvent,
+  GameSnapshotTraceEvent,
+  GameRestoreTraceEvent,
   MAX_TRACE_EVENT_TYPE,
 } TraceEventType;
 
@@ -36,6 +39,8 @@ typedef struct TraceEvent {
   float end;
 } TraceEvent;
 
+extern char* TraceEventTypeStrings[];
+
 extern TraceEvent traceEvents[TRACE_EVENT_BUFFER_SIZE];
 
 extern float profilingAccumulated[MAX_TRACE_EVENT_TYPE];